@@ -0,0 +1,231 @@
+#include "BatchRunner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "fmt/format.h"
+
+#include "nlohmann/json.hpp"
+
+#include "complex/Common/StringLiteral.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/Pipeline/Pipeline.hpp"
+#include "complex/Pipeline/PipelineFilter.hpp"
+#include "complex/Utilities/MemoryBudget.hpp"
+
+#include <H5pubconf.h>
+
+namespace fs = std::filesystem;
+using namespace complex;
+using namespace complex::PipelineRunner;
+
+namespace
+{
+constexpr StringLiteral k_JobsKey = "jobs";
+constexpr StringLiteral k_NameKey = "name";
+constexpr StringLiteral k_OverridesKey = "overrides";
+constexpr StringLiteral k_PipelineItemsKey = "pipeline";
+
+std::optional<nlohmann::json> ReadJson(const fs::path& path)
+{
+  std::ifstream file(path);
+  if(!file.is_open())
+  {
+    return {};
+  }
+  try
+  {
+    return nlohmann::json::parse(file);
+  } catch(const nlohmann::json::exception& exception)
+  {
+    return {};
+  }
+}
+
+std::string FirstError(const Pipeline& pipeline)
+{
+  for(const auto& node : pipeline)
+  {
+    const auto* filterNode = dynamic_cast<const PipelineFilter*>(node.get());
+    if(filterNode == nullptr || !filterNode->hasErrors())
+    {
+      continue;
+    }
+    auto errors = filterNode->getErrors();
+    if(!errors.empty())
+    {
+      return fmt::format("{}: {}", filterNode->getName(), errors.front().message);
+    }
+  }
+  return "Unknown error";
+}
+
+BatchJobResult RunJob(const nlohmann::json& pipelineJson, const nlohmann::json& jobJson, usize jobIndex, MemoryBudget& memoryBudget)
+{
+  BatchJobResult result;
+  result.name = jobJson.is_object() ? jobJson.value(k_NameKey.view(), fmt::format("job_{}", jobIndex)) : fmt::format("job_{}", jobIndex);
+  auto startTime = std::chrono::steady_clock::now();
+  auto finish = [&result, startTime](bool succeeded, std::string message) {
+    result.succeeded = succeeded;
+    result.message = std::move(message);
+    result.seconds = std::chrono::duration<float64>(std::chrono::steady_clock::now() - startTime).count();
+    return result;
+  };
+
+  // A job that throws is recorded as failed instead of ending the whole batch
+  try
+  {
+    Result<nlohmann::json> jobPipelineJson = Pipeline::ApplyArgumentOverrides(pipelineJson, jobJson.value(k_OverridesKey.view(), nlohmann::json::object()));
+    if(jobPipelineJson.invalid())
+    {
+      return finish(false, fmt::format("Invalid overrides: {}", jobPipelineJson.errors().front().message));
+    }
+    Result<Pipeline> pipelineResult = Pipeline::FromJson(jobPipelineJson.value());
+    if(pipelineResult.invalid())
+    {
+      return finish(false, "Could not create the pipeline");
+    }
+    Pipeline& pipeline = pipelineResult.value();
+
+    DataStructure preflightStructure;
+    if(!pipeline.preflight(preflightStructure, false))
+    {
+      return finish(false, fmt::format("Preflight failed. {}", FirstError(pipeline)));
+    }
+    Result<std::vector<NodeMemoryEstimate>> estimatesResult = pipeline.estimateMemoryUsage();
+    if(estimatesResult.invalid())
+    {
+      return finish(false, "Could not estimate the memory use");
+    }
+    for(const auto& estimate : estimatesResult.value())
+    {
+      result.estimatedBytes = std::max(result.estimatedBytes, estimate.peakBytes);
+    }
+
+    memoryBudget.acquire(result.estimatedBytes);
+    bool succeeded = false;
+    try
+    {
+      succeeded = pipeline.execute();
+    } catch(...)
+    {
+      memoryBudget.release(result.estimatedBytes);
+      throw;
+    }
+    memoryBudget.release(result.estimatedBytes);
+    if(!succeeded)
+    {
+      return finish(false, fmt::format("Execute failed. {}", FirstError(pipeline)));
+    }
+    return finish(true, "");
+  } catch(const std::exception& exception)
+  {
+    return finish(false, fmt::format("Exception: {}", exception.what()));
+  } catch(...)
+  {
+    return finish(false, "Unknown exception");
+  }
+}
+
+void PrintSummary(const std::vector<BatchJobResult>& results)
+{
+  usize failed = std::count_if(results.cbegin(), results.cend(), [](const BatchJobResult& result) { return !result.succeeded; });
+  std::cout << "\n---------------------------" << std::endl;
+  for(const auto& result : results)
+  {
+    std::cout << fmt::format("{:<32} {:<8} {:>12} bytes {:>10.1f} s  {}", result.name, result.succeeded ? "OK" : "FAILED", result.estimatedBytes, result.seconds, result.message) << std::endl;
+  }
+  std::cout << fmt::format("{} jobs, {} succeeded, {} failed", results.size(), results.size() - failed, failed) << std::endl;
+}
+
+bool WriteReport(const fs::path& reportPath, const std::vector<BatchJobResult>& results)
+{
+  auto jobsJson = nlohmann::json::array();
+  for(const auto& result : results)
+  {
+    nlohmann::json jobJson;
+    jobJson["name"] = result.name;
+    jobJson["succeeded"] = result.succeeded;
+    jobJson["message"] = result.message;
+    jobJson["estimated_bytes"] = result.estimatedBytes;
+    jobJson["seconds"] = result.seconds;
+    jobsJson.push_back(std::move(jobJson));
+  }
+  std::ofstream file(reportPath);
+  if(!file.is_open())
+  {
+    return false;
+  }
+  file << nlohmann::json{{k_JobsKey.str(), std::move(jobsJson)}}.dump(2) << std::endl;
+  return true;
+}
+} // namespace
+
+int complex::PipelineRunner::RunBatch(const fs::path& pipelinePath, const fs::path& manifestPath, const BatchOptions& options)
+{
+#ifndef H5_HAVE_THREADSAFE
+  // Concurrent jobs would call into a non thread safe HDF5 library at the same time
+  if(options.concurrency > 1)
+  {
+    std::cout << "Jobs can only run concurrently if HDF5 is built thread safe (the 'threadsafe' feature of the vcpkg port or HDF5_ENABLE_THREADSAFE). Use '--jobs 1' instead"
+              << std::endl;
+    return -1;
+  }
+#endif
+
+  std::optional<nlohmann::json> pipelineJson = ReadJson(pipelinePath);
+  if(!pipelineJson.has_value() || !pipelineJson->contains(k_PipelineItemsKey.view()))
+  {
+    std::cout << fmt::format("Could not load pipeline at path: '{}'", pipelinePath.string()) << std::endl;
+    return -1;
+  }
+  std::optional<nlohmann::json> manifestJson = ReadJson(manifestPath);
+  if(!manifestJson.has_value() || !manifestJson->contains(k_JobsKey.view()) || !manifestJson->at(k_JobsKey.view()).is_array())
+  {
+    std::cout << fmt::format("Could not load batch manifest at path: '{}'", manifestPath.string()) << std::endl;
+    return -1;
+  }
+
+  const nlohmann::json& jobs = manifestJson->at(k_JobsKey.view());
+  std::cout << fmt::format("Running {} jobs of pipeline '{}' with {} at a time\n", jobs.size(), pipelinePath.string(), options.concurrency) << std::endl;
+
+  std::vector<BatchJobResult> results(jobs.size());
+  MemoryBudget memoryBudget(options.memoryBudget);
+  std::atomic<usize> nextJob = 0;
+  std::mutex outputMutex;
+  auto worker = [&]() {
+    for(usize jobIndex = nextJob++; jobIndex < jobs.size(); jobIndex = nextJob++)
+    {
+      results[jobIndex] = RunJob(*pipelineJson, jobs[jobIndex], jobIndex, memoryBudget);
+      std::lock_guard lock(outputMutex);
+      std::cout << fmt::format("[{}/{}] {} {}", jobIndex + 1, jobs.size(), results[jobIndex].name, results[jobIndex].succeeded ? "finished" : "failed") << std::endl;
+    }
+  };
+
+  std::vector<std::thread> workers;
+  const usize numWorkers = std::clamp<usize>(options.concurrency, 1, std::max<usize>(jobs.size(), 1));
+  for(usize i = 1; i < numWorkers; i++)
+  {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for(auto& thread : workers)
+  {
+    thread.join();
+  }
+
+  PrintSummary(results);
+  if(!options.reportPath.empty() && !WriteReport(options.reportPath, results))
+  {
+    std::cout << fmt::format("Could not write report to: '{}'", options.reportPath.string()) << std::endl;
+  }
+
+  bool allSucceeded = std::all_of(results.cbegin(), results.cend(), [](const BatchJobResult& result) { return result.succeeded; });
+  return allSucceeded ? 0 : -2;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace complex
+{
+namespace PipelineRunner
+{
+/**
+ * @brief Settings for running one pipeline over many inputs in one process.
+ */
+struct BatchOptions
+{
+  usize concurrency = 1;
+  uint64 memoryBudget = 0; // Bytes. 0 means no budget.
+  std::filesystem::path reportPath;
+};
+
+/**
+ * @brief The outcome of one job of a batch.
+ */
+struct BatchJobResult
+{
+  std::string name;
+  bool succeeded = false;
+  std::string message;
+  uint64 estimatedBytes = 0;
+  float64 seconds = 0.0;
+};
+
+/**
+ * @brief Runs the pipeline once for every job in the manifest and prints a
+ * summary. Plugins must already be loaded.
+ *
+ * The manifest is a json file of the form
+ * {"jobs": [{"name": "scan_1", "overrides": {"0": {"input_file": "scan_1.ang"}}}]}
+ * where each override replaces the arguments of the filter at the given index
+ * with values written in the same format as the pipeline file.
+ *
+ * Up to options.concurrency jobs run at once. Each job is preflighted first,
+ * and its memory use is estimated as the largest projected peak of its
+ * filters, see Pipeline::estimateMemoryUsage(). A job only starts executing
+ * once its estimate fits in what is left of options.memoryBudget, unless no
+ * other job is running.
+ *
+ * Returns 0 if every job succeeded. Returns -1 without running any job if
+ * options.concurrency is over 1 and HDF5 is not built thread safe, since
+ * pipelines read and write their data through HDF5. The vcpkg manifest builds
+ * HDF5 with the threadsafe feature; HDF5 from other sources has to be
+ * configured with HDF5_ENABLE_THREADSAFE for concurrent jobs.
+ * @param pipelinePath
+ * @param manifestPath
+ * @param options
+ * @return int
+ */
+int RunBatch(const std::filesystem::path& pipelinePath, const std::filesystem::path& manifestPath, const BatchOptions& options);
+} // namespace PipelineRunner
+} // namespace complex
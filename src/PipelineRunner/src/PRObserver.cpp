@@ -19,6 +19,8 @@ PipelineObserver::PipelineObserver(Pipeline* pipeline)
     pipeline->getFilterRunStateSignal().connect([=](AbstractPipelineNode* node, int32_t index, RunState state) { onRunStateChanged(node, state); });
     pipeline->getFilterUpdateSignal().connect([=](AbstractPipelineNode* node, int32 index, const std::string& msg) { onFilterUpdate(node, msg); });
     pipeline->getPipelineFaultSignal().connect([=](AbstractPipelineNode* node, FaultState state) { onFaultStateChanged(node, state); });
+    pipeline->getFilterFaultDetailSignal().connect(
+        [=](AbstractPipelineNode* node, int32 index, const WarningCollection& warnings, const ErrorCollection& errors) { onFilterFaultDetail(node, warnings, errors); });
   }
 }
 
@@ -76,3 +78,15 @@ void PipelineObserver::onFaultStateChanged(AbstractPipelineNode* node, FaultStat
     break;
   }
 }
+
+void PipelineObserver::onFilterFaultDetail(AbstractPipelineNode* node, const WarningCollection& warnings, const ErrorCollection& errors) const
+{
+  for(const auto& warning : warnings)
+  {
+    std::cout << fmt::format("{} warning {}: {}", node->getName(), warning.code, warning.message) << std::endl;
+  }
+  for(const auto& error : errors)
+  {
+    std::cout << fmt::format("{} error {}: {}", node->getName(), error.code, error.message) << std::endl;
+  }
+}
@@ -34,6 +34,8 @@ protected:
   void onFilterUpdate(AbstractPipelineNode* node, const std::string& msg) const;
 
   void onFaultStateChanged(AbstractPipelineNode* node, FaultState state) const;
+
+  void onFilterFaultDetail(AbstractPipelineNode* node, const WarningCollection& warnings, const ErrorCollection& errors) const;
 };
 } // namespace PipelineRunner
 } // namespace complex
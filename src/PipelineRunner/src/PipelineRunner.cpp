@@ -1,12 +1,18 @@
+#include <algorithm>
+#include <charconv>
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "fmt/format.h"
 
 #include "nlohmann/json.hpp"
 
+#include "BatchRunner.hpp"
 #include "PRObserver.hpp"
 #include "complex/Core/Application.hpp"
 #include "complex/Pipeline/Pipeline.hpp"
@@ -83,6 +89,82 @@ bool shouldPreflight(int argc, char* argv[])
   return false;
 }
 
+bool hasOption(int argc, char* argv[], std::string_view option)
+{
+  for(int i = 2; i < argc; i++)
+  {
+    if(argv[i] == option)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::optional<std::string> getOptionValue(int argc, char* argv[], std::string_view option)
+{
+  for(int i = 2; i + 1 < argc; i++)
+  {
+    if(argv[i] == option)
+    {
+      return argv[i + 1];
+    }
+  }
+  return {};
+}
+
+// Returns an empty optional after printing an error if the value is not a whole number
+template <typename T>
+std::optional<T> getNumericOptionValue(int argc, char* argv[], std::string_view option, T defaultValue)
+{
+  std::optional<std::string> value = getOptionValue(argc, argv, option);
+  if(!value.has_value())
+  {
+    return defaultValue;
+  }
+  T number = defaultValue;
+  const char* end = value->data() + value->size();
+  auto [ptr, errorCode] = std::from_chars(value->data(), end, number);
+  if(errorCode != std::errc() || ptr != end)
+  {
+    std::cout << fmt::format("Option '{}' requires a whole number but was given '{}'", option, *value) << std::endl;
+    return {};
+  }
+  return number;
+}
+
+// Parses a comma separated list of whole numbers such as "2,5,7". Returns an empty
+// optional after printing an error if any entry is not a whole number
+std::optional<std::vector<Pipeline::index_type>> getIndexListOptionValue(int argc, char* argv[], std::string_view option)
+{
+  std::optional<std::string> value = getOptionValue(argc, argv, option);
+  if(!value.has_value())
+  {
+    return std::vector<Pipeline::index_type>{};
+  }
+  std::vector<Pipeline::index_type> indices;
+  std::string_view remaining = *value;
+  while(true)
+  {
+    std::string_view entry = remaining.substr(0, remaining.find(','));
+    Pipeline::index_type index = 0;
+    const char* end = entry.data() + entry.size();
+    auto [ptr, errorCode] = std::from_chars(entry.data(), end, index);
+    if(entry.empty() || errorCode != std::errc() || ptr != end)
+    {
+      std::cout << fmt::format("Option '{}' requires a comma separated list of filter indices but was given '{}'", option, *value) << std::endl;
+      return {};
+    }
+    indices.push_back(index);
+    if(entry.size() == remaining.size())
+    {
+      break;
+    }
+    remaining.remove_prefix(entry.size() + 1);
+  }
+  return indices;
+}
+
 int preflightPipeline(Pipeline& pipeline)
 {
   PipelineRunner::PipelineObserver obs(&pipeline);
@@ -113,13 +195,59 @@ int preflightPipelinePath(const fs::path& pipelinePath)
   return preflightPipeline(pipeline);
 }
 
-int executePipeline(Pipeline& pipeline)
+void printMemoryEstimate(const std::vector<NodeMemoryEstimate>& estimates)
+{
+  uint64 peakBytes = 0;
+  std::cout << fmt::format("{:>5}  {:<40} {:>16} {:>16} {:>16}", "Index", "Filter", "Before (bytes)", "Peak (bytes)", "After (bytes)") << std::endl;
+  for(const auto& estimate : estimates)
+  {
+    std::cout << fmt::format("{:>5}  {:<40} {:>16} {:>16} {:>16}", estimate.index, estimate.name, estimate.bytesBefore, estimate.peakBytes, estimate.bytesAfter) << std::endl;
+    peakBytes = std::max(peakBytes, estimate.peakBytes);
+  }
+  std::cout << fmt::format("Projected peak memory use: {} bytes", peakBytes) << std::endl;
+}
+
+int estimatePipelinePath(const fs::path& pipelinePath)
+{
+  auto result = Pipeline::FromFile(pipelinePath);
+  if(result.invalid())
+  {
+    std::cout << fmt::format("Could not load pipeline at path: '{}'", pipelinePath.string()) << std::endl;
+    return -1;
+  }
+
+  std::cout << fmt::format("Estimating memory use of pipeline at path: '{}'\n", pipelinePath.string()) << std::endl;
+
+  Pipeline pipeline = result.value();
+  int preflightResult = preflightPipeline(pipeline);
+  if(preflightResult != 0)
+  {
+    return preflightResult;
+  }
+  auto estimatesResult = pipeline.estimateMemoryUsage();
+  if(estimatesResult.invalid())
+  {
+    std::cout << "Could not estimate the memory use of the pipeline" << std::endl;
+    return -2;
+  }
+  std::cout << std::endl;
+  printMemoryEstimate(estimatesResult.value());
+  return 0;
+}
+
+int executePipeline(Pipeline& pipeline, bool resume = false)
 {
   PipelineRunner::PipelineObserver obs(&pipeline);
-  if(!pipeline.execute())
+  bool succeeded = resume ? pipeline.resumeFromCheckpoint() : pipeline.execute();
+  if(!succeeded)
   {
     std::cout << "\n-------------------------" << std::endl;
     std::cout << "Error executing pipeline" << std::endl;
+    if(auto estimatesResult = pipeline.estimateMemoryUsage(); pipeline.getMemoryBudget() > 0 && estimatesResult.valid())
+    {
+      std::cout << fmt::format("Memory budget: {} bytes", pipeline.getMemoryBudget()) << std::endl;
+      printMemoryEstimate(estimatesResult.value());
+    }
     return -2;
   }
 
@@ -128,7 +256,7 @@ int executePipeline(Pipeline& pipeline)
   return 0;
 }
 
-int executePipelinePath(const fs::path& pipelinePath)
+int executePipelinePath(const fs::path& pipelinePath, const std::optional<std::string>& checkpointPath, const std::vector<Pipeline::index_type>& checkpointIndices, bool resume, uint64 memoryBudget)
 {
   auto result = Pipeline::FromFile(pipelinePath);
   if(result.invalid())
@@ -140,7 +268,22 @@ int executePipelinePath(const fs::path& pipelinePath)
   std::cout << fmt::format("Executing pipeline at path: '{}'\n", pipelinePath.string()) << std::endl;
 
   Pipeline pipeline = result.value();
-  return executePipeline(pipeline);
+  if(checkpointPath.has_value())
+  {
+    std::cout << fmt::format("Writing checkpoints to: '{}'\n", *checkpointPath) << std::endl;
+    pipeline.setCheckpointPath(*checkpointPath);
+  }
+  for(Pipeline::index_type index : checkpointIndices)
+  {
+    if(index >= pipeline.size())
+    {
+      std::cout << fmt::format("Cannot write a checkpoint after filter {}. The pipeline only has {} filters", index, pipeline.size()) << std::endl;
+      return -1;
+    }
+  }
+  pipeline.setCheckpointIndices(checkpointIndices);
+  pipeline.setMemoryBudget(memoryBudget);
+  return executePipeline(pipeline, resume);
 }
 
 int main(int argc, char* argv[])
@@ -165,12 +308,76 @@ int main(int argc, char* argv[])
     return -1;
   }
 
+  // --threads <count> limits the threads of the whole process, --filter-threads <count> those of each filter,
+  // and --numa-node <id> binds them to a NUMA node
+  std::optional<usize> threadCount = getNumericOptionValue<usize>(argc, argv, "--threads", 0);
+  std::optional<usize> filterThreadLimit = getNumericOptionValue<usize>(argc, argv, "--filter-threads", 0);
+  std::optional<int32> numaNode = getNumericOptionValue<int32>(argc, argv, "--numa-node", -1);
+  if(!threadCount.has_value() || !filterThreadLimit.has_value() || !numaNode.has_value())
+  {
+    return -1;
+  }
+  // -1 leaves the threads unbound; any other id has to be a node TBB can bind to
+  if(std::vector<int32> numaNodes = ExecutionContext::GetNumaNodes(); *numaNode != -1 && std::find(numaNodes.cbegin(), numaNodes.cend(), *numaNode) == numaNodes.cend())
+  {
+    if(numaNodes == std::vector<int32>{-1})
+    {
+      std::cout << fmt::format("Option '--numa-node' was given '{}' but this build cannot bind threads to NUMA nodes", *numaNode) << std::endl;
+    }
+    else
+    {
+      std::cout << fmt::format("Option '--numa-node' was given '{}' but the available NUMA nodes are: {}", *numaNode, fmt::join(numaNodes, ", ")) << std::endl;
+    }
+    return -1;
+  }
+  ExecutionContext& executionContext = app.getExecutionContext();
+  executionContext.setThreadCount(*threadCount);
+  executionContext.setFilterThreadLimit(*filterThreadLimit);
+  executionContext.setNumaNode(*numaNode);
+
+  // --batch <manifest> runs the pipeline once per job in the manifest
+  if(auto manifestPath = getOptionValue(argc, argv, "--batch"); manifestPath.has_value())
+  {
+    PipelineRunner::BatchOptions options;
+    std::optional<usize> concurrency = getNumericOptionValue<usize>(argc, argv, "--jobs", 1);
+    std::optional<uint64> memoryBudget = getNumericOptionValue<uint64>(argc, argv, "--memory-budget", 0);
+    if(!concurrency.has_value() || !memoryBudget.has_value())
+    {
+      return -1;
+    }
+    options.concurrency = *concurrency;
+    options.memoryBudget = *memoryBudget;
+    options.reportPath = getOptionValue(argc, argv, "--report").value_or("");
+    return PipelineRunner::RunBatch(targetPath, *manifestPath, options);
+  }
+
+  // --estimate prints the projected memory use of each filter without executing
+  if(hasOption(argc, argv, "--estimate"))
+  {
+    return estimatePipelinePath(targetPath);
+  }
+
   if(shouldPreflight(argc, argv))
   {
     return preflightPipelinePath(targetPath);
   }
   else
   {
-    return executePipelinePath(targetPath);
+    // --checkpoint <file> writes a checkpoint after every filter, or only after the filters listed
+    // by --checkpoint-after <i,j,...>; --resume continues from it
+    // --memory-budget <bytes> refuses to execute if a filter's projected peak is over the budget
+    std::optional<std::vector<Pipeline::index_type>> checkpointIndices = getIndexListOptionValue(argc, argv, "--checkpoint-after");
+    std::optional<uint64> memoryBudget = getNumericOptionValue<uint64>(argc, argv, "--memory-budget", 0);
+    if(!checkpointIndices.has_value() || !memoryBudget.has_value())
+    {
+      return -1;
+    }
+    std::optional<std::string> checkpointPath = getOptionValue(argc, argv, "--checkpoint");
+    if(!checkpointIndices->empty() && !checkpointPath.has_value())
+    {
+      std::cout << "Option '--checkpoint-after' requires '--checkpoint <file>'" << std::endl;
+      return -1;
+    }
+    return executePipelinePath(targetPath, checkpointPath, *checkpointIndices, hasOption(argc, argv, "--resume"), *memoryBudget);
   }
 }
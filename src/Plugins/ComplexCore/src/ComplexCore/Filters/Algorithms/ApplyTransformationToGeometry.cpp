@@ -1,21 +1,30 @@
 
 #include "ApplyTransformationToGeometry.hpp"
 
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
 #include "complex/DataStructure/Geometry/AbstractGeometry.hpp"
 #include "complex/DataStructure/Geometry/EdgeGeom.hpp"
 #include "complex/DataStructure/Geometry/HexahedralGeom.hpp"
+#include "complex/DataStructure/Geometry/ImageGeom.hpp"
 #include "complex/DataStructure/Geometry/QuadGeom.hpp"
 #include "complex/DataStructure/Geometry/TetrahedralGeom.hpp"
 #include "complex/DataStructure/Geometry/TriangleGeom.hpp"
 #include "complex/DataStructure/Geometry/VertexGeom.hpp"
+#include "complex/Utilities/FilterUtilities.hpp"
 #include "complex/Utilities/ParallelDataAlgorithm.hpp"
 
 #include <Eigen/Dense>
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
+#include <limits>
 #include <map>
+#include <type_traits>
 
 using namespace complex;
 
@@ -83,6 +92,186 @@ private:
   size_t m_ProgIncrement = 0;
 };
 
+namespace
+{
+using ProjectiveMatrix = Eigen::Matrix<float, 4, 4, Eigen::RowMajor>;
+
+// Destination cells are resampled in blocks of at most this many cells along x. The source
+// samples of a block are computed once and then applied to every array.
+constexpr usize k_BlockSize = 256;
+
+/**
+ * @brief Where a destination cell samples the source ImageGeom. The nearest cell is always set,
+ * the eight corner cells and their weights only for linear interpolation.
+ */
+struct SourceSample
+{
+  bool inside = false;
+  usize nearest = 0;
+  std::array<usize, 8> corners = {};
+  std::array<float64, 8> weights = {};
+};
+
+using ResampleBlockFunc = void (*)(const uint8* sourceBytes, uint8* destinationBytes, usize numComponents, usize destinationStart, const std::vector<SourceSample>& samples, bool linear);
+
+/**
+ * @brief Resamples one block of destination cells of an array. Only floating point arrays are
+ * linearly interpolated; integer and boolean arrays always take the nearest source cell.
+ */
+template <typename T>
+void ResampleBlock(const uint8* sourceBytes, uint8* destinationBytes, usize numComponents, usize destinationStart, const std::vector<SourceSample>& samples, bool linear)
+{
+  const T* source = reinterpret_cast<const T*>(sourceBytes);
+  T* destination = reinterpret_cast<T*>(destinationBytes) + destinationStart * numComponents;
+  for(const SourceSample& sample : samples)
+  {
+    if(!sample.inside)
+    {
+      std::fill_n(destination, numComponents, static_cast<T>(0));
+    }
+    else if constexpr(std::is_floating_point_v<T>)
+    {
+      if(linear)
+      {
+        for(usize comp = 0; comp < numComponents; comp++)
+        {
+          float64 value = 0.0;
+          for(usize corner = 0; corner < 8; corner++)
+          {
+            value += sample.weights[corner] * static_cast<float64>(source[sample.corners[corner] * numComponents + comp]);
+          }
+          destination[comp] = static_cast<T>(value);
+        }
+      }
+      else
+      {
+        std::copy_n(source + sample.nearest * numComponents, numComponents, destination);
+      }
+    }
+    else
+    {
+      std::copy_n(source + sample.nearest * numComponents, numComponents, destination);
+    }
+    destination += numComponents;
+  }
+}
+
+/**
+ * @brief A source array, the array it is resampled into and the kernel for their type.
+ */
+struct ResampledArray
+{
+  const uint8* sourceBytes = nullptr;
+  uint8* destinationBytes = nullptr;
+  usize numComponents = 0;
+  ResampleBlockFunc resampleBlock = nullptr;
+};
+
+struct CreateResampledArrayFunctor
+{
+  template <typename T>
+  ResampledArray operator()(const IDataArray& source, IDataArray& destination) const
+  {
+    ResampledArray resampledArray;
+    const auto* sourceStore = dynamic_cast<const DataStore<T>*>(dynamic_cast<const DataArray<T>&>(source).getDataStore());
+    auto* destinationStore = dynamic_cast<DataStore<T>*>(dynamic_cast<DataArray<T>&>(destination).getDataStore());
+    if(sourceStore != nullptr && destinationStore != nullptr)
+    {
+      resampledArray.sourceBytes = reinterpret_cast<const uint8*>(sourceStore->data());
+      resampledArray.destinationBytes = reinterpret_cast<uint8*>(destinationStore->data());
+      resampledArray.numComponents = source.getNumberOfComponents();
+      resampledArray.resampleBlock = &ResampleBlock<T>;
+    }
+    return resampledArray;
+  }
+};
+
+/**
+ * @brief Fills in where the source is sampled for a destination cell, given its position in
+ * continuous source cell coordinates (cell centers are at whole numbers).
+ * @param position
+ * @param dims
+ * @param linear
+ * @param sample
+ */
+void ComputeSourceSample(const std::array<float64, 3>& position, const SizeVec3& dims, bool linear, SourceSample& sample)
+{
+  std::array<usize, 3> nearest = {};
+  std::array<usize, 3> lower = {};
+  std::array<usize, 3> upper = {};
+  std::array<float64, 3> fraction = {};
+  sample.inside = true;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    const float64 dim = static_cast<float64>(dims[axis]);
+    if(!(position[axis] >= -0.5 && position[axis] < dim - 0.5))
+    {
+      sample.inside = false;
+      return;
+    }
+    nearest[axis] = std::min(static_cast<usize>(std::floor(position[axis] + 0.5)), dims[axis] - 1);
+    const float64 floorValue = std::floor(position[axis]);
+    fraction[axis] = position[axis] - floorValue;
+    // Cells within half a cell of the border use the border cell for both corners
+    lower[axis] = static_cast<usize>(std::max(floorValue, 0.0));
+    upper[axis] = std::min(static_cast<usize>(std::max(floorValue + 1.0, 0.0)), dims[axis] - 1);
+  }
+  sample.nearest = (nearest[2] * dims[1] + nearest[1]) * dims[0] + nearest[0];
+  if(!linear)
+  {
+    return;
+  }
+  for(usize corner = 0; corner < 8; corner++)
+  {
+    const usize x = (corner & 1) != 0 ? upper[0] : lower[0];
+    const usize y = (corner & 2) != 0 ? upper[1] : lower[1];
+    const usize z = (corner & 4) != 0 ? upper[2] : lower[2];
+    sample.corners[corner] = (z * dims[1] + y) * dims[0] + x;
+    sample.weights[corner] = ((corner & 1) != 0 ? fraction[0] : 1.0 - fraction[0]) * ((corner & 2) != 0 ? fraction[1] : 1.0 - fraction[1]) *
+                             ((corner & 4) != 0 ? fraction[2] : 1.0 - fraction[2]);
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+TransformedImageGrid complex::ComputeTransformedImageGrid(const SizeVec3& dims, const FloatVec3& origin, const FloatVec3& spacing, const std::vector<float>& transformationMatrix)
+{
+  Eigen::Map<const ProjectiveMatrix> transformation(transformationMatrix.data());
+
+  std::array<float32, 3> minimum = {std::numeric_limits<float32>::max(), std::numeric_limits<float32>::max(), std::numeric_limits<float32>::max()};
+  std::array<float32, 3> maximum = {std::numeric_limits<float32>::lowest(), std::numeric_limits<float32>::lowest(), std::numeric_limits<float32>::lowest()};
+  for(usize corner = 0; corner < 8; corner++)
+  {
+    Eigen::Vector4f position(origin[0] + ((corner & 1) != 0 ? static_cast<float32>(dims[0]) * spacing[0] : 0.0f),
+                             origin[1] + ((corner & 2) != 0 ? static_cast<float32>(dims[1]) * spacing[1] : 0.0f),
+                             origin[2] + ((corner & 4) != 0 ? static_cast<float32>(dims[2]) * spacing[2] : 0.0f), 1.0f);
+    Eigen::Vector4f transformedPosition = transformation * position;
+    for(usize axis = 0; axis < 3; axis++)
+    {
+      minimum[axis] = std::min(minimum[axis], transformedPosition[axis]);
+      maximum[axis] = std::max(maximum[axis], transformedPosition[axis]);
+    }
+  }
+
+  TransformedImageGrid grid;
+  grid.spacing = spacing;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    grid.origin[axis] = minimum[axis];
+    // Allow for rounding so an exact multiple of the spacing does not gain a cell
+    const float64 numCells = std::ceil(static_cast<float64>(maximum[axis] - minimum[axis]) / static_cast<float64>(spacing[axis]) - 1.0e-4);
+    grid.dims[axis] = static_cast<usize>(std::max(numCells, 1.0));
+  }
+  return grid;
+}
+
+// -----------------------------------------------------------------------------
+bool complex::IsTransformationInvertible(const std::vector<float>& transformationMatrix)
+{
+  Eigen::Map<const ProjectiveMatrix> transformation(transformationMatrix.data());
+  return std::abs(transformation.cast<float64>().determinant()) > 1.0e-12;
+}
+
 // -----------------------------------------------------------------------------
 ApplyTransformationToGeometry::ApplyTransformationToGeometry(DataStructure& dataStructure, ApplyTransformationToGeometryInputValues* inputValues, const std::atomic_bool& shouldCancel,
                                                              const IFilter::MessageHandler& mesgHandler)
@@ -101,6 +290,10 @@ Result<> ApplyTransformationToGeometry::operator()()
 {
 
   DataObject* dataObject = m_DataStructure.getData(m_InputValues->pGeometryToTransform);
+  if(dataObject->getDataObjectType() == DataObject::Type::ImageGeom)
+  {
+    return resampleImageGeometry();
+  }
 
   AbstractGeometry::SharedVertexList* vertexList = nullptr;
 
@@ -108,6 +301,8 @@ Result<> ApplyTransformationToGeometry::operator()()
   {
     VertexGeom& geom = m_DataStructure.getDataRefAs<VertexGeom>(m_InputValues->pGeometryToTransform);
     vertexList = geom.getVertices();
+    geom.deleteKdTree();
+    geom.deleteVertexBins();
   }
   else if(dataObject->getDataObjectType() == DataObject::Type::EdgeGeom)
   {
@@ -136,7 +331,7 @@ Result<> ApplyTransformationToGeometry::operator()()
   }
   else
   {
-    return {MakeErrorResult(-7010, fmt::format("Geometry is not of the proper Type of Vertex, Edge, Triangle, Quad, Tetrahedral, hexahedral. Type is: '{}", dataObject->getDataObjectType()))};
+    return {MakeErrorResult(-7010, fmt::format("Geometry is not of the proper Type of Image, Vertex, Edge, Triangle, Quad, Tetrahedral, hexahedral. Type is: '{}", dataObject->getDataObjectType()))};
   }
 
   m_TotalElements = vertexList->getNumberOfTuples();
@@ -152,6 +347,98 @@ Result<> ApplyTransformationToGeometry::operator()()
   return {};
 }
 
+// -----------------------------------------------------------------------------
+Result<> ApplyTransformationToGeometry::resampleImageGeometry()
+{
+  const std::vector<float>& transformationMatrix = m_InputValues->transformationMatrix;
+  if(!IsTransformationInvertible(transformationMatrix))
+  {
+    return {MakeErrorResult(-7011, "The transformation matrix can not be inverted so the Image Geometry can not be resampled")};
+  }
+  Eigen::Map<const ProjectiveMatrix> transformation(transformationMatrix.data());
+  const Eigen::Matrix4d inverse = transformation.cast<float64>().inverse();
+
+  const auto& sourceGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->pGeometryToTransform);
+  auto& destinationGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->pTransformedImageGeometry);
+  const SizeVec3 sourceDims = sourceGeom.getDimensions();
+  const FloatVec3 sourceOrigin = sourceGeom.getOrigin();
+  const FloatVec3 sourceSpacing = sourceGeom.getSpacing();
+  const TransformedImageGrid grid = ComputeTransformedImageGrid(sourceDims, sourceOrigin, sourceSpacing, transformationMatrix);
+  const usize numDestinationCells = grid.dims[0] * grid.dims[1] * grid.dims[2];
+
+  // A pre-computed matrix may only be known now, so the grid created during preflight can differ
+  destinationGeom.setDimensions(grid.dims);
+  destinationGeom.setOrigin(grid.origin);
+  destinationGeom.setSpacing(grid.spacing);
+
+  const DataPath cellDataPath = m_InputValues->pTransformedImageGeometry.createChildPath(m_InputValues->pTransformedCellDataName);
+  std::vector<ResampledArray> resampledArrays;
+  for(const auto& cellArrayPath : m_InputValues->pCellArrays)
+  {
+    const auto& sourceArray = m_DataStructure.getDataRefAs<IDataArray>(cellArrayPath);
+    auto& destinationArray = m_DataStructure.getDataRefAs<IDataArray>(cellDataPath.createChildPath(cellArrayPath.getTargetName()));
+    if(destinationArray.getNumberOfTuples() != numDestinationCells)
+    {
+      destinationArray.getIDataStore()->reshapeTuples({grid.dims[2], grid.dims[1], grid.dims[0]});
+    }
+    ResampledArray resampledArray = ExecuteDataFunction(CreateResampledArrayFunctor{}, sourceArray.getDataType(), sourceArray, destinationArray);
+    if(resampledArray.resampleBlock == nullptr)
+    {
+      return {MakeErrorResult(-7012, fmt::format("The DataArray '{}' is not held in memory and can not be resampled", cellArrayPath.toString()))};
+    }
+    resampledArrays.push_back(resampledArray);
+  }
+
+  m_TotalElements = numDestinationCells;
+  m_ProgressCounter = 0;
+  m_LastProgressInt = 0;
+
+  const bool linear = m_InputValues->pInterpolationType == InterpolationType::Linear;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, grid.dims[2]);
+  dataAlg.execute([&](const ComplexRange& range) {
+    std::vector<SourceSample> samples;
+    samples.reserve(k_BlockSize);
+    for(usize z = range.min(); z < range.max(); z++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      for(usize y = 0; y < grid.dims[1]; y++)
+      {
+        for(usize blockStart = 0; blockStart < grid.dims[0]; blockStart += k_BlockSize)
+        {
+          const usize blockEnd = std::min(blockStart + k_BlockSize, grid.dims[0]);
+          samples.resize(blockEnd - blockStart);
+          for(usize x = blockStart; x < blockEnd; x++)
+          {
+            // Map the destination cell center back into the source and convert it to source cell coordinates
+            const Eigen::Vector4d destinationPosition(grid.origin[0] + (static_cast<float64>(x) + 0.5) * grid.spacing[0], grid.origin[1] + (static_cast<float64>(y) + 0.5) * grid.spacing[1],
+                                                      grid.origin[2] + (static_cast<float64>(z) + 0.5) * grid.spacing[2], 1.0);
+            const Eigen::Vector4d sourcePosition = inverse * destinationPosition;
+            std::array<float64, 3> cellPosition = {};
+            for(usize axis = 0; axis < 3; axis++)
+            {
+              cellPosition[axis] = (sourcePosition[axis] - sourceOrigin[axis]) / sourceSpacing[axis] - 0.5;
+            }
+            ComputeSourceSample(cellPosition, sourceDims, linear, samples[x - blockStart]);
+          }
+
+          const usize destinationStart = (z * grid.dims[1] + y) * grid.dims[0] + blockStart;
+          for(const ResampledArray& resampledArray : resampledArrays)
+          {
+            resampledArray.resampleBlock(resampledArray.sourceBytes, resampledArray.destinationBytes, resampledArray.numComponents, destinationStart, samples, linear);
+          }
+        }
+      }
+      sendThreadSafeProgressMessage(grid.dims[0] * grid.dims[1]);
+    }
+  });
+
+  return {};
+}
+
 // -----------------------------------------------------------------------------
 void ApplyTransformationToGeometry::sendThreadSafeProgressMessage(size_t counter)
 {
@@ -2,12 +2,14 @@
 
 #include "ComplexCore/ComplexCore_export.hpp"
 
+#include "complex/Common/Array.hpp"
 #include "complex/DataStructure/DataPath.hpp"
 #include "complex/DataStructure/DataStructure.hpp"
 #include "complex/Filter/IFilter.hpp"
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 namespace complex
@@ -23,13 +25,52 @@ enum class TransformType
   Scale
 };
 
+enum class InterpolationType
+{
+  NearestNeighbor = 0,
+  Linear
+};
+
 struct COMPLEXCORE_EXPORT ApplyTransformationToGeometryInputValues
 {
   DataPath pGeometryToTransform;
   TransformType pTransformationType;
   std::vector<float> transformationMatrix;
+  // Only used when an ImageGeom is transformed
+  InterpolationType pInterpolationType = InterpolationType::NearestNeighbor;
+  std::vector<DataPath> pCellArrays;
+  DataPath pTransformedImageGeometry;
+  std::string pTransformedCellDataName;
+};
+
+/**
+ * @brief The grid an ImageGeom is resampled onto. It keeps the spacing of the source and
+ * covers the transformed bounds of the source.
+ */
+struct COMPLEXCORE_EXPORT TransformedImageGrid
+{
+  SizeVec3 dims;
+  FloatVec3 origin;
+  FloatVec3 spacing;
 };
 
+/**
+ * @brief Computes the grid that the transformed ImageGeom is resampled onto.
+ * @param dims Dimensions of the source ImageGeom
+ * @param origin Origin of the source ImageGeom
+ * @param spacing Spacing of the source ImageGeom
+ * @param transformationMatrix 4x4 matrix in row major order
+ * @return TransformedImageGrid
+ */
+COMPLEXCORE_EXPORT TransformedImageGrid ComputeTransformedImageGrid(const SizeVec3& dims, const FloatVec3& origin, const FloatVec3& spacing, const std::vector<float>& transformationMatrix);
+
+/**
+ * @brief Returns true if the 4x4 row major matrix can be inverted.
+ * @param transformationMatrix
+ * @return bool
+ */
+COMPLEXCORE_EXPORT bool IsTransformationInvertible(const std::vector<float>& transformationMatrix);
+
 class COMPLEXCORE_EXPORT ApplyTransformationToGeometry
 {
 public:
@@ -50,6 +91,13 @@ public:
   void sendThreadSafeProgressMessage(size_t counter);
 
 private:
+  /**
+   * @brief Resamples the selected cell arrays of an ImageGeom through the inverse
+   * transformation onto the transformed ImageGeom.
+   * @return Result<>
+   */
+  Result<> resampleImageGeometry();
+
   DataStructure& m_DataStructure;
   const ApplyTransformationToGeometryInputValues* m_InputValues = nullptr;
   const std::atomic_bool& m_ShouldCancel;
@@ -4,8 +4,7 @@
 #include "complex/Utilities/DataArrayUtilities.hpp"
 #include "complex/Utilities/Math/StatisticsCalculations.hpp"
 #include "complex/Utilities/ParallelDataAlgorithm.hpp"
-
-#include <unordered_map>
+#include "complex/Utilities/SegmentedReduction.hpp"
 
 using namespace complex;
 
@@ -15,9 +14,10 @@ template <typename T>
 class FindArrayStatisticsByIndexImpl
 {
 public:
-  FindArrayStatisticsByIndexImpl(std::unordered_map<int32, std::list<T>>& featureDataMap, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation, bool summation,
-                                 std::vector<IDataArray*>& arrays, bool hist, float64 histmin, float64 histmax, bool histfullrange, int32 numBins)
-  : m_FeatureDataMap(featureDataMap)
+  FindArrayStatisticsByIndexImpl(const DataArray<T>& source, const SegmentedReduction::FeatureGrouping& featureGrouping, bool length, bool min, bool max, bool mean, bool median, bool stdDeviation,
+                                 bool summation, std::vector<IDataArray*>& arrays, bool hist, float64 histmin, float64 histmax, bool histfullrange, int32 numBins)
+  : m_Source(source)
+  , m_FeatureGrouping(featureGrouping)
   , m_Length(length)
   , m_Min(min)
   , m_Max(max)
@@ -79,41 +79,50 @@ public:
       throw std::invalid_argument("FindArrayStatisticsByIndexImpl::compute() could not dynamic_cast 'Histogram' array to needed type. Check input array selection.");
     }
 
+    std::vector<T> featureData;
     for(usize i = start; i < end; i++)
     {
+      // Gather the values of this feature in cell order
+      nonstd::span<const usize> cells = m_FeatureGrouping.getCells(i);
+      featureData.resize(cells.size());
+      for(usize j = 0; j < cells.size(); j++)
+      {
+        featureData[j] = m_Source[cells[j]];
+      }
+
       if(m_Length)
       {
-        uint64 val = static_cast<uint64>(m_FeatureDataMap[i].size());
+        uint64 val = static_cast<uint64>(featureData.size());
         array0->initializeTuple(i, val);
       }
       if(m_Min)
       {
-        T val = StaticicsCalculations::findMin(m_FeatureDataMap[i]);
+        T val = StaticicsCalculations::findMin(featureData);
         array1->initializeTuple(i, val);
       }
       if(m_Max)
       {
-        T val = StaticicsCalculations::findMax(m_FeatureDataMap[i]);
+        T val = StaticicsCalculations::findMax(featureData);
         array2->initializeTuple(i, val);
       }
       if(m_Mean)
       {
-        float32 val = StaticicsCalculations::findMean(m_FeatureDataMap[i]);
+        float32 val = StaticicsCalculations::findMean(featureData);
         array3->initializeTuple(i, val);
       }
       if(m_Median)
       {
-        float32 val = StaticicsCalculations::findMedian(m_FeatureDataMap[i]);
+        float32 val = StaticicsCalculations::findMedian(featureData);
         array4->initializeTuple(i, val);
       }
       if(m_StdDeviation)
       {
-        float32 val = StaticicsCalculations::findStdDeviation(m_FeatureDataMap[i]);
+        float32 val = StaticicsCalculations::findStdDeviation(featureData);
         array5->initializeTuple(i, val);
       }
       if(m_Summation)
       {
-        float32 val = StaticicsCalculations::findSummation(m_FeatureDataMap[i]);
+        float32 val = StaticicsCalculations::findSummation(featureData);
         array6->initializeTuple(i, val);
       }
       if(m_Histogram)
@@ -121,7 +130,7 @@ public:
         auto* arr7DataStore = array7->getDataStore();
         if(arr7DataStore != nullptr)
         {
-          std::vector<float32> vals = StaticicsCalculations::findHistogram(m_FeatureDataMap[i], m_HistMin, m_HistMax, m_HistFullRange, m_NumBins);
+          std::vector<float32> vals = StaticicsCalculations::findHistogram(featureData, m_HistMin, m_HistMax, m_HistFullRange, m_NumBins);
           arr7DataStore->setTuple(i, vals);
         }
       }
@@ -134,7 +143,8 @@ public:
   }
 
 private:
-  std::unordered_map<int32, std::list<T>>& m_FeatureDataMap;
+  const DataArray<T>& m_Source;
+  const SegmentedReduction::FeatureGrouping& m_FeatureGrouping;
   bool m_Length;
   bool m_Min;
   bool m_Max;
@@ -152,12 +162,13 @@ private:
 
 // -----------------------------------------------------------------------------
 template <typename T>
-void findStatisticsByIndexImpl(std::unordered_map<int32, std::list<T>>& featureDataMap, std::vector<IDataArray*>& arrays, const FindArrayStatisticsInputValues* inputValues, int32 numFeatures)
+void findStatisticsByIndexImpl(const DataArray<T>& source, const SegmentedReduction::FeatureGrouping& featureGrouping, std::vector<IDataArray*>& arrays,
+                               const FindArrayStatisticsInputValues* inputValues, int32 numFeatures)
 {
   // Allow data-based parallelization
   ParallelDataAlgorithm dataAlg;
   dataAlg.setRange(0, numFeatures);
-  dataAlg.execute(FindArrayStatisticsByIndexImpl<T>(featureDataMap, inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMedian,
+  dataAlg.execute(FindArrayStatisticsByIndexImpl<T>(source, featureGrouping, inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMedian,
                                                     inputValues->FindStdDeviation, inputValues->FindSummation, arrays, inputValues->FindHistogram, inputValues->MinRange, inputValues->MaxRange,
                                                     inputValues->UseFullRange, inputValues->NumBins));
 }
@@ -260,25 +271,11 @@ void findStatistics(const DataArray<T>& source, const Int32Array* featureIds, co
   usize numTuples = source.getNumberOfTuples();
   if(inputValues->ComputeByIndex)
   {
-    std::unordered_map<int32, std::list<T>> featureValueMap;
-
-    for(size_t i = 0; i < numTuples; i++)
-    {
-      if(inputValues->UseMask)
-      {
-        if(mask->isTrue(i))
-        {
-          featureValueMap[featureIds->at(i)].push_back(source[i]);
-        }
-      }
-      else
-      {
-        featureValueMap[featureIds->at(i)].push_back(source[i]);
-      }
-    }
+    // Group the (masked) cells by feature/ensemble id so each feature can be processed independently
+    SegmentedReduction::FeatureGrouping featureGrouping(*featureIds, static_cast<usize>(numFeatures), inputValues->UseMask ? mask.get() : nullptr);
 
     // compute the statistics by feature/ensemble id
-    findStatisticsByIndexImpl<T>(featureValueMap, arrays, inputValues, numFeatures);
+    findStatisticsByIndexImpl<T>(source, featureGrouping, arrays, inputValues, numFeatures);
   }
   else
   {
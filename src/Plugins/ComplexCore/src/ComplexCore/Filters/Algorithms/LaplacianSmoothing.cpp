@@ -6,9 +6,124 @@
 #include "complex/DataStructure/Geometry/AbstractGeometry.hpp"
 #include "complex/DataStructure/Geometry/AbstractGeometry2D.hpp"
 #include "complex/DataStructure/Geometry/TriangleGeom.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
 
 using namespace complex;
 
+namespace
+{
+// Number of vertices each task of a smoothing pass works on
+constexpr usize k_ChunkSize = 16384;
+
+using MeshIndexType = AbstractGeometry::MeshIndexType;
+
+// Vertex coordinates stored as one array per axis
+using CoordinateArrays = std::array<std::vector<float32>, 3>;
+
+/**
+ * @brief Vertex to vertex adjacency in CSR form. The neighbors of vertex i are stored at
+ * positions [offsets[i], offsets[i + 1]) in the same order as the shared edge list.
+ */
+struct VertexAdjacency
+{
+  std::vector<usize> offsets;
+  std::vector<MeshIndexType> neighbors;
+};
+
+VertexAdjacency BuildVertexAdjacency(const AbstractGeometry::SharedEdgeList& edges, usize numVertices)
+{
+  const usize numEdges = edges.getNumberOfTuples();
+
+  VertexAdjacency adjacency;
+  adjacency.offsets.assign(numVertices + 1, 0);
+  for(usize i = 0; i < numEdges; i++)
+  {
+    adjacency.offsets[edges[2 * i] + 1]++;
+    adjacency.offsets[edges[2 * i + 1] + 1]++;
+  }
+  for(usize i = 0; i < numVertices; i++)
+  {
+    adjacency.offsets[i + 1] += adjacency.offsets[i];
+  }
+
+  adjacency.neighbors.resize(adjacency.offsets[numVertices]);
+  std::vector<usize> insertPositions(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+  for(usize i = 0; i < numEdges; i++)
+  {
+    const MeshIndexType in1 = edges[2 * i];
+    const MeshIndexType in2 = edges[2 * i + 1];
+    adjacency.neighbors[insertPositions[in1]++] = in2;
+    adjacency.neighbors[insertPositions[in2]++] = in1;
+  }
+  return adjacency;
+}
+
+/**
+ * @brief Moves every vertex towards the average of its neighbors in source by its lambda scaled
+ * by factor and writes the new position to destination. Each vertex only reads source, so all
+ * vertices are updated at once (Jacobi iteration). Returns the largest squared distance between
+ * a new position and the position of the same vertex in reference, which may be destination.
+ * @param adjacency
+ * @param lambdas
+ * @param factor
+ * @param source
+ * @param reference
+ * @param destination
+ * @return float32
+ */
+float32 SmoothPass(const VertexAdjacency& adjacency, const std::vector<float32>& lambdas, float32 factor, const CoordinateArrays& source, const CoordinateArrays& reference,
+                   CoordinateArrays& destination)
+{
+  const usize numVertices = lambdas.size();
+  const usize numChunks = (numVertices + k_ChunkSize - 1) / k_ChunkSize;
+  std::vector<float32> chunkMaximums(numChunks, 0.0f);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      const usize end = std::min(numVertices, (chunk + 1) * k_ChunkSize);
+      float32 maximum = 0.0f;
+      for(usize i = chunk * k_ChunkSize; i < end; i++)
+      {
+        const usize firstNeighbor = adjacency.offsets[i];
+        const usize lastNeighbor = adjacency.offsets[i + 1];
+        const float32 lambda = lambdas[i] * factor;
+
+        float32 distanceSquared = 0.0f;
+        for(usize dim = 0; dim < 3; dim++)
+        {
+          const std::vector<float32>& axis = source[dim];
+          float32 position = axis[i];
+          // Vertices without any edge stay where they are
+          if(firstNeighbor != lastNeighbor)
+          {
+            float64 delta = 0.0;
+            for(usize n = firstNeighbor; n < lastNeighbor; n++)
+            {
+              delta += static_cast<float64>(axis[adjacency.neighbors[n]] - position);
+            }
+            position += lambda * (delta / static_cast<float64>(lastNeighbor - firstNeighbor));
+          }
+          const float32 displacement = position - reference[dim][i];
+          distanceSquared += displacement * displacement;
+          destination[dim][i] = position;
+        }
+        maximum = std::max(maximum, distanceSquared);
+      }
+      chunkMaximums[chunk] = maximum;
+    }
+  });
+
+  return chunkMaximums.empty() ? 0.0f : *std::max_element(chunkMaximums.begin(), chunkMaximums.end());
+}
+} // namespace
+
 LaplacianSmoothing::LaplacianSmoothing(DataStructure& dataStructure, LaplacianSmoothingInputValues* inputValues, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
 : m_DataStructure(dataStructure)
 , m_InputValues(inputValues)
@@ -30,16 +145,18 @@ Result<> LaplacianSmoothing::operator()()
 Result<> LaplacianSmoothing::edgeBasedSmoothing()
 {
   int32_t err = 0;
-  //  DataContainer::Pointer sm = getDataContainerArray()->getDataContainer(getSurfaceDataContainerName());
-  //  IGeometry2D::Pointer surfaceMesh = sm->getGeometryAs<IGeometry2D>();
 
   TriangleGeom& surfaceMesh = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->pTriangleGeometryDataPath);
 
   Float32Array& verts = *(surfaceMesh.getVertices());
-  AbstractGeometry::MeshIndexType nvert = surfaceMesh.getNumberOfVertices();
+  const usize nvert = surfaceMesh.getNumberOfVertices();
 
   // Generate the Lambda Array
   std::vector<float> lambdas = generateLambdaArray();
+  if(lambdas.size() != nvert)
+  {
+    return MakeErrorResult(-561, fmt::format("The Node Type array has {} tuples but the Geometry has {} vertices", lambdas.size(), nvert));
+  }
 
   //  Generate the Unique Edges
   if(nullptr == surfaceMesh.getEdges())
@@ -51,13 +168,31 @@ Result<> LaplacianSmoothing::edgeBasedSmoothing()
     return MakeErrorResult(-560, "Error retrieving the shared edge list");
   }
 
-  AbstractGeometry::SharedEdgeList& uedges = *(surfaceMesh.getEdges());
-  AbstractGeometry::MeshIndexType nedges = uedges.getNumberOfTuples();
+  // The connectivity does not change while smoothing so the neighbors of each vertex are only gathered once
+  const VertexAdjacency adjacency = BuildVertexAdjacency(*(surfaceMesh.getEdges()), nvert);
 
-  std::vector<int32_t> numConnections(nvert, 0);
+  // Smooth a copy of the coordinates with one array per axis. The second copy receives the
+  // result of a pass while the first one is being read.
+  CoordinateArrays current;
+  CoordinateArrays smoothed;
+  for(usize dim = 0; dim < 3; dim++)
+  {
+    current[dim].resize(nvert);
+    smoothed[dim].resize(nvert);
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, nvert);
+  dataAlg.execute([&current, &verts](const ComplexRange& range) {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      for(usize dim = 0; dim < 3; dim++)
+      {
+        current[dim][i] = verts[3 * i + dim];
+      }
+    }
+  });
 
-  std::vector<double> deltaArray(nvert * 3);
-  double dlta = 0.0;
+  const float32 toleranceSquared = m_InputValues->pConvergenceTolerance * m_InputValues->pConvergenceTolerance;
 
   for(int32_t q = 0; q < m_InputValues->pIterationSteps; q++)
   {
@@ -66,88 +201,39 @@ Result<> LaplacianSmoothing::edgeBasedSmoothing()
       return {};
     }
     m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Iteration {} of {}", q, m_InputValues->pIterationSteps));
-    // Compute the Deltas for each point
-    for(AbstractGeometry::MeshIndexType i = 0; i < nedges; i++)
-    {
-      AbstractGeometry::MeshIndexType in1 = uedges[2 * i];     // row of the first vertex
-      AbstractGeometry::MeshIndexType in2 = uedges[2 * i + 1]; // row the second vertex
-
-      for(AbstractGeometry::MeshIndexType j = 0; j < 3; j++)
-      {
-#if 0
-        Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-        Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-#endif
-        dlta = static_cast<double>(verts[3 * in2 + j] - verts[3 * in1 + j]);
-        deltaArray[3 * in1 + j] += dlta;
-        deltaArray[3 * in2 + j] += -1.0 * dlta;
-      }
-      numConnections[in1] += 1;
-      numConnections[in2] += 1;
-    }
 
-    // Move each point
-    for(AbstractGeometry::MeshIndexType i = 0; i < nvert; i++)
-    {
-      for(AbstractGeometry::MeshIndexType j = 0; j < 3; j++)
-      {
-        AbstractGeometry::MeshIndexType in0 = 3 * i + j;
-        dlta = deltaArray[in0] / numConnections[i];
-
-        float ll = lambdas[i];
-        verts[3 * i + j] += ll * dlta;
-        deltaArray[in0] = 0.0; // reset for next iteration
-      }
-      numConnections[i] = 0; // reset for next iteration
-    }
+    float32 maxDisplacementSquared = SmoothPass(adjacency, lambdas, 1.0f, current, current, smoothed);
 
     // Now optionally apply a negative lambda based on the mu Factor value.
     // This is from Taubin's paper on smoothing without shrinkage. This effectively
-    // runs a low pass filter on the data
+    // runs a low pass filter on the data. The pass reads the smoothed positions and writes
+    // straight back over the positions from the start of the iteration.
     if(m_InputValues->pUseTaubinSmoothing)
     {
+      maxDisplacementSquared = SmoothPass(adjacency, lambdas, m_InputValues->pMuFactor, smoothed, current, current);
+    }
+    else
+    {
+      std::swap(current, smoothed);
+    }
 
-      if(m_ShouldCancel)
-      {
-        return {};
-      }
-      m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Iteration {} of {}", q, m_InputValues->pIterationSteps));
-      // Compute the Delta's
-      for(AbstractGeometry::MeshIndexType i = 0; i < nedges; i++)
-      {
-        AbstractGeometry::MeshIndexType in1 = uedges[2 * i];     // row of the first vertex
-        AbstractGeometry::MeshIndexType in2 = uedges[2 * i + 1]; // row the second vertex
-
-        for(int32_t j = 0; j < 3; j++)
-        {
-#if 0
-          Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-          Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-#endif
-          dlta = verts[3 * in2 + j] - verts[3 * in1 + j];
-          deltaArray[3 * in1 + j] += dlta;
-          deltaArray[3 * in2 + j] += -1.0 * dlta;
-        }
-        numConnections[in1] += 1;
-        numConnections[in2] += 1;
-      }
+    if(m_InputValues->pUseConvergenceTolerance && maxDisplacementSquared < toleranceSquared)
+    {
+      m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Converged after {} of {} iterations. Largest vertex displacement: {}", q + 1, m_InputValues->pIterationSteps,
+                                                                 std::sqrt(maxDisplacementSquared)));
+      break;
+    }
+  }
 
-      // MOve the points
-      for(AbstractGeometry::MeshIndexType i = 0; i < nvert; i++)
+  dataAlg.execute([&current, &verts](const ComplexRange& range) {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      for(usize dim = 0; dim < 3; dim++)
       {
-        for(AbstractGeometry::MeshIndexType j = 0; j < 3; j++)
-        {
-          AbstractGeometry::MeshIndexType in0 = 3 * i + j;
-          dlta = deltaArray[in0] / numConnections[i];
-
-          float ll = lambdas[i] * m_InputValues->pMuFactor;
-          verts[3 * i + j] += ll * dlta;
-          deltaArray[in0] = 0.0; // reset for next iteration
-        }
-        numConnections[i] = 0; // reset for next iteration
+        verts[3 * i + dim] = current[dim][i];
       }
     }
-  }
+  });
 
   return {};
 }
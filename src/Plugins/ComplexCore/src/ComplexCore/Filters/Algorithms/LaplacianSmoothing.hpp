@@ -23,6 +23,8 @@ struct COMPLEXCORE_EXPORT LaplacianSmoothingInputValues
   float32 pSurfacePointLambda;
   float32 pSurfaceTripleLineLambda;
   float32 pSurfaceQuadPointLambda;
+  bool pUseConvergenceTolerance;
+  float32 pConvergenceTolerance;
   DataPath pSurfaceMeshNodeTypeArrayPath;
 };
 
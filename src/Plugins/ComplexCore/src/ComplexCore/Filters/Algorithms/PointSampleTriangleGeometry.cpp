@@ -36,12 +36,203 @@
 
 #include "TupleTransfer.hpp"
 #include "complex/DataStructure/Geometry/TriangleGeom.hpp"
+#include "complex/Utilities/CounterBasedRandom.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
 
-#include <cassert>
-#include <cstring>
+#include <chrono>
+#include <cmath>
 
 using namespace complex;
 
+namespace
+{
+// Samples are generated in blocks of this size. The triangles chosen for a block
+// are transferred to the vertex data in one call per array.
+constexpr usize k_BlockSize = 4096;
+
+// Independent random streams drawn for every sample index
+constexpr uint64 k_TriangleStream = 0;
+constexpr uint64 k_BarycentricStream = 1;
+
+/**
+ * @brief Walker alias table built with Vose's method. Drawing an entry costs one uniform
+ * column and one biased coin flip regardless of the number of entries.
+ */
+class AliasTable
+{
+public:
+  /**
+   * @brief Builds the table for the given non-negative weights. The weights must have a positive sum.
+   * @param weights
+   * @param totalWeight
+   */
+  AliasTable(const std::vector<float64>& weights, float64 totalWeight)
+  : m_Probabilities(weights.size(), 0.0)
+  , m_Aliases(weights.size(), 0)
+  {
+    const usize count = weights.size();
+    std::vector<float64> scaled(count);
+    std::vector<usize> small;
+    std::vector<usize> large;
+    usize heaviest = 0;
+    for(usize i = 0; i < count; i++)
+    {
+      scaled[i] = weights[i] * static_cast<float64>(count) / totalWeight;
+      if(scaled[i] < 1.0)
+      {
+        small.push_back(i);
+      }
+      else
+      {
+        large.push_back(i);
+      }
+      if(weights[i] > weights[heaviest])
+      {
+        heaviest = i;
+      }
+    }
+
+    while(!small.empty() && !large.empty())
+    {
+      const usize lighter = small.back();
+      small.pop_back();
+      const usize heavier = large.back();
+      large.pop_back();
+
+      m_Probabilities[lighter] = scaled[lighter];
+      m_Aliases[lighter] = heavier;
+      scaled[heavier] = (scaled[heavier] + scaled[lighter]) - 1.0;
+      if(scaled[heavier] < 1.0)
+      {
+        small.push_back(heavier);
+      }
+      else
+      {
+        large.push_back(heavier);
+      }
+    }
+
+    // Whatever is left over is only there because of rounding and keeps its own column.
+    // Entries without weight must never be drawn so they point at the heaviest entry.
+    for(usize index : large)
+    {
+      m_Probabilities[index] = 1.0;
+      m_Aliases[index] = index;
+    }
+    for(usize index : small)
+    {
+      m_Probabilities[index] = weights[index] > 0.0 ? 1.0 : 0.0;
+      m_Aliases[index] = weights[index] > 0.0 ? index : heaviest;
+    }
+  }
+
+  usize size() const
+  {
+    return m_Probabilities.size();
+  }
+
+  /**
+   * @brief Returns the entry for a uniformly chosen column and a uniform value in [0, 1).
+   * @param column
+   * @param coin
+   * @return usize
+   */
+  usize sample(usize column, float64 coin) const
+  {
+    return coin < m_Probabilities[column] ? column : m_Aliases[column];
+  }
+
+private:
+  std::vector<float64> m_Probabilities;
+  std::vector<usize> m_Aliases;
+};
+
+/**
+ * @brief Generates the samples of a range of blocks. Every random number is derived from the
+ * sample index so the output does not depend on how the blocks are split between threads.
+ */
+class SampleTrianglesImpl
+{
+public:
+  SampleTrianglesImpl(const AliasTable& aliasTable, const Philox4x32& generator, const TriangleGeom::SharedTriList& triangles, const AbstractGeometry::SharedVertexList& triangleVertices,
+                      AbstractGeometry::SharedVertexList& sampledVertices, const std::vector<std::shared_ptr<AbstractTupleTransfer>>& tupleTransferFunctions, usize numSamples,
+                      const std::atomic_bool& shouldCancel)
+  : m_AliasTable(aliasTable)
+  , m_Generator(generator)
+  , m_Triangles(triangles)
+  , m_TriangleVertices(triangleVertices)
+  , m_SampledVertices(sampledVertices)
+  , m_TupleTransferFunctions(tupleTransferFunctions)
+  , m_NumSamples(numSamples)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void generate(usize startBlock, usize endBlock) const
+  {
+    std::vector<usize> sampledTriangles;
+    sampledTriangles.reserve(k_BlockSize);
+
+    for(usize block = startBlock; block < endBlock; block++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+
+      const usize begin = block * k_BlockSize;
+      const usize end = std::min(begin + k_BlockSize, m_NumSamples);
+      sampledTriangles.clear();
+      for(usize sample = begin; sample < end; sample++)
+      {
+        const Philox4x32::ResultType triangleWords = m_Generator(sample, k_TriangleStream);
+        const usize column = static_cast<usize>(Philox4x32::ToRange(triangleWords[0], triangleWords[1], m_AliasTable.size()));
+        const usize triangle = m_AliasTable.sample(column, Philox4x32::ToUnitFloat64(triangleWords[2], triangleWords[3]));
+        sampledTriangles.push_back(triangle);
+
+        const Philox4x32::ResultType barycentricWords = m_Generator(sample, k_BarycentricStream);
+        const float32 r1 = Philox4x32::ToUnitFloat32(barycentricWords[0]);
+        const float32 r2 = Philox4x32::ToUnitFloat32(barycentricWords[1]);
+
+        const float32 sqrtR1 = std::sqrt(r1);
+        const float32 prefactorA = 1.0f - sqrtR1;
+        const float32 prefactorB = sqrtR1 * (1.0f - r2);
+        const float32 prefactorC = sqrtR1 * r2;
+
+        const usize a = m_Triangles[triangle * 3] * 3;
+        const usize b = m_Triangles[triangle * 3 + 1] * 3;
+        const usize c = m_Triangles[triangle * 3 + 2] * 3;
+        for(usize dim = 0; dim < 3; dim++)
+        {
+          m_SampledVertices[sample * 3 + dim] = (prefactorA * m_TriangleVertices[a + dim]) + (prefactorB * m_TriangleVertices[b + dim]) + (prefactorC * m_TriangleVertices[c + dim]);
+        }
+      }
+
+      // Transfer the face data of the whole block to the vertex data
+      for(const auto& tupleTransfer : m_TupleTransferFunctions)
+      {
+        tupleTransfer->transferTuples(sampledTriangles, begin);
+      }
+    }
+  }
+
+  void operator()(const ComplexRange& range) const
+  {
+    generate(range.min(), range.max());
+  }
+
+private:
+  const AliasTable& m_AliasTable;
+  const Philox4x32& m_Generator;
+  const TriangleGeom::SharedTriList& m_Triangles;
+  const AbstractGeometry::SharedVertexList& m_TriangleVertices;
+  AbstractGeometry::SharedVertexList& m_SampledVertices;
+  const std::vector<std::shared_ptr<AbstractTupleTransfer>>& m_TupleTransferFunctions;
+  usize m_NumSamples = 0;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 PointSampleTriangleGeometry::PointSampleTriangleGeometry(DataStructure& dataStructure, PointSampleTriangleGeometryInputs* inputValues, const std::atomic_bool& shouldCancel,
                                                          const IFilter::MessageHandler& mesgHandler)
@@ -57,47 +248,16 @@ PointSampleTriangleGeometry::~PointSampleTriangleGeometry() noexcept = default;
 
 Result<> PointSampleTriangleGeometry::operator()()
 {
-
   DataPath triangleGeometryDataPath = m_Inputs->pTriangleGeometry;
   TriangleGeom& triangle = m_DataStructure.getDataRefAs<TriangleGeom>(triangleGeometryDataPath);
-  int64_t numTris = static_cast<int64_t>(triangle.getNumberOfFaces());
+  const usize numTris = triangle.getNumberOfFaces();
+  const usize numSamples = static_cast<usize>(m_Inputs->pNumberOfSamples);
 
   VertexGeom& vertex = m_DataStructure.getDataRefAs<VertexGeom>(m_Inputs->pVertexGeometryPath);
-  vertex.resizeVertexList(m_Inputs->pNumberOfSamples);
-
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  std::mt19937_64 generator(seed);
-  std::uniform_real_distribution<> distribution(0.0f, 1.0f);
-
-  // Create the Triangle Ids vector and fill it from zero to size-1 incrementally
-  std::vector<int64_t> triangleIds(numTris);
-  std::iota(std::begin(triangleIds), std::end(triangleIds), 0);
-
-  // Initialize the Triangle Weights with the Triangle Area Values
-  Float64Array& faceAreas = m_DataStructure.getDataRefAs<Float64Array>(m_Inputs->pTriangleAreasArrayPath);
-  std::vector<double> triangleWeights(numTris);
-  for(size_t i = 0; i < triangleWeights.size(); i++)
-  {
-    triangleWeights[i] = faceAreas[i];
-  }
-
-  // VS2013 does not implement the iterator contructor for std::discrete_distribution<>, which
-  // really is a massively idiotic oversight; hack the equivalent using the unary_op constructor
-  std::discrete_distribution<size_t> triangle_distribution(triangleWeights.size(), -0.5, -0.5 + static_cast<double>(triangleWeights.size()),
-                                                           [&triangleWeights](double index) { return triangleWeights[static_cast<size_t>(index)]; });
-
-  int64_t progIncrement = m_Inputs->pNumberOfSamples / 100;
-  int64_t prog = 1;
-  int64_t progressInt = 0;
-  int64_t counter = 0;
-
-  Point3Df a(0.0F, 0.0F, 0.0F);
-  Point3Df b(0.0F, 0.0F, 0.0F);
-  Point3Df c(0.0F, 0.0F, 0.0F);
+  vertex.resizeVertexList(numSamples);
 
   // We get the pointer to the Array instead of a reference because it might not have been set because
-  // the bool "use_mask" might have been false, but we do NOT want to try to get the array
-  // 'on demand' in the loop. That is a BAD idea as is it really slow to do that. (10x slower).
+  // the bool "use_mask" might have been false.
   DataObject* maskArrayDataObject = m_DataStructure.getData(m_Inputs->pMaskArrayPath);
   BoolArray* maskArray = nullptr;
   if(nullptr != maskArrayDataObject && m_Inputs->pUseMask)
@@ -108,8 +268,25 @@ Result<> PointSampleTriangleGeometry::operator()()
   {
     return MakeErrorResult(-502, "Use Mask is true but the MaskArray could not be extracted from the DataStructure. Please ensure the path is correct and that the selected DataArray is of type bool");
   }
-  // Get a reference to the Vertex List
-  AbstractGeometry::SharedVertexList* vertices = vertex.getVertices();
+
+  // Initialize the Triangle Weights with the Triangle Area Values. Masked out triangles get
+  // no weight so they can never be drawn.
+  Float64Array& faceAreas = m_DataStructure.getDataRefAs<Float64Array>(m_Inputs->pTriangleAreasArrayPath);
+  std::vector<float64> triangleWeights(numTris, 0.0);
+  float64 totalWeight = 0.0;
+  for(usize i = 0; i < numTris; i++)
+  {
+    if(maskArray != nullptr && !(*maskArray)[i])
+    {
+      continue;
+    }
+    triangleWeights[i] = faceAreas[i] > 0.0 ? faceAreas[i] : 0.0;
+    totalWeight += triangleWeights[i];
+  }
+  if(!(totalWeight > 0.0))
+  {
+    return MakeErrorResult(-503, "There are no Triangles with a positive area to sample. Please check the Face Areas and, if Use Mask is true, the Mask.");
+  }
 
   // Create a vector of TupleTransferFunctions for each of the Triangle Face to Vertex Data Arrays
   std::vector<std::shared_ptr<AbstractTupleTransfer>> tupleTransferFunctions;
@@ -118,67 +295,20 @@ Result<> PointSampleTriangleGeometry::operator()()
     ::AddTupleTransferInstance(m_DataStructure, m_Inputs->pSelectedDataArrayPaths[i], m_Inputs->pCreatedDataArrayPaths[i], tupleTransferFunctions);
   }
 
-  for(int64_t curVertex = 0; curVertex < m_Inputs->pNumberOfSamples; curVertex++)
+  uint64 seed = m_Inputs->pSeedValue;
+  if(!m_Inputs->pUseSeed)
   {
-    if(m_ShouldCancel)
-    {
-      return {};
-    }
-
-    int64_t randomTri = 0;
-
-    if(m_Inputs->pUseMask)
-    {
-      while(true)
-      {
-        randomTri = static_cast<int64_t>(triangle_distribution(generator));
-        if(randomTri >= numTris || randomTri < 0)
-        {
-          throw std::out_of_range(fmt::format("Generated Random Triangle Index '{}' was out of range. '0->{}'", randomTri, numTris));
-        }
-        if((*maskArray)[randomTri])
-        {
-          break;
-        }
-      }
-    }
-    else
-    {
-      randomTri = static_cast<int64_t>(triangle_distribution(generator));
-      if(randomTri >= numTris || randomTri < 0)
-      {
-        throw std::out_of_range(fmt::format("Generated Random Triangle Index '{}' was out of range. '0->{}'", randomTri, numTris));
-      }
-    }
-
-    triangle.getVertexCoordsForFace(randomTri, a, b, c);
-
-    float r1 = static_cast<float>(distribution(generator));
-    float r2 = static_cast<float>(distribution(generator));
-
-    float prefactorA = 1.0f - sqrtf(r1);
-    float prefactorB = sqrtf(r1) * (1 - r2);
-    float prefactorC = sqrtf(r1) * r2;
-
-    (*vertices)[curVertex * 3 + 0] = (prefactorA * a[0]) + (prefactorB * b[0]) + (prefactorC * c[0]);
-    (*vertices)[curVertex * 3 + 1] = (prefactorA * a[1]) + (prefactorB * b[1]) + (prefactorC * c[1]);
-    (*vertices)[curVertex * 3 + 2] = (prefactorA * a[2]) + (prefactorB * b[2]) + (prefactorC * c[2]);
+    seed = static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+  }
+  m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Sampling {} points from {} Triangles using seed {}", numSamples, numTris, seed));
 
-    // Transfer the face data to the vertex data
-    for(size_t dataVectorIndex = 0; dataVectorIndex < m_Inputs->pSelectedDataArrayPaths.size(); dataVectorIndex++)
-    {
-      tupleTransferFunctions[dataVectorIndex]->transfer(randomTri, curVertex);
-    }
+  const AliasTable aliasTable(triangleWeights, totalWeight);
+  const Philox4x32 generator(seed);
+  SampleTrianglesImpl sampleTriangles(aliasTable, generator, *triangle.getFaces(), *triangle.getVertices(), *vertex.getVertices(), tupleTransferFunctions, numSamples, m_ShouldCancel);
 
-    if(counter > prog)
-    {
-      progressInt = static_cast<int64_t>((static_cast<float>(counter) / static_cast<float>(m_Inputs->pNumberOfSamples)) * 100.0f);
-      std::string ss = fmt::format("Sampling Triangles || {}% Completed", progressInt);
-      m_MessageHandler(IFilter::Message::Type::Info, ss);
-      prog = prog + progIncrement;
-    }
-    counter++;
-  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, (numSamples + k_BlockSize - 1) / k_BlockSize);
+  dataAlg.execute(sampleTriangles);
 
   return {};
 }
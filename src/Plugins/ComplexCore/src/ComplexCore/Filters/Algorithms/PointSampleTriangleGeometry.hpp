@@ -52,7 +52,6 @@
 #include <array>
 #include <filesystem>
 #include <memory>
-#include <random>
 #include <string>
 
 namespace complex
@@ -62,6 +61,8 @@ struct COMPLEXCORE_EXPORT PointSampleTriangleGeometryInputs
 {
   int32 pNumberOfSamples;
   bool pUseMask;
+  bool pUseSeed;
+  uint64 pSeedValue;
   DataPath pTriangleGeometry;
   DataPath pTriangleAreasArrayPath;
   DataPath pMaskArrayPath;
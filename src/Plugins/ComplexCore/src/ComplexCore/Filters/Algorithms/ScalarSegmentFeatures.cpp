@@ -206,14 +206,6 @@ Result<> ScalarSegmentFeatures::operator()()
     m_CompareFunctor = std::shared_ptr<SegmentFeatures::CompareFunctor>(new SegmentFeatures::CompareFunctor()); // The default CompareFunctor which ALWAYS returns false for the comparison
   }
 
-  // Generate the random voxel indices that will be used for the seed points to start a new grain growth/agglomeration
-  auto totalPoints = inputDataArray->getNumberOfTuples();
-
-  const int64 rangeMin = 0;
-  const int64 rangeMax = totalPoints - 1;
-  Int64Distribution distribution;
-  initializeVoxelSeedGenerator(distribution, rangeMin, rangeMax);
-
   //  // Add compare function to arguments
   //  Arguments newArgs = args;
   //  newArgs.insert(k_CompareFunctKey, compare.get());
@@ -230,8 +222,13 @@ Result<> ScalarSegmentFeatures::operator()()
   // By default we randomize grains
   if(m_InputValues->pShouldRandomizeFeatureIds)
   {
-    totalPoints = gridGeom->getNumberOfElements();
-    randomizeFeatureIds(m_FeatureIdsArray, totalPoints, totalFeatures, distribution);
+    uint64 seed = m_InputValues->pSeedValue;
+    if(!m_InputValues->pUseSeed)
+    {
+      seed = static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+    auto totalPoints = gridGeom->getNumberOfElements();
+    randomizeFeatureIds(m_FeatureIdsArray, totalPoints, totalFeatures, seed);
   }
 
   return {};
@@ -9,7 +9,6 @@
 #include "complex/Filter/IFilter.hpp"
 #include "complex/Utilities/SegmentFeatures.hpp"
 
-#include <random>
 #include <vector>
 
 namespace complex
@@ -20,6 +19,8 @@ struct COMPLEXCORE_EXPORT ScalarSegmentFeaturesInputValues
   DataPath pInputDataPath;
   int pScalarTolerance = 0;
   bool pShouldRandomizeFeatureIds = false;
+  bool pUseSeed = false;
+  uint64 pSeedValue = 0;
   DataPath pActiveArrayPath;
   DataPath pFeatureIdsPath;
   bool pUseGoodVoxels = false;
@@ -33,8 +34,6 @@ struct COMPLEXCORE_EXPORT ScalarSegmentFeaturesInputValues
 class COMPLEXCORE_EXPORT ScalarSegmentFeatures : public SegmentFeatures
 {
 public:
-  using SeedGenerator = std::mt19937_64;
-  using Int64Distribution = std::uniform_int_distribution<int64>;
   using FeatureIdsArrayType = Int32Array;
   using GoodVoxelsArrayType = BoolArray;
 
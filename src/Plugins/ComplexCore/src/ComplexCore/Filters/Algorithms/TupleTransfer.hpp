@@ -6,6 +6,9 @@
 #include "complex/DataStructure/DataPath.hpp"
 #include "complex/DataStructure/DataStructure.hpp"
 #include "complex/Utilities/TemplateHelpers.hpp"
+#include "complex/Utilities/TupleCopier.hpp"
+
+#include <nonstd/span.hpp>
 
 namespace complex
 {
@@ -35,6 +38,15 @@ public:
 
   virtual void transfer(size_t faceIndex, size_t firstcIndex) = 0;
 
+  /**
+   * @brief Copies the source tuples listed in sourceTupleIndices into consecutive destination
+   * tuples starting at destinationTupleOffset. Calls that write disjoint destination tuples
+   * may run concurrently.
+   * @param sourceTupleIndices
+   * @param destinationTupleOffset
+   */
+  virtual void transferTuples(nonstd::span<const usize> sourceTupleIndices, usize destinationTupleOffset) = 0;
+
 protected:
   AbstractTupleTransfer() = default;
 
@@ -105,6 +117,13 @@ public:
     }
   }
 
+  void transferTuples(nonstd::span<const usize> sourceTupleIndices, usize destinationTupleOffset) override
+  {
+    TupleCopier tupleCopier;
+    tupleCopier.addArrays(*m_CellPtr, *m_FacePtr);
+    tupleCopier.gather(sourceTupleIndices, destinationTupleOffset);
+  }
+
 private:
   DataArrayType* m_CellPtr = nullptr;
   DataArrayType* m_FacePtr = nullptr;
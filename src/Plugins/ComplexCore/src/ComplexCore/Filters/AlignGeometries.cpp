@@ -330,6 +330,8 @@ void translateGeometry(complex::AbstractGeometry& geometry, const complex::Float
       vertices[3 * i + 1] += translation[1];
       vertices[3 * i + 2] += translation[2];
     }
+    vertex.deleteKdTree();
+    vertex.deleteVertexBins();
     return;
   }
   case complex::AbstractGeometry::Type::Edge: {
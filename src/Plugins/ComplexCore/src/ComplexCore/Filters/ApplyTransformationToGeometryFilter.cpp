@@ -1,11 +1,20 @@
 #include "ApplyTransformationToGeometryFilter.hpp"
 
 #include "complex/Common/Numbers.hpp"
+#include "complex/DataStructure/DataArray.hpp"
 #include "complex/DataStructure/DataPath.hpp"
+#include "complex/DataStructure/Geometry/ImageGeom.hpp"
+#include "complex/Filter/Actions/CreateArrayAction.hpp"
+#include "complex/Filter/Actions/CreateDataGroupAction.hpp"
+#include "complex/Filter/Actions/CreateImageGeometryAction.hpp"
 #include "complex/Parameters/ArraySelectionParameter.hpp"
+#include "complex/Parameters/BoolParameter.hpp"
 #include "complex/Parameters/ChoicesParameter.hpp"
+#include "complex/Parameters/DataGroupCreationParameter.hpp"
 #include "complex/Parameters/DynamicTableParameter.hpp"
 #include "complex/Parameters/GeometrySelectionParameter.hpp"
+#include "complex/Parameters/MultiArraySelectionParameter.hpp"
+#include "complex/Parameters/StringParameter.hpp"
 #include "complex/Parameters/VectorParameter.hpp"
 
 #include "ComplexCore/Filters/Algorithms/ApplyTransformationToGeometry.hpp"
@@ -94,6 +103,77 @@ OutputType ax2om(const InputType& a)
 
 namespace complex
 {
+namespace
+{
+/**
+ * @brief Builds the 4x4 row major transformation matrix from the filter arguments. The
+ * transformation type must not be No_Transform.
+ * @param dataStructure
+ * @param filterArgs
+ * @return std::vector<float>
+ */
+std::vector<float> CreateTransformationMatrix(const DataStructure& dataStructure, const Arguments& filterArgs)
+{
+  auto transformationType = static_cast<TransformType>(filterArgs.value<ChoicesParameter::ValueType>(ApplyTransformationToGeometryFilter::k_TransformType_Key));
+
+  std::vector<float> transformationMatrix(16, 0.0F);
+  switch(transformationType)
+  {
+  case TransformType::No_Transform: {
+    break;
+  }
+  case TransformType::PreComputed_TransformMatrix: {
+    auto pComputedTransformationMatrixPath = filterArgs.value<DataPath>(ApplyTransformationToGeometryFilter::k_ComputedTransformationMatrix_Key);
+    const auto& precomputedTransformMatrix = dataStructure.getDataRefAs<Float32Array>(pComputedTransformationMatrixPath);
+    std::copy(precomputedTransformMatrix.begin(), precomputedTransformMatrix.end(), transformationMatrix.begin());
+    break;
+  }
+  case TransformType::ManualTransformMatrix: {
+    auto flattenedData = filterArgs.value<DynamicTableParameter::ValueType>(ApplyTransformationToGeometryFilter::k_ManualTransformationMatrix_Key).getFlattenedData();
+    transformationMatrix = std::vector<float>(flattenedData.begin(), flattenedData.end());
+    break;
+  }
+  case TransformType::Rotation: {
+    auto pRotationAxisAngleValue = filterArgs.value<VectorFloat32Parameter::ValueType>(ApplyTransformationToGeometryFilter::k_RotationAxisAngle_Key);
+    // Convert Degrees to Radians for the last element
+    pRotationAxisAngleValue[3] = pRotationAxisAngleValue[3] * static_cast<float>(complex::numbers::pi / 180.0f);
+    using OrientationF = std::vector<float>;
+    OrientationF om = OrientationTransformation::ax2om<OrientationF, OrientationF>(OrientationF(pRotationAxisAngleValue));
+
+    for(size_t i = 0; i < 3; i++)
+    {
+      transformationMatrix[4 * i + 0] = om[3 * i + 0];
+      transformationMatrix[4 * i + 1] = om[3 * i + 1];
+      transformationMatrix[4 * i + 2] = om[3 * i + 2];
+      transformationMatrix[4 * i + 3] = 0.0f;
+    }
+    transformationMatrix[4 * 3 + 3] = 1.0f;
+    break;
+  }
+  case TransformType::Translation: {
+    auto pTranslationValue = filterArgs.value<VectorFloat32Parameter::ValueType>(ApplyTransformationToGeometryFilter::k_Translation_Key);
+    transformationMatrix[4 * 0 + 0] = 1.0f;
+    transformationMatrix[4 * 1 + 1] = 1.0f;
+    transformationMatrix[4 * 2 + 2] = 1.0f;
+    transformationMatrix[4 * 0 + 3] = pTranslationValue[0];
+    transformationMatrix[4 * 1 + 3] = pTranslationValue[1];
+    transformationMatrix[4 * 2 + 3] = pTranslationValue[2];
+    transformationMatrix[4 * 3 + 3] = 1.0f;
+    break;
+  }
+  case TransformType::Scale: {
+    auto pScaleValue = filterArgs.value<VectorFloat32Parameter::ValueType>(ApplyTransformationToGeometryFilter::k_Scale_Key);
+    transformationMatrix[4 * 0 + 0] = pScaleValue[0];
+    transformationMatrix[4 * 1 + 1] = pScaleValue[1];
+    transformationMatrix[4 * 2 + 2] = pScaleValue[2];
+    transformationMatrix[4 * 3 + 3] = 1.0f;
+    break;
+  }
+  }
+  return transformationMatrix;
+}
+} // namespace
+
 //------------------------------------------------------------------------------
 std::string ApplyTransformationToGeometryFilter::name() const
 {
@@ -130,8 +210,9 @@ Parameters ApplyTransformationToGeometryFilter::parameters() const
   Parameters params;
   params.insert(
       std::make_unique<GeometrySelectionParameter>(k_GeometryToTransform_Key, "Geometry to Transform", "", DataPath{},
-                                                   GeometrySelectionParameter::AllowedTypes{AbstractGeometry::Type::Vertex, AbstractGeometry::Type::Edge, AbstractGeometry::Type::Triangle,
-                                                                                            AbstractGeometry::Type::Quad, AbstractGeometry::Type::Tetrahedral, AbstractGeometry::Type::Hexahedral}));
+                                                   GeometrySelectionParameter::AllowedTypes{AbstractGeometry::Type::Image, AbstractGeometry::Type::Vertex, AbstractGeometry::Type::Edge,
+                                                                                            AbstractGeometry::Type::Triangle, AbstractGeometry::Type::Quad, AbstractGeometry::Type::Tetrahedral,
+                                                                                            AbstractGeometry::Type::Hexahedral}));
   params.insertLinkableParameter(
       std::make_unique<ChoicesParameter>(k_TransformType_Key, "Transformation Type", "", 0,
                                          ChoicesParameter::Choices{"No Transformation", "Pre-Computed Transformation Matrix", "Manual Transformation Matrix", "Rotation", "Translation", "Scale"}));
@@ -152,12 +233,26 @@ Parameters ApplyTransformationToGeometryFilter::parameters() const
   params.insert(
       std::make_unique<VectorFloat32Parameter>(k_Scale_Key, "Scale Factor", "2 = 2x Size. 0.5 is half the size", std::vector<float>{1.0F, 1.0F, 1.0F}, std::vector<std::string>{"X", "Y", "Z"}));
 
+  // Image Geometries are resampled into a new Image Geometry
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_ResampleImageGeometry_Key, "Resample Image Geometry",
+                                                                 "Resample the cell arrays of an Image Geometry into a new Image Geometry", false));
+  params.insert(std::make_unique<ChoicesParameter>(k_InterpolationType_Key, "Interpolation Type", "How the cell data of an Image Geometry is resampled", 0,
+                                                   ChoicesParameter::Choices{"Nearest Neighbor", "Linear"}));
+  params.insert(std::make_unique<MultiArraySelectionParameter>(k_CellArrays_Key, "Cell Arrays", "Cell arrays of the Image Geometry to resample", std::vector<DataPath>{}, complex::GetAllDataTypes()));
+  params.insert(std::make_unique<DataGroupCreationParameter>(k_TransformedImageGeometry_Key, "Transformed Image Geometry", "DataPath to create the resampled Image Geometry at",
+                                                             DataPath({"Transformed Image Geometry"})));
+  params.insert(std::make_unique<StringParameter>(k_TransformedCellDataName_Key, "Transformed Cell Data", "Name of the group holding the resampled cell arrays", "Cell Data"));
+
   // Associate the Linkable Parameter(s) to the children parameters that they control
   params.linkParameters(k_TransformType_Key, k_ComputedTransformationMatrix_Key, std::make_any<ChoicesParameter::ValueType>(1));
   params.linkParameters(k_TransformType_Key, k_ManualTransformationMatrix_Key, std::make_any<ChoicesParameter::ValueType>(2));
   params.linkParameters(k_TransformType_Key, k_RotationAxisAngle_Key, std::make_any<ChoicesParameter::ValueType>(3));
   params.linkParameters(k_TransformType_Key, k_Translation_Key, std::make_any<ChoicesParameter::ValueType>(4));
   params.linkParameters(k_TransformType_Key, k_Scale_Key, std::make_any<ChoicesParameter::ValueType>(5));
+  params.linkParameters(k_ResampleImageGeometry_Key, k_InterpolationType_Key, true);
+  params.linkParameters(k_ResampleImageGeometry_Key, k_CellArrays_Key, true);
+  params.linkParameters(k_ResampleImageGeometry_Key, k_TransformedImageGeometry_Key, true);
+  params.linkParameters(k_ResampleImageGeometry_Key, k_TransformedCellDataName_Key, true);
 
   return params;
 }
@@ -240,6 +335,58 @@ IFilter::PreflightResult ApplyTransformationToGeometryFilter::preflightImpl(cons
     break;
   }
 
+  const auto* imageGeom = dataStructure.getDataAs<ImageGeom>(pGeometryToTransformValue);
+  if(imageGeom != nullptr && pTransformationType != TransformType::No_Transform)
+  {
+    if(!filterArgs.value<bool>(k_ResampleImageGeometry_Key))
+    {
+      return {MakeErrorResult<OutputActions>(-706, "An Image Geometry can not be transformed in place. Enable 'Resample Image Geometry' to resample it into a new Image Geometry")};
+    }
+    auto pCellArrayPaths = filterArgs.value<std::vector<DataPath>>(k_CellArrays_Key);
+    auto pTransformedImageGeometryPath = filterArgs.value<DataPath>(k_TransformedImageGeometry_Key);
+    auto pTransformedCellDataName = filterArgs.value<std::string>(k_TransformedCellDataName_Key);
+
+    // A pre-computed matrix may be created by an earlier filter and hold no values until the pipeline
+    // executes, so the source grid is used as a placeholder and the execute resizes the output
+    TransformedImageGrid grid = {imageGeom->getDimensions(), imageGeom->getOrigin(), imageGeom->getSpacing()};
+    if(pTransformationType != TransformType::PreComputed_TransformMatrix)
+    {
+      std::vector<float> transformationMatrix = CreateTransformationMatrix(dataStructure, filterArgs);
+      if(!IsTransformationInvertible(transformationMatrix))
+      {
+        return {MakeErrorResult<OutputActions>(-703, "The transformation matrix can not be inverted so the Image Geometry can not be resampled")};
+      }
+      grid = ComputeTransformedImageGrid(imageGeom->getDimensions(), imageGeom->getOrigin(), imageGeom->getSpacing(), transformationMatrix);
+    }
+
+    auto geomAction = std::make_unique<CreateImageGeometryAction>(pTransformedImageGeometryPath, CreateImageGeometryAction::DimensionType{grid.dims[0], grid.dims[1], grid.dims[2]},
+                                                                  CreateImageGeometryAction::OriginType{grid.origin[0], grid.origin[1], grid.origin[2]},
+                                                                  CreateImageGeometryAction::SpacingType{grid.spacing[0], grid.spacing[1], grid.spacing[2]});
+    resultOutputActions.value().actions.push_back(std::move(geomAction));
+
+    DataPath cellDataPath = pTransformedImageGeometryPath.createChildPath(pTransformedCellDataName);
+    resultOutputActions.value().actions.push_back(std::make_unique<CreateDataGroupAction>(cellDataPath));
+
+    const usize numSourceCells = imageGeom->getNumberOfElements();
+    const std::vector<usize> cellTupleShape = {grid.dims[2], grid.dims[1], grid.dims[0]};
+    for(const auto& cellArrayPath : pCellArrayPaths)
+    {
+      const auto* cellArray = dataStructure.getDataAs<IDataArray>(cellArrayPath);
+      if(cellArray == nullptr)
+      {
+        return {MakeErrorResult<OutputActions>(-704, fmt::format("Could not find the DataArray at path '{}'", cellArrayPath.toString()))};
+      }
+      if(cellArray->getNumberOfTuples() != numSourceCells)
+      {
+        return {MakeErrorResult<OutputActions>(
+            -704, fmt::format("DataArray at path '{}' has {} tuples but the Image Geometry has {} cells", cellArrayPath.toString(), cellArray->getNumberOfTuples(), numSourceCells))};
+      }
+      auto arrayAction = std::make_unique<CreateArrayAction>(cellArray->getDataType(), cellTupleShape, std::vector<usize>{cellArray->getNumberOfComponents()},
+                                                             cellDataPath.createChildPath(cellArrayPath.getTargetName()));
+      resultOutputActions.value().actions.push_back(std::move(arrayAction));
+    }
+  }
+
   // Return both the resultOutputActions and the preflightUpdatedValues via std::move()
   return {std::move(resultOutputActions), std::move(preflightUpdatedValues)};
 }
@@ -255,69 +402,29 @@ Result<> ApplyTransformationToGeometryFilter::executeImpl(DataStructure& dataStr
 
   inputValues.pGeometryToTransform = filterArgs.value<GeometrySelectionParameter::ValueType>(k_GeometryToTransform_Key);
   inputValues.pTransformationType = static_cast<TransformType>(filterArgs.value<ChoicesParameter::ValueType>(k_TransformType_Key));
-  auto pComputedTransformationMatrixPath = filterArgs.value<DataPath>(k_ComputedTransformationMatrix_Key);
 
-  std::vector<float> m_TransformationMatrix(16, 0.0F);
   switch(inputValues.pTransformationType)
   {
   case TransformType::No_Transform: {
     complex::Result<> resultActions;
     resultActions.warnings().push_back(Warning{-709, "Transform Type was set to '0' which means no transform will be performed."});
     return resultActions;
-    break;
-  }
-  case TransformType::PreComputed_TransformMatrix: {
-    auto precomputedTransformMatrix = dataStructure.getDataRefAs<Float32Array>(pComputedTransformationMatrixPath);
-    std::copy(precomputedTransformMatrix.begin(), precomputedTransformMatrix.end(), m_TransformationMatrix.begin());
-    break;
-  }
-  case TransformType::ManualTransformMatrix: {
-    auto flattenedData = filterArgs.value<DynamicTableParameter::ValueType>(k_ManualTransformationMatrix_Key).getFlattenedData();
-    m_TransformationMatrix = std::vector<float>(flattenedData.begin(), flattenedData.end());
-    break;
-  }
-  case TransformType::Rotation: {
-    auto pRotationAxisAngleValue = filterArgs.value<VectorFloat32Parameter::ValueType>(k_RotationAxisAngle_Key);
-    // Convert Degrees to Radians for the last element
-    pRotationAxisAngleValue[3] = pRotationAxisAngleValue[3] * static_cast<float>(complex::numbers::pi / 180.0f);
-    using OrientationF = std::vector<float>;
-    OrientationF om = OrientationTransformation::ax2om<OrientationF, OrientationF>(OrientationF(pRotationAxisAngleValue));
-
-    for(size_t i = 0; i < 3; i++)
-    {
-      m_TransformationMatrix[4 * i + 0] = om[3 * i + 0];
-      m_TransformationMatrix[4 * i + 1] = om[3 * i + 1];
-      m_TransformationMatrix[4 * i + 2] = om[3 * i + 2];
-      m_TransformationMatrix[4 * i + 3] = 0.0f;
-    }
-    m_TransformationMatrix[4 * 3 + 3] = 1.0f;
-    break;
   }
-  case TransformType::Translation: {
-    auto pTranslationValue = filterArgs.value<VectorFloat32Parameter::ValueType>(k_Translation_Key);
-    m_TransformationMatrix[4 * 0 + 0] = 1.0f;
-    m_TransformationMatrix[4 * 1 + 1] = 1.0f;
-    m_TransformationMatrix[4 * 2 + 2] = 1.0f;
-    m_TransformationMatrix[4 * 0 + 3] = pTranslationValue[0];
-    m_TransformationMatrix[4 * 1 + 3] = pTranslationValue[1];
-    m_TransformationMatrix[4 * 2 + 3] = pTranslationValue[2];
-    m_TransformationMatrix[4 * 3 + 3] = 1.0f;
-    break;
-  }
-  case TransformType::Scale: {
-    auto pScaleValue = filterArgs.value<VectorFloat32Parameter::ValueType>(k_Scale_Key);
-    m_TransformationMatrix[4 * 0 + 0] = pScaleValue[0];
-    m_TransformationMatrix[4 * 1 + 1] = pScaleValue[1];
-    m_TransformationMatrix[4 * 2 + 2] = pScaleValue[2];
-    m_TransformationMatrix[4 * 3 + 3] = 1.0f;
+  case TransformType::PreComputed_TransformMatrix:
+  case TransformType::ManualTransformMatrix:
+  case TransformType::Rotation:
+  case TransformType::Translation:
+  case TransformType::Scale:
     break;
-  }
-  break;
   default:
     return {MakeErrorResult(-705, "Value of 'Transform Type' was not correct. The value should fall between 0 and 5.")};
   }
 
-  inputValues.transformationMatrix = m_TransformationMatrix;
+  inputValues.transformationMatrix = CreateTransformationMatrix(dataStructure, filterArgs);
+  inputValues.pInterpolationType = static_cast<InterpolationType>(filterArgs.value<ChoicesParameter::ValueType>(k_InterpolationType_Key));
+  inputValues.pCellArrays = filterArgs.value<std::vector<DataPath>>(k_CellArrays_Key);
+  inputValues.pTransformedImageGeometry = filterArgs.value<DataPath>(k_TransformedImageGeometry_Key);
+  inputValues.pTransformedCellDataName = filterArgs.value<std::string>(k_TransformedCellDataName_Key);
 
   // Let the Algorithm instance do the work
   return ApplyTransformationToGeometry(dataStructure, &inputValues, shouldCancel, messageHandler)();
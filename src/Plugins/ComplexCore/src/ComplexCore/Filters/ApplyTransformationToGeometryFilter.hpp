@@ -33,6 +33,11 @@ public:
   static inline constexpr StringLiteral k_Translation_Key = "Translation";
   static inline constexpr StringLiteral k_Scale_Key = "Scale";
   static inline constexpr StringLiteral k_ComputedTransformationMatrix_Key = "ComputedTransformationMatrix";
+  static inline constexpr StringLiteral k_ResampleImageGeometry_Key = "ResampleImageGeometry";
+  static inline constexpr StringLiteral k_InterpolationType_Key = "InterpolationType";
+  static inline constexpr StringLiteral k_CellArrays_Key = "CellArrays";
+  static inline constexpr StringLiteral k_TransformedImageGeometry_Key = "TransformedImageGeometry";
+  static inline constexpr StringLiteral k_TransformedCellDataName_Key = "TransformedCellDataName";
 
   /**
    * @brief Returns the name of the filter.
@@ -9,6 +9,7 @@
 #include "complex/Parameters/DataPathSelectionParameter.hpp"
 #include "complex/Parameters/NumberParameter.hpp"
 #include "complex/Parameters/VectorParameter.hpp"
+#include "complex/Utilities/UniformGridIndex.hpp"
 
 namespace complex
 {
@@ -169,37 +170,24 @@ Result<> ApproximatePointCloudHull::executeImpl(DataStructure& data, const Argum
   SizeVec3 dims(std::vector<usize>{dims1, dims2, dims3});
   samplingGrid->setDimensions(dims);
 
-  int64 multiplier[3] = {1, static_cast<int64>(samplingGrid->getNumXPoints()), static_cast<int64>(samplingGrid->getNumXPoints() * samplingGrid->getNumYPoints())};
-  std::vector<std::vector<int64>> vertsInVoxels(samplingGrid->getNumberOfElements());
-
-  int64 progIncrement = numVerts / 100;
-  int64 prog = 1;
-  int64 progressInt = 0;
-
-  for(int64 v = 0; v < numVerts; v++)
+  // The vertex bins share the lattice of the sampling grid, so a sampling grid voxel
+  // maps to the bin at its lattice coordinates. Voxels outside of the occupied bins are empty.
+  if(source->findVertexBins(FloatVec3(gridResolution[0], gridResolution[1], gridResolution[2])) < 0)
   {
-    int64 i = static_cast<int64>(std::floor((*verts)[3 * v + 0] * inverseResolution[0]) - static_cast<float>(bboxMin[0]));
-    int64 j = static_cast<int64>(std::floor((*verts)[3 * v + 1] * inverseResolution[1]) - static_cast<float>(bboxMin[1]));
-    int64 k = static_cast<int64>(std::floor((*verts)[3 * v + 2] * inverseResolution[2]) - static_cast<float>(bboxMin[2]));
-    int64 index = i * multiplier[0] + j * multiplier[1] + k * multiplier[2];
-    vertsInVoxels[index].push_back(v);
-
-    if(v > prog)
-    {
-      progressInt = static_cast<int64>((static_cast<float>(v) / numVerts) * 100.0f);
-      std::string ss = fmt::format("Mapping Vertices to Voxels || {}% Complete", progressInt);
-      // notifyStatusMessage(ss);
-      prog = prog + progIncrement;
-    }
+    return {nonstd::make_unexpected(std::vector<Error>{Error{-11001, fmt::format("Unable to bin the vertices of '{}'", vertexGeomPath.toString())}})};
   }
+  const UniformGridIndex& vertsInVoxels = *(source->getVertexBins());
+  auto getVoxelVerts = [&vertsInVoxels, &bboxMin](int64 x, int64 y, int64 z) {
+    return vertsInVoxels.getPointsInBin(UniformGridIndex::BinCoords{x + bboxMin[0], y + bboxMin[1], z + bboxMin[2]});
+  };
 
   std::vector<float> tmpVerts;
   int64 neighborhood[78] = {1,  0, 0,  -1, 0, 0, 0, 1, 0,  0, -1, 0, 0, 0,  1,  0, 0, -1, 1, 1, 0,  -1, 1,  0, 1, -1, 0,  -1, -1, 0, 1,  0, 1,  1,  0,  -1, -1, 0,  1,
                             -1, 0, -1, 0,  1, 1, 0, 1, -1, 0, -1, 1, 0, -1, -1, 1, 1, 1,  1, 1, -1, 1,  -1, 1, 1, -1, -1, -1, 1,  1, -1, 1, -1, -1, -1, 1,  -1, -1, -1};
 
-  progIncrement = (dims[0] * dims[1] * dims[2]) / 100;
-  prog = 1;
-  progressInt = 0;
+  int64 progIncrement = (dims[0] * dims[1] * dims[2]) / 100;
+  int64 prog = 1;
+  int64 progressInt = 0;
   int64 counter = 0;
   int64 vertCounter = 0;
   float xAvg = 0.0f;
@@ -212,8 +200,8 @@ Result<> ApproximatePointCloudHull::executeImpl(DataStructure& data, const Argum
     {
       for(int64 x = 0; x < dims[0]; x++)
       {
-        usize index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        if(vertsInVoxels[index].empty())
+        const nonstd::span<const usize> voxelVerts = getVoxelVerts(x, y, z);
+        if(voxelVerts.empty())
         {
           counter++;
           continue;
@@ -225,8 +213,7 @@ Result<> ApproximatePointCloudHull::executeImpl(DataStructure& data, const Argum
         {
           if(validNeighbor(dims, neighborhood, n, x, y, z))
           {
-            usize neighborIndex = ((z + neighborhood[3 * n + 2]) * dims[1] * dims[0]) + ((y + neighborhood[3 * n + 1]) * dims[0]) + (x + neighborhood[3 * n + 0]);
-            if(vertsInVoxels[neighborIndex].empty())
+            if(getVoxelVerts(x + neighborhood[3 * n + 0], y + neighborhood[3 * n + 1], z + neighborhood[3 * n + 2]).empty())
             {
               emtpyNeighbors++;
             }
@@ -235,7 +222,7 @@ Result<> ApproximatePointCloudHull::executeImpl(DataStructure& data, const Argum
 
         if(emtpyNeighbors > numberOfEmptyNeighbors)
         {
-          for(auto vert : vertsInVoxels[index])
+          for(usize vert : voxelVerts)
           {
             vertCounter++;
             xAvg += (*verts)[3 * vert + 0];
@@ -9,7 +9,10 @@
 #include "complex/Parameters/ArraySelectionParameter.hpp"
 #include "complex/Parameters/BoolParameter.hpp"
 #include "complex/Parameters/DataPathSelectionParameter.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/Utilities/SegmentedReduction.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace complex
@@ -129,33 +132,28 @@ Result<> CalculateFeatureSizesFilter::findSizesImage(DataStructure& data, const
   auto& equivalentDiameters = data.getDataRefAs<Float32Array>(equivalentDiametersPath);
   auto& numElements = data.getDataRefAs<Int32Array>(numElementsPath);
 
-  usize totalPoints = featureIds.getNumberOfTuples();
-  std::set<int32_t> uniqueFeatureIds;
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    uniqueFeatureIds.insert((featureIds)[i]);
-  }
-
-  usize numfeatures = uniqueFeatureIds.size();
+  usize numfeatures = SegmentedReduction::FindNumberOfFeatures(featureIds);
 
   volumes.getDataStoreRef().reshapeTuples({numfeatures});
   equivalentDiameters.getDataStoreRef().reshapeTuples({numfeatures});
   numElements.getDataStoreRef().reshapeTuples({numfeatures});
 
-  std::vector<uint64> featureCountsStore(numfeatures, 0);
-
-  float res_scalar = 0.0f;
-
-  for(size_t j = 0; j < totalPoints; j++)
+  std::vector<usize> featureCountsStore = SegmentedReduction::CountCells(featureIds, numfeatures);
+  for(usize i = 1; i < numfeatures; i++)
   {
-    int32_t gnum = featureIds[j];
-    auto temp = featureCountsStore[gnum] + 1;
-    featureCountsStore[gnum] = temp;
+    if(featureCountsStore[i] > 9007199254740992ULL)
+    {
+      std::string ss = fmt::format("Number of voxels belonging to feature {} ({}) is greater than 9007199254740992", i, featureCountsStore[i]);
+      return {nonstd::make_unexpected(std::vector<Error>{Error{k_BadFeatureCount, ss}})};
+    }
   }
 
+  float res_scalar = 0.0f;
+
   FloatVec3 spacing = image->getSpacing();
 
-  if(image->getNumXPoints() == 1 || image->getNumYPoints() == 1 || image->getNumZPoints() == 1)
+  const bool isPlanar = image->getNumXPoints() == 1 || image->getNumYPoints() == 1 || image->getNumZPoints() == 1;
+  if(isPlanar)
   {
     if(image->getNumXPoints() == 1)
     {
@@ -169,42 +167,33 @@ Result<> CalculateFeatureSizesFilter::findSizesImage(DataStructure& data, const
     {
       res_scalar = spacing[0] * spacing[1];
     }
-
-    for(size_t i = 1; i < numfeatures; i++)
-    {
-      numElements[i] = static_cast<int32_t>(featureCountsStore[i]);
-      if(featureCountsStore[i] > 9007199254740992ULL)
-      {
-        std::string ss = fmt::format("Number of voxels belonging to feature {} ({}) is greater than 9007199254740992", i, featureCountsStore[i]);
-        return {nonstd::make_unexpected(std::vector<Error>{Error{k_BadFeatureCount, ss}})};
-      }
-      volumes[i] = static_cast<double>(featureCountsStore[i]) * static_cast<double>(res_scalar);
-
-      float rad = volumes[i] / k_PI;
-      float diameter = (2 * sqrtf(rad));
-      equivalentDiameters[i] = diameter;
-    }
   }
   else
   {
     res_scalar = spacing[0] * spacing[1] * spacing[2];
-    float vol_term = (4.0f / 3.0f) * k_PI;
-    for(usize i = 1; i < numfeatures; i++)
+  }
+  float vol_term = (4.0f / 3.0f) * k_PI;
+
+  // Every feature only depends on its own count, so the sizes are filled in parallel
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, std::max<usize>(numfeatures, 1));
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize i = range.min(); i < range.max(); i++)
     {
       numElements[i] = static_cast<int32>(featureCountsStore[i]);
-      if(featureCountsStore[i] > 9007199254740992ULL)
+      volumes[i] = static_cast<double>(featureCountsStore[i]) * static_cast<double>(res_scalar);
+      if(isPlanar)
       {
-        std::string ss = fmt::format("Number of voxels belonging to feature {} ({}) is greater than 9007199254740992", i, featureCountsStore[i]);
-        return {nonstd::make_unexpected(std::vector<Error>{Error{k_BadFeatureCount, ss}})};
+        float rad = volumes[i] / k_PI;
+        equivalentDiameters[i] = 2 * sqrtf(rad);
+      }
+      else
+      {
+        float rad = volumes[i] / vol_term;
+        equivalentDiameters[i] = 2.0f * powf(rad, 0.3333333333f);
       }
-
-      volumes[i] = static_cast<double>(featureCountsStore[i]) * static_cast<double>(res_scalar);
-
-      float rad = volumes[i] / vol_term;
-      float diameter = 2.0f * powf(rad, 0.3333333333f);
-      equivalentDiameters[i] = diameter;
     }
-  }
+  });
 
   if(saveElementSizes)
   {
@@ -236,7 +225,6 @@ Result<> CalculateFeatureSizesFilter::findSizesUnstructured(DataStructure& data,
   auto& equivalentDiameters = data.getDataRefAs<Float32Array>(equivalentDiametersPath);
   auto& numElements = data.getDataRefAs<Int32Array>(numElementsPath);
 
-  usize totalPoints = featureIds.getNumberOfTuples();
   usize numfeatures = volumes.getNumberOfTuples();
 
   if(!igeom->getElementSizes())
@@ -251,20 +239,32 @@ Result<> CalculateFeatureSizesFilter::findSizesUnstructured(DataStructure& data,
 
   const Float32Array* elemSizes = igeom->getElementSizes();
 
-  std::vector<float> featureCounts(numfeatures, 1);
-
-  for(size_t j = 0; j < totalPoints; j++)
+  // Each feature accumulates its element count and the sum of its element sizes
+  struct FeatureSize
+  {
+    usize count = 0;
+    float64 volume = 0.0;
+  };
+  std::vector<FeatureSize> featureSizes = SegmentedReduction::Reduce<FeatureSize>(
+      featureIds, numfeatures, FeatureSize{},
+      [elemSizes](FeatureSize& size, usize cellIndex) {
+        size.count++;
+        size.volume += (*elemSizes)[cellIndex];
+      },
+      [](FeatureSize& total, const FeatureSize& size) {
+        total.count += size.count;
+        total.volume += size.volume;
+      });
+  for(usize i = 0; i < numfeatures; i++)
   {
-    int32 gnum = featureIds[j];
-    auto temp = featureCounts[gnum] + 1;
-    featureCounts[gnum] = temp;
-    auto temp2 = volumes[gnum];
-    volumes[gnum] = temp2 + (*elemSizes)[j];
+    volumes[i] = static_cast<float32>(featureSizes[i].volume);
   }
+
   float vol_term = (4.0f / 3.0f) * k_PI;
   for(size_t i = 1; i < numfeatures; i++)
   {
-    numElements[i] = static_cast<int32>(featureCounts[i]);
+    // The element counts of unstructured geometries have always started at one
+    numElements[i] = static_cast<int32>(featureSizes[i].count + 1);
     float rad = volumes[i] / vol_term;
     float diameter = 2.0f * powf(rad, 0.3333333333f);
     equivalentDiameters[i] = diameter;
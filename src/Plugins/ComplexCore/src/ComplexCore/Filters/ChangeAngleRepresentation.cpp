@@ -5,7 +5,7 @@
 #include "complex/DataStructure/DataPath.hpp"
 #include "complex/Parameters/ArraySelectionParameter.hpp"
 #include "complex/Parameters/ChoicesParameter.hpp"
-#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/Utilities/ElementwiseKernel.hpp"
 
 #include <cmath>
 #include <fmt/format.h>
@@ -20,34 +20,6 @@ namespace EulerAngleConversionType
 constexpr uint64 DegreesToRadians = 0;
 constexpr uint64 RadiansToDegrees = 1;
 } // namespace EulerAngleConversionType
-
-class ChangeAngleRepresentationImpl
-{
-public:
-  ChangeAngleRepresentationImpl(Float32Array& angles, float factor)
-  : m_Angles(angles)
-  , m_ConvFactor(factor)
-  {
-  }
-  ~ChangeAngleRepresentationImpl() noexcept = default;
-
-  void convert(size_t start, size_t end) const
-  {
-    for(size_t i = start; i < end; i++)
-    {
-      m_Angles[i] = m_Angles[i] * m_ConvFactor;
-    }
-  }
-
-  void operator()(const ComplexRange& range) const
-  {
-    convert(range.min(), range.max());
-  }
-
-private:
-  Float32Array& m_Angles;
-  float m_ConvFactor = 0.0F;
-};
 } // namespace
 
 namespace complex
@@ -135,10 +107,7 @@ Result<> ChangeAngleRepresentation::executeImpl(DataStructure& dataStructure, co
     conversionFactor = static_cast<float>(180.0f / complex::numbers::pi);
   }
 
-  // Parallel algorithm to find duplicate nodes
-  ParallelDataAlgorithm dataAlg;
-  dataAlg.setRange(0ULL, angles.getSize());
-  dataAlg.execute(::ChangeAngleRepresentationImpl(angles, conversionFactor));
+  ElementwiseKernel::Transform(angles, [conversionFactor](float32 angle) { return angle * conversionFactor; });
 
   return {};
 }
@@ -3,42 +3,14 @@
 #include "complex/Common/TypesUtility.hpp"
 #include "complex/DataStructure/DataArray.hpp"
 #include "complex/DataStructure/DataPath.hpp"
+#include "complex/DataStructure/DataStore.hpp"
 #include "complex/Filter/Actions/CreateArrayAction.hpp"
 #include "complex/Parameters/ArrayCreationParameter.hpp"
 #include "complex/Parameters/ArraySelectionParameter.hpp"
+#include "complex/Utilities/TupleCopier.hpp"
 
 using namespace complex;
 
-namespace
-{
-// -----------------------------------------------------------------------------
-template <typename T>
-void copyData(DataStructure& dataStructure, const DataPath& selectedFeatureArrayPath, const DataPath& featureIdsArrayPath, const DataPath& createdArrayPath, const std::atomic_bool& shouldCancel)
-{
-  const DataArray<T>& selectedFeatureArray = dataStructure.getDataRefAs<DataArray<T>>(selectedFeatureArrayPath);
-  const Int32Array& featureIds = dataStructure.getDataRefAs<Int32Array>(featureIdsArrayPath);
-  DataArray<T>& createdArray = dataStructure.getDataRefAs<DataArray<T>>(createdArrayPath);
-
-  usize totalFeatureIdTuples = featureIds.getNumberOfTuples();
-  usize totalFeatureArrayComponents = selectedFeatureArray.getNumberOfComponents();
-  for(usize i = 0; i < totalFeatureIdTuples; ++i)
-  {
-    if(shouldCancel)
-    {
-      return;
-    }
-
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    int32 featureIdx = featureIds[i];
-
-    for(usize faComp = 0; faComp < totalFeatureArrayComponents; faComp++)
-    {
-      createdArray[totalFeatureArrayComponents * i + faComp] = selectedFeatureArray[totalFeatureArrayComponents * featureIdx + faComp];
-    }
-  }
-}
-} // namespace
-
 namespace complex
 {
 
@@ -161,43 +133,13 @@ Result<> CopyFeatureArrayToElementArray::executeImpl(DataStructure& dataStructur
     return MakeErrorResult(-5555, fmt::format("The number of Features in the Feature Data array {} does not match the largest Feature Id in the FeatureIds array", numFeatures));
   }
 
-  switch(selectedFeatureArray.getDataType())
-  {
-  case DataType::int8:
-    copyData<int8>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::uint8:
-    copyData<uint8>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::int16:
-    copyData<int16>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::uint16:
-    copyData<uint16>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::int32:
-    copyData<int32>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::uint32:
-    copyData<uint32>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::int64:
-    copyData<int64>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::uint64:
-    copyData<uint64>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::float32:
-    copyData<float>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::float64:
-    copyData<double>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  case DataType::boolean:
-    copyData<bool>(dataStructure, pSelectedFeatureArrayPathValue, pFeatureIdsArrayPathValue, pCreatedArrayNameValue, shouldCancel);
-    return {};
-  default:
-    return MakeErrorResult(-14000, fmt::format("The selected array was of unsupported type. The path is {}", pSelectedFeatureArrayPathValue.toString()));
-  }
+  // Every element tuple receives the tuple of its feature
+  IDataArray& createdArray = dataStructure.getDataRefAs<IDataArray>(pCreatedArrayNameValue);
+  const auto& featureIdsStore = featureIds.getIDataStoreRefAs<DataStore<int32>>();
+  TupleCopier tupleCopier;
+  tupleCopier.addArrays(selectedFeatureArray, createdArray);
+  tupleCopier.gather(featureIdsStore.createSpan());
+
+  return {};
 }
 } // namespace complex
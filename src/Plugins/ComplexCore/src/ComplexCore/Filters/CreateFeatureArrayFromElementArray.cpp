@@ -7,6 +7,8 @@
 #include "complex/Filter/Actions/CreateArrayAction.hpp"
 #include "complex/Parameters/ArrayCreationParameter.hpp"
 #include "complex/Parameters/ArraySelectionParameter.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/Utilities/SegmentedReduction.hpp"
 
 using namespace complex;
 
@@ -16,8 +18,9 @@ template <typename T>
 Result<> copyCellData(DataStructure& dataStructure, const DataPath& selectedCellArrayPathValue, const DataPath& featureIdsArrayPathValue, const DataPath& createdArrayNameValue,
                       const std::atomic_bool& shouldCancel)
 {
+  using CellBounds = SegmentedReduction::CellBounds;
+
   const DataArray<T>& selectedCellArray = dataStructure.getDataRefAs<DataArray<T>>(selectedCellArrayPathValue);
-  const DataStore<T> selectedCellArrayStore = selectedCellArray.template getIDataStoreRefAs<DataStore<T>>();
   const Int32Array& featureIds = dataStructure.getDataRefAs<Int32Array>(featureIdsArrayPathValue);
   DataArray<T>& createdArray = dataStructure.getDataRefAs<DataArray<T>>(createdArrayNameValue);
 
@@ -25,41 +28,59 @@ Result<> copyCellData(DataStructure& dataStructure, const DataPath& selectedCell
   createdArray.fill(0);
 
   usize totalCellArrayComponents = selectedCellArray.getNumberOfComponents();
-
-  std::map<int32, usize> featureMap;
-  Result<> result;
-
-  usize totalCellArrayTuples = selectedCellArray.getNumberOfTuples();
-  for(usize cellTupleIdx = 0; cellTupleIdx < totalCellArrayTuples; cellTupleIdx++)
-  {
-    if(shouldCancel)
+  usize numFeatures = createdArray.getNumberOfTuples();
+
+  // The last tuple of each feature is the one that gets copied
+  std::vector<CellBounds> cellBounds = SegmentedReduction::FindCellBounds(featureIds, numFeatures);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numFeatures);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize featureIdx = range.min(); featureIdx < range.max(); featureIdx++)
     {
-      return {};
+      if(cellBounds[featureIdx].empty())
+      {
+        continue;
+      }
+      usize lastCellTupleIdx = cellBounds[featureIdx].last;
+      for(usize cellCompIdx = 0; cellCompIdx < totalCellArrayComponents; cellCompIdx++)
+      {
+        createdArray[totalCellArrayComponents * featureIdx + cellCompIdx] = selectedCellArray[totalCellArrayComponents * lastCellTupleIdx + cellCompIdx];
+      }
     }
+  });
 
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    int32 featureIdx = featureIds[cellTupleIdx];
-
-    // Store the index of the first tuple with this feature id in the map
-    if(featureMap.find(featureIdx) == featureMap.end())
-    {
-      featureMap[featureIdx] = totalCellArrayComponents * cellTupleIdx;
-    }
+  if(shouldCancel)
+  {
+    return {};
+  }
 
-    // Check that the values at the current index match the value at the first index
-    usize firstInstanceCellTupleIdx = featureMap[featureIdx];
-    for(usize cellCompIdx = 0; cellCompIdx < totalCellArrayComponents; cellCompIdx++)
-    {
-      T firstInstanceCellVal = selectedCellArray[firstInstanceCellTupleIdx + cellCompIdx];
-      T currentCellVal = selectedCellArray[totalCellArrayComponents * cellTupleIdx + cellCompIdx];
-      if(currentCellVal != firstInstanceCellVal && result.warnings().empty())
-      {
-        // The values are inconsistent with the first values for this feature id, so throw a warning
-        result.warnings().push_back(Warning{-1000, fmt::format("Elements from Feature {} do not all have the same value. The last value copied into Feature {} will be used", featureIdx, featureIdx)});
-      }
+  // Find the first tuple of each feature whose values do not match the first tuple of that feature
+  std::vector<usize> firstMismatches = SegmentedReduction::Reduce<usize>(
+      featureIds, numFeatures, CellBounds::k_NoCell,
+      [&](usize& firstMismatch, usize cellTupleIdx) {
+        if(firstMismatch != CellBounds::k_NoCell)
+        {
+          return;
+        }
+        usize firstInstanceCellTupleIdx = cellBounds[featureIds[cellTupleIdx]].first;
+        for(usize cellCompIdx = 0; cellCompIdx < totalCellArrayComponents; cellCompIdx++)
+        {
+          if(selectedCellArray[totalCellArrayComponents * cellTupleIdx + cellCompIdx] != selectedCellArray[totalCellArrayComponents * firstInstanceCellTupleIdx + cellCompIdx])
+          {
+            firstMismatch = cellTupleIdx;
+            return;
+          }
+        }
+      },
+      [](usize& total, usize firstMismatch) { total = std::min(total, firstMismatch); });
 
-      createdArray[totalCellArrayComponents * featureIdx + cellCompIdx] = selectedCellArray[totalCellArrayComponents * cellTupleIdx + cellCompIdx];
-    }
+  Result<> result;
+  usize firstMismatch = firstMismatches.empty() ? CellBounds::k_NoCell : *std::min_element(firstMismatches.cbegin(), firstMismatches.cend());
+  if(firstMismatch != CellBounds::k_NoCell)
+  {
+    // The values are inconsistent with the first values for this feature id, so throw a warning
+    int32 featureIdx = featureIds[firstMismatch];
+    result.warnings().push_back(Warning{-1000, fmt::format("Elements from Feature {} do not all have the same value. The last value copied into Feature {} will be used", featureIdx, featureIdx)});
   }
 
   return result;
@@ -155,11 +176,10 @@ Result<> CreateFeatureArrayFromElementArray::executeImpl(DataStructure& dataStru
   IDataArray& createdArray = dataStructure.getDataRefAs<IDataArray>(pCreatedArrayNameValue);
 
   // Resize the created array to the proper size
-  usize featureIdsMaxIdx = std::distance(featureIds.begin(), std::max_element(featureIds.cbegin(), featureIds.cend()));
-  usize maxValue = featureIds[featureIdsMaxIdx];
+  usize numFeatures = SegmentedReduction::FindNumberOfFeatures(featureIds);
 
   IDataStore& createdArrayStore = createdArray.getIDataStoreRefAs<IDataStore>();
-  createdArrayStore.reshapeTuples(std::vector<usize>{maxValue + 1});
+  createdArrayStore.reshapeTuples(std::vector<usize>{numFeatures});
 
   switch(selectedCellArray.getDataType())
   {
@@ -12,74 +12,14 @@
 #include "complex/Parameters/MultiArraySelectionParameter.hpp"
 #include "complex/Parameters/StringParameter.hpp"
 #include "complex/Parameters/VectorParameter.hpp"
-#include "complex/Utilities/ParallelData3DAlgorithm.hpp"
 #include "complex/Utilities/ParallelDataAlgorithm.hpp"
-#include "complex/Utilities/ParallelTaskAlgorithm.hpp"
 #include "complex/Utilities/SamplingUtils.hpp"
+#include "complex/Utilities/TupleCopier.hpp"
 
 namespace complex
 {
 namespace
 {
-template <typename T>
-void copyDataTuple(IDataArray& oldArray, IDataArray& newArray, usize oldIndex, usize newIndex)
-{
-  auto& oldArrayCast = static_cast<DataArray<T>&>(oldArray);
-  auto& newArrayCast = static_cast<DataArray<T>&>(newArray);
-
-  auto numComponents = oldArrayCast.getNumberOfComponents();
-
-  for(usize i = 0; i < numComponents; i++)
-  {
-    usize newOffset = newIndex * numComponents;
-    usize oldOffset = oldIndex * numComponents;
-    newArrayCast[newOffset + i] = oldArrayCast[oldOffset + i];
-  }
-}
-
-void copyDataArrayTuple(IDataArray& oldArray, IDataArray& newArray, usize oldIndex, usize newIndex)
-{
-  auto dataType = oldArray.getDataType();
-  switch(dataType)
-  {
-  case DataType::boolean:
-    copyDataTuple<bool>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::float32:
-    copyDataTuple<float32>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::float64:
-    copyDataTuple<float64>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::int8:
-    copyDataTuple<int8>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::int16:
-    copyDataTuple<int16>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::int32:
-    copyDataTuple<int32>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::int64:
-    copyDataTuple<int64>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::uint8:
-    copyDataTuple<uint8>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::uint16:
-    copyDataTuple<uint16>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::uint32:
-    copyDataTuple<uint32>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  case DataType::uint64:
-    copyDataTuple<uint64>(oldArray, newArray, oldIndex, newIndex);
-    break;
-  default:
-    break;
-  }
-}
-
 USizeVec3 getCurrentVolumeDataContainerDimensions(const DataStructure& dataStructure, const DataPath& imageGeomPath)
 {
   USizeVec3 data = {0, 0, 0};
@@ -104,78 +44,6 @@ FloatVec3 getCurrentVolumeDataContainerResolutions(const DataStructure& dataStru
   }
   return data;
 }
-
-template <typename T>
-class CropImageGeomDataArray
-{
-public:
-  CropImageGeomDataArray(const IDataArray& oldCellArray, IDataArray& newCellArray, const ImageGeom& srcImageGeom, std::array<uint64, 6> bounds, const std::atomic_bool& shouldCancel)
-  : m_OldCellArray(dynamic_cast<const DataArray<T>&>(oldCellArray))
-  , m_NewCellArray(dynamic_cast<DataArray<T>&>(newCellArray))
-  , m_SrcImageGeom(srcImageGeom)
-  , m_Bounds(bounds)
-  , m_ShouldCancel(shouldCancel)
-  {
-  }
-
-  void operator()() const
-  {
-    convert();
-  }
-
-protected:
-  void convert() const
-  {
-    size_t numComps = m_OldCellArray.getNumberOfComponents();
-
-    uint64 col = 0;
-    uint64 row = 0;
-    uint64 plane = 0;
-
-    uint64 colold = 0;
-    uint64 rowold = 0;
-    uint64 planeold = 0;
-    uint64 index = 0;
-    uint64 index_old = 0;
-
-    // Loop over every tuple in this array
-    for(int64 i = 0; i < m_Bounds[5]; i++)
-    {
-      if(m_ShouldCancel)
-      {
-        return;
-      }
-
-      planeold = (i + m_Bounds[4]) * (m_SrcImageGeom.getNumXPoints() * m_SrcImageGeom.getNumYPoints());
-      plane = (i * m_Bounds[1] * m_Bounds[3]);
-      for(int64 j = 0; j < m_Bounds[3]; j++)
-      {
-        rowold = (j + m_Bounds[2]) * m_SrcImageGeom.getNumXPoints();
-        row = (j * m_Bounds[1]);
-        for(int64 k = 0; k < m_Bounds[1]; k++)
-        {
-          colold = (k + m_Bounds[0]);
-          col = k;
-          index_old = planeold + rowold + colold;
-          index = plane + row + col;
-
-          for(size_t compIndex = 0; compIndex < numComps; compIndex++)
-          {
-            m_NewCellArray[index * numComps + compIndex] = m_OldCellArray[index_old * numComps + compIndex];
-          }
-        }
-      }
-    }
-  }
-
-private:
-  const DataArray<T>& m_OldCellArray;
-  DataArray<T>& m_NewCellArray;
-  const ImageGeom& m_SrcImageGeom;
-  std::array<uint64, 6> m_Bounds;
-  const std::atomic_bool& m_ShouldCancel;
-};
-
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -477,76 +345,36 @@ Result<> CropImageGeometry::executeImpl(DataStructure& data, const Arguments& ar
 
   std::array<uint64, 6> bounds = {xMin, ((xMax - xMin) + 1), yMin, ((yMax - yMin) + 1), zMin, ((zMax - zMin) + 1)};
 
-  ParallelTaskAlgorithm taskRunner;
-
+  // Every selected array is copied in the same sweep over the retained rows
+  TupleCopier tupleCopier;
   for(const auto& voxelPath : voxelArrayPaths)
   {
-    if(shouldCancel)
-    {
-      return {};
-    }
-
-    std::string progMsg = fmt::format("Cropping Volume || Copying Data Array {}", voxelPath.getTargetName());
-    messageHandler(progMsg);
-
-    auto& oldDataArray = data.getDataRefAs<IDataArray>(voxelPath);
+    const auto& oldDataArray = data.getDataRefAs<IDataArray>(voxelPath);
     auto& newDataArray = data.getDataRefAs<IDataArray>(newVoxelParentPath.createChildPath(voxelPath.getTargetName()));
-    DataType type = oldDataArray.getDataType();
-
-    switch(type)
+    tupleCopier.addArrays(oldDataArray, newDataArray);
+  }
+  messageHandler(fmt::format("Cropping Volume || Copying {} Data Arrays", tupleCopier.getNumberOfArrays()));
+
+  // The retained part of each row is contiguous in both geometries, so whole rows are copied at once
+  const usize srcXPoints = srcImageGeom.getNumXPoints();
+  const usize srcSliceSize = srcXPoints * srcImageGeom.getNumYPoints();
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, bounds[5]);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize plane = range.min(); plane < range.max(); plane++)
     {
-    case DataType::boolean: {
-      taskRunner.execute(CropImageGeomDataArray<bool>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::int8: {
-      taskRunner.execute(CropImageGeomDataArray<int8>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::int16: {
-      taskRunner.execute(CropImageGeomDataArray<int16>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::int32: {
-      taskRunner.execute(CropImageGeomDataArray<int32>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::int64: {
-      taskRunner.execute(CropImageGeomDataArray<int64>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::uint8: {
-      taskRunner.execute(CropImageGeomDataArray<uint8>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::uint16: {
-      taskRunner.execute(CropImageGeomDataArray<uint16>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::uint32: {
-      taskRunner.execute(CropImageGeomDataArray<uint32>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::uint64: {
-      taskRunner.execute(CropImageGeomDataArray<uint64>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::float32: {
-      taskRunner.execute(CropImageGeomDataArray<float32>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    case DataType::float64: {
-      taskRunner.execute(CropImageGeomDataArray<float64>(oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel));
-      break;
-    }
-    default: {
-      throw std::runtime_error("Invalid DataType");
-    }
+      if(shouldCancel)
+      {
+        return;
+      }
+      for(usize row = 0; row < bounds[3]; row++)
+      {
+        const usize oldRowStart = (plane + bounds[4]) * srcSliceSize + (row + bounds[2]) * srcXPoints + bounds[0];
+        const usize newRowStart = (plane * bounds[3] + row) * bounds[1];
+        tupleCopier.copyTuples(oldRowStart, newRowStart, bounds[1]);
+      }
     }
-  }
-
-  // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
-  taskRunner.wait();
+  });
 
   if(shouldCancel)
   {
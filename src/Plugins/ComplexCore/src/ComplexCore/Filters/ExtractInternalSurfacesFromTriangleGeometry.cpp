@@ -7,10 +7,12 @@
 #include "complex/Parameters/DataGroupCreationParameter.hpp"
 #include "complex/Parameters/GeometrySelectionParameter.hpp"
 #include "complex/Parameters/MultiArraySelectionParameter.hpp"
-#include "complex/Utilities/FilterUtilities.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/Utilities/StreamCompaction.hpp"
+#include "complex/Utilities/TupleCopier.hpp"
 
+#include <atomic>
 #include <limits>
-#include <unordered_map>
 
 #include "fmt/format.h"
 
@@ -30,61 +32,6 @@ inline void hashCombine(usize& seed, const T& obj)
   std::hash<T> hasher;
   seed ^= hasher(obj) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
 }
-
-struct CopyDataFunctor
-{
-  template <typename T>
-  void operator()(IDataArray& inDataPtr, IDataArray& outDataPtr, std::unordered_map<int64, int64>& elementMap) const
-  {
-    auto& inputDataPtr = dynamic_cast<DataArray<T>&>(inDataPtr);
-    AbstractDataStore<T>& inputData = inputDataPtr.getDataStoreRef();
-    auto croppedDataPtr = dynamic_cast<DataArray<T>&>(outDataPtr);
-    AbstractDataStore<T>& outputData = croppedDataPtr.getDataStoreRef();
-
-    usize nTuples = outDataPtr.getNumberOfTuples();
-    usize nComps = inDataPtr.getNumberOfComponents();
-    usize tmpIndex = 0;
-    usize ptrIndex = 0;
-
-    for(usize i = 0; i < nTuples; i++)
-    {
-      for(usize d = 0; d < nComps; d++)
-      {
-        tmpIndex = nComps * i + d;
-        ptrIndex = nComps * elementMap[i] + d;
-        outputData[tmpIndex] = inputData[ptrIndex];
-      }
-    }
-  }
-};
-
-struct RemoveFlaggedVerticesFunctor
-{
-  // copy data to masked geometry
-  template <class T>
-  void operator()(IDataArray& inputDataPtr, IDataArray& outputDataArray, const std::vector<complex::AbstractGeometry::MeshIndexType>& indexMapping) const
-  {
-    auto& inputData = dynamic_cast<DataArray<T>&>(inputDataPtr);
-    auto& outputData = dynamic_cast<DataArray<T>&>(outputDataArray);
-    usize nComps = inputData.getNumberOfComponents();
-    complex::AbstractGeometry::MeshIndexType notSeen = std::numeric_limits<complex::AbstractGeometry::MeshIndexType>::max();
-
-    for(usize i = 0; i < indexMapping.size(); i++)
-    {
-      complex::AbstractGeometry::MeshIndexType newIndex = indexMapping[i];
-      if(newIndex != notSeen)
-      {
-        for(usize compIdx = 0; compIdx < nComps; compIdx++)
-        {
-          usize destinationIndex = newIndex * nComps + compIdx;
-          usize sourceIndex = i * nComps + compIdx;
-          outputData[destinationIndex] = inputData[sourceIndex];
-        }
-      }
-    }
-  }
-};
-
 } // namespace
 
 namespace complex
@@ -249,121 +196,132 @@ Result<> ExtractInternalSurfacesFromTriangleGeometry::executeImpl(DataStructure&
   auto internalFacesPath = internalTrianglesPath.createChildPath(CreateTriangleGeomAction::k_DefaultFacesName);
   internalTriangleGeom.setFaces(data.getDataAs<UInt64Array>(internalFacesPath));
 
-  // int64 progIncrement = numTris / 100;
-  // int64 prog = 1;
-  // int64 progressInt = 0;
-  // int64 counter = 0;
   using MeshIndexType = complex::AbstractGeometry::MeshIndexType;
 
   const MeshIndexType notSeen = std::numeric_limits<MeshIndexType>::max();
 
-  std::vector<MeshIndexType> vertNewIndex(numVerts, notSeen);
-  std::vector<MeshIndexType> triNewIndex(numTris, notSeen);
-  MeshIndexType currentNewTriIndex = 0;
-  MeshIndexType currentNewVertIndex = 0;
+  // Keep the triangles whose nodes are all of type 2, 3 or 4
+  auto isInternalNode = [&nodeTypes](MeshIndexType vertIndex) { return nodeTypes[vertIndex] >= 2 && nodeTypes[vertIndex] <= 4; };
+  std::vector<MeshIndexType> keptTriangles = StreamCompaction::SelectIndices<MeshIndexType>(numTris, [&](usize triIndex) {
+    return isInternalNode(triangles[3 * triIndex + 0]) && isInternalNode(triangles[3 * triIndex + 1]) && isInternalNode(triangles[3 * triIndex + 2]);
+  });
+  const usize numNewTris = keptTriangles.size();
 
-  // Loop over all of the triangles mapping the triangle and the vertices to the new array locations
-  for(MeshIndexType triIndex = 0; triIndex < numTris; triIndex++)
+  if(shouldCancel)
   {
+    return {};
+  }
 
-    MeshIndexType v0Index = triangles[3 * triIndex + 0];
-    MeshIndexType v1Index = triangles[3 * triIndex + 1];
-    MeshIndexType v2Index = triangles[3 * triIndex + 2];
-    // Check if the NodeType is either 2, 3, 4
-    if((nodeTypes[v0Index] >= 2 && nodeTypes[v0Index] <= 4) && (nodeTypes[v1Index] >= 2 && nodeTypes[v1Index] <= 4) && (nodeTypes[v2Index] >= 2 && nodeTypes[v2Index] <= 4))
-    {
-      // All Nodes are the correct type
-      triNewIndex[triIndex] = currentNewTriIndex;
-      currentNewTriIndex++; // increment the index into which this triangle would be place in the new triangle array
-      // Now figure out if we have seen each vertex
-      if(vertNewIndex[v0Index] == notSeen)
+  // The kept vertices are numbered in the order the kept triangles first reference them. Find the first
+  // corner (3 * new triangle index + corner) referencing each vertex, then compact those corners.
+  auto cornerVertex = [&](usize corner) -> MeshIndexType { return triangles[3 * keptTriangles[corner / 3] + corner % 3]; };
+  std::vector<std::atomic<MeshIndexType>> firstCorners(numVerts);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numVerts);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize vertIndex = range.min(); vertIndex < range.max(); vertIndex++)
       {
-        vertNewIndex[v0Index] = currentNewVertIndex;
-        currentNewVertIndex++;
+        firstCorners[vertIndex].store(notSeen, std::memory_order_relaxed);
       }
-      if(vertNewIndex[v1Index] == notSeen)
+    });
+  }
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, 3 * numNewTris);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize corner = range.min(); corner < range.max(); corner++)
       {
-        vertNewIndex[v1Index] = currentNewVertIndex;
-        currentNewVertIndex++;
+        std::atomic<MeshIndexType>& firstCorner = firstCorners[cornerVertex(corner)];
+        MeshIndexType current = firstCorner.load(std::memory_order_relaxed);
+        while(corner < current && !firstCorner.compare_exchange_weak(current, corner, std::memory_order_relaxed))
+        {
+        }
       }
-      if(vertNewIndex[v2Index] == notSeen)
+    });
+  }
+  std::vector<MeshIndexType> keptVertices =
+      StreamCompaction::SelectIndices<MeshIndexType>(3 * numNewTris, [&](usize corner) { return firstCorners[cornerVertex(corner)].load(std::memory_order_relaxed) == corner; });
+  const usize numNewVerts = keptVertices.size();
+
+  std::vector<MeshIndexType> vertNewIndex(numVerts, notSeen);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numNewVerts);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize newIndex = range.min(); newIndex < range.max(); newIndex++)
       {
-        vertNewIndex[v2Index] = currentNewVertIndex;
-        currentNewVertIndex++;
+        keptVertices[newIndex] = cornerVertex(keptVertices[newIndex]);
+        vertNewIndex[keptVertices[newIndex]] = newIndex;
       }
-    }
+    });
+  }
 
-    if(shouldCancel)
-    {
-      return {};
-    }
+  if(shouldCancel)
+  {
+    return {};
   }
 
   // Resize the vertex and triangle arrays
-  internalTriangleGeom.resizeVertexList(currentNewVertIndex);
-  internalTriangleGeom.resizeFaceList(currentNewTriIndex);
+  internalTriangleGeom.resizeVertexList(numNewVerts);
+  internalTriangleGeom.resizeFaceList(numNewTris);
 
   complex::AbstractGeometry::SharedVertexList* internalVerts = internalTriangleGeom.getVertices();
   complex::AbstractGeometry::SharedFaceList* internalTriangles = internalTriangleGeom.getFaces();
 
-  // Transfer the data from the old SharedVertexList to the new VertexList
-  for(MeshIndexType vertIndex = 0; vertIndex < numVerts; vertIndex++)
+  // Transfer the triangles to the new TriangleList, renumbering their vertices
   {
-    MeshIndexType mappedIndex = vertNewIndex[vertIndex];
-    if(mappedIndex != notSeen)
-    {
-      // Get the actual XYZ coordinate
-      float x = vertices[vertIndex * 3 + 0];
-      float y = vertices[vertIndex * 3 + 1];
-      float z = vertices[vertIndex * 3 + 2];
-
-      (*internalVerts)[mappedIndex * 3 + 0] = x;
-      (*internalVerts)[mappedIndex * 3 + 1] = y;
-      (*internalVerts)[mappedIndex * 3 + 2] = z;
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numNewTris);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize newIndex = range.min(); newIndex < range.max(); newIndex++)
+      {
+        const MeshIndexType triIndex = keptTriangles[newIndex];
+        (*internalTriangles)[newIndex * 3 + 0] = vertNewIndex[triangles[triIndex * 3 + 0]];
+        (*internalTriangles)[newIndex * 3 + 1] = vertNewIndex[triangles[triIndex * 3 + 1]];
+        (*internalTriangles)[newIndex * 3 + 2] = vertNewIndex[triangles[triIndex * 3 + 2]];
+      }
+    });
   }
 
-  // Transfer the data from the old SharedTriangleList to the new TriangleList
-  for(MeshIndexType triIndex = 0; triIndex < numTris; triIndex++)
+  // Copy the vertex coordinates element wise. The shared vertex list of the input is not guaranteed to
+  // have 3 components, so it cannot be gathered tuple by tuple into the new 3 component list.
   {
-    MeshIndexType mappedIndex = triNewIndex[triIndex];
-    if(mappedIndex != notSeen)
-    {
-      // Get the 3 original vertex indices for this triangle
-      MeshIndexType v0 = triangles[triIndex * 3 + 0];
-      MeshIndexType v1 = triangles[triIndex * 3 + 1];
-      MeshIndexType v2 = triangles[triIndex * 3 + 2];
-
-      MeshIndexType v0New = vertNewIndex[v0];
-      MeshIndexType v1New = vertNewIndex[v1];
-      MeshIndexType v2New = vertNewIndex[v2];
-
-      (*internalTriangles)[mappedIndex * 3 + 0] = v0New;
-      (*internalTriangles)[mappedIndex * 3 + 1] = v1New;
-      (*internalTriangles)[mappedIndex * 3 + 2] = v2New;
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numNewVerts);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize newIndex = range.min(); newIndex < range.max(); newIndex++)
+      {
+        const MeshIndexType vertIndex = keptVertices[newIndex];
+        (*internalVerts)[newIndex * 3 + 0] = vertices[vertIndex * 3 + 0];
+        (*internalVerts)[newIndex * 3 + 1] = vertices[vertIndex * 3 + 1];
+        (*internalVerts)[newIndex * 3 + 2] = vertices[vertIndex * 3 + 2];
+      }
+    });
   }
 
-  // Copy any Vertex and Triangle DataArrays to extracted surface mesh
+  // Gather any Vertex and Triangle DataArrays into the extracted surface mesh
+  TupleCopier vertexCopier;
   for(const auto& targetArrayPath : copyVertexPaths)
   {
     DataPath destinationPath = internalTrianglesPath.createChildPath("VertexData").createChildPath(targetArrayPath.getTargetName());
     auto& src = data.getDataRefAs<IDataArray>(targetArrayPath);
     auto& dest = data.getDataRefAs<IDataArray>(destinationPath);
-    dest.getIDataStore()->reshapeTuples({currentNewVertIndex});
-
-    ExecuteDataFunction(RemoveFlaggedVerticesFunctor{}, src.getDataType(), src, dest, vertNewIndex);
+    dest.getIDataStore()->reshapeTuples({numNewVerts});
+    vertexCopier.addArrays(src, dest);
   }
+  vertexCopier.gather(nonstd::span<const MeshIndexType>(keptVertices.data(), keptVertices.size()));
 
+  TupleCopier triangleCopier;
   for(const auto& targetArrayPath : copyTrianglePaths)
   {
     DataPath destinationPath = internalTrianglesPath.createChildPath("FaceData").createChildPath(targetArrayPath.getTargetName());
     auto& src = data.getDataRefAs<IDataArray>(targetArrayPath);
     auto& dest = data.getDataRefAs<IDataArray>(destinationPath);
-    dest.getIDataStore()->reshapeTuples({currentNewTriIndex});
-
-    ExecuteDataFunction(RemoveFlaggedVerticesFunctor{}, src.getDataType(), src, dest, triNewIndex);
+    dest.getIDataStore()->reshapeTuples({numNewTris});
+    triangleCopier.addArrays(src, dest);
   }
+  triangleCopier.gather(nonstd::span<const MeshIndexType>(keptTriangles.data(), keptTriangles.size()));
 
   return {};
 }
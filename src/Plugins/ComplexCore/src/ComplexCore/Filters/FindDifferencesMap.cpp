@@ -8,6 +8,7 @@
 #include "complex/Filter/Actions/CreateArrayAction.hpp"
 #include "complex/Parameters/ArrayCreationParameter.hpp"
 #include "complex/Parameters/DataPathSelectionParameter.hpp"
+#include "complex/Utilities/ElementwiseKernel.hpp"
 
 namespace complex
 {
@@ -77,56 +78,14 @@ IFilter::PreflightResult warnOnUnsignedTypes(const DataStructure& data, const st
   return {};
 }
 
-/**
- * @brief The FindDifferenceMapImpl class implements a threaded algorithm that computes the difference map
- * between two arrays
- */
-template <typename DataType>
-class FindDifferenceMapImpl
-{
-  using store_type = AbstractDataStore<DataType>;
-
-public:
-  FindDifferenceMapImpl(IDataArray* firstArray, IDataArray* secondArray, IDataArray* differenceMap)
-  : m_FirstArray(firstArray)
-  , m_SecondArray(secondArray)
-  , m_DifferenceMap(differenceMap)
-  {
-  }
-  virtual ~FindDifferenceMapImpl() = default;
-
-  void generate(size_t start, size_t end) const
-  {
-    auto firstArray = dynamic_cast<store_type*>(m_FirstArray->getIDataStore());
-    auto secondArray = dynamic_cast<store_type*>(m_SecondArray->getIDataStore());
-    auto differenceMap = dynamic_cast<store_type*>(m_DifferenceMap->getIDataStore());
-
-    int32 numComps = firstArray->getNumberOfComponents();
-
-    for(usize i = start; i < end; i++)
-    {
-      for(int32 j = 0; j < numComps; j++)
-      {
-        differenceMap->setValue(numComps * i + j, firstArray->getValue(numComps * i + j) - secondArray->getValue(numComps * i + j));
-      }
-    }
-  }
-
-private:
-  IDataArray* m_FirstArray;
-  IDataArray* m_SecondArray;
-  IDataArray* m_DifferenceMap;
-};
-
 template <typename DataType>
 void ExecuteFindDifferenceMap(IDataArray* firstArrayPtr, IDataArray* secondArrayPtr, IDataArray* differenceMapPtr)
 {
-  size_t numTuples = firstArrayPtr->getNumberOfTuples();
+  auto& firstArray = dynamic_cast<DataArray<DataType>&>(*firstArrayPtr);
+  auto& secondArray = dynamic_cast<DataArray<DataType>&>(*secondArrayPtr);
+  auto& differenceMap = dynamic_cast<DataArray<DataType>&>(*differenceMapPtr);
 
-  {
-    FindDifferenceMapImpl<DataType> serial(firstArrayPtr, secondArrayPtr, differenceMapPtr);
-    serial.generate(0, numTuples);
-  }
+  ElementwiseKernel::Transform(firstArray, secondArray, differenceMap, [](DataType first, DataType second) { return static_cast<DataType>(first - second); });
 }
 } // namespace
 
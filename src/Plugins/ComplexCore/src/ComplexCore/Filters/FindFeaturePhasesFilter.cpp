@@ -5,6 +5,7 @@
 #include "complex/Filter/Actions/CreateArrayAction.hpp"
 #include "complex/Parameters/ArrayCreationParameter.hpp"
 #include "complex/Parameters/ArraySelectionParameter.hpp"
+#include "complex/Utilities/SegmentedReduction.hpp"
 
 using namespace complex;
 
@@ -96,46 +97,49 @@ Result<> FindFeaturePhasesFilter::executeImpl(DataStructure& dataStructure, cons
   Int32Array& featurePhases = dataStructure.getDataRefAs<Int32Array>(pFeaturePhasesArrayPathValue);
 
   // Resize the featurePhases array to the proper size
-  usize featureIdsMaxIdx = std::distance(featureIds.begin(), std::max_element(featureIds.cbegin(), featureIds.cend()));
-  usize maxValue = featureIds[featureIdsMaxIdx];
+  usize numFeatures = SegmentedReduction::FindNumberOfFeatures(featureIds);
 
   DataStore<int32>& featurePhasesStore = featurePhases.getIDataStoreRefAs<DataStore<int32>>();
-  featurePhasesStore.reshapeTuples(std::vector<usize>{maxValue + 1});
+  featurePhasesStore.reshapeTuples(std::vector<usize>{numFeatures});
 
-  usize totalPoints = featureIds.getNumberOfTuples();
-  std::map<int32, int32> featureMap;
-  std::map<int32, int32> warningMap;
-
-  for(usize i = 0; i < totalPoints; i++)
+  // The last cell of each feature decides its phase
+  std::vector<SegmentedReduction::CellBounds> cellBounds = SegmentedReduction::FindCellBounds(featureIds, numFeatures);
+  for(usize featureId = 0; featureId < numFeatures; featureId++)
   {
-    if(shouldCancel)
+    if(!cellBounds[featureId].empty())
     {
-      return {};
+      featurePhases[featureId] = cellPhases[cellBounds[featureId].last];
     }
+  }
 
-    int32 gnum = featureIds[i];
-    featureMap.insert({gnum, cellPhases[i]});
-
-    int32 curPhaseVal = featureMap[gnum];
-    if(curPhaseVal != cellPhases[i])
-    {
-      auto [iter, insertSuccess] = warningMap.insert({gnum, 1});
-      if(!insertSuccess)
-      {
-        iter->second += 1;
-      }
-    }
-    featurePhases[gnum] = cellPhases[i];
+  if(shouldCancel)
+  {
+    return {};
   }
 
+  // Count the cells of each feature whose phase differs from the phase of the first cell
+  std::vector<usize> mismatchCounts = SegmentedReduction::Reduce<usize>(
+      featureIds, numFeatures, 0,
+      [&cellPhases, &featureIds, &cellBounds](usize& count, usize cellIndex) {
+        if(cellPhases[cellIndex] != cellPhases[cellBounds[featureIds[cellIndex]].first])
+        {
+          count++;
+        }
+      },
+      [](usize& total, usize count) { total += count; });
+
   Result<> result;
-  if(!warningMap.empty())
+  for(usize featureId = 0; featureId < numFeatures; featureId++)
   {
-    result.warnings().push_back(Warning{-500, "Elements from some features did not all have the same phase ID. The last phase ID copied into each feature will be used."});
-    for(auto&& [key, value] : warningMap)
+    if(mismatchCounts[featureId] == 0)
+    {
+      continue;
+    }
+    if(result.warnings().empty())
     {
-      result.warnings().push_back(Warning{-500, fmt::format("Phase Feature {} created {} warnings.", key, value)});
+      result.warnings().push_back(Warning{-500, "Elements from some features did not all have the same phase ID. The last phase ID copied into each feature will be used."});
     }
+    result.warnings().push_back(Warning{-500, fmt::format("Phase Feature {} created {} warnings.", featureId, mismatchCounts[featureId])});
   }
 
   return result;
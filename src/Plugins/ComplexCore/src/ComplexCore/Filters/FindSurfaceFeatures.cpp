@@ -10,6 +10,10 @@
 #include "complex/Parameters/ArraySelectionParameter.hpp"
 #include "complex/Parameters/BoolParameter.hpp"
 #include "complex/Parameters/GeometrySelectionParameter.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/Utilities/SegmentedReduction.hpp"
+
+#include <algorithm>
 
 using namespace complex;
 
@@ -100,43 +104,123 @@ bool isPointASurfaceFeature(const Point3D<usize>& point, usize xPoints, usize yP
   return false;
 }
 
-void findSurfaceFeatures3D(DataStructure& ds, const DataPath& featureGeometryPathValue, const DataPath& featureIdsArrayPathValue, const DataPath& surfaceFeaturesArrayPathValue,
-                           bool markFeature0Neighbors, const std::atomic_bool& shouldCancel)
+/**
+ * @brief Marks the features of the cells on the outer faces of the geometry. Only those cells are
+ * visited, in parallel over the z slices. A single slice (zPoints == 1) is treated as a 2D geometry.
+ */
+void markBoundaryFeatures(const Int32Array& featureIds, usize xPoints, usize yPoints, usize zPoints, BoolArray& surfaceFeatures, const std::atomic_bool& shouldCancel)
 {
-  const ImageGeom& featureGeometry = ds.getDataRefAs<ImageGeom>(featureGeometryPathValue);
-  const Int32Array& featureIds = ds.getDataRefAs<Int32Array>(featureIdsArrayPathValue);
-  BoolArray& surfaceFeatures = ds.getDataRefAs<BoolArray>(surfaceFeaturesArrayPathValue);
-
-  usize xPoints = featureGeometry.getNumXPoints();
-  usize yPoints = featureGeometry.getNumYPoints();
-  usize zPoints = featureGeometry.getNumZPoints();
+  const usize sliceSize = xPoints * yPoints;
+  std::vector<std::vector<int32>> sliceFeatures(zPoints);
 
-  for(usize z = 0; z < zPoints; z++)
-  {
-    usize zStride = z * xPoints * yPoints;
-    for(usize y = 0; y < yPoints; y++)
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, zPoints);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize z = range.min(); z < range.max(); z++)
     {
-      usize yStride = y * xPoints;
-      for(usize x = 0; x < xPoints; x++)
+      if(shouldCancel)
       {
-        if(shouldCancel)
+        return;
+      }
+      std::vector<int32>& features = sliceFeatures[z];
+      auto addCell = [&features, &featureIds](usize cell) {
+        const int32 gnum = featureIds[cell];
+        if(gnum > 0 && (features.empty() || features.back() != gnum))
         {
-          return;
+          features.push_back(gnum);
         }
-
-        int32 gnum = featureIds[zStride + yStride + x];
-        if(gnum != 0 && !surfaceFeatures[gnum])
+      };
+      const bool isFaceSlice = zPoints > 1 && (z == 0 || z == zPoints - 1);
+      for(usize y = 0; y < yPoints; y++)
+      {
+        const usize rowStart = z * sliceSize + y * xPoints;
+        if(isFaceSlice || y == 0 || y == yPoints - 1)
         {
-          if(isPointASurfaceFeature(Point3D{x, y, z}, xPoints, yPoints, zPoints, markFeature0Neighbors, featureIds))
+          for(usize x = 0; x < xPoints; x++)
           {
-            surfaceFeatures[gnum] = true;
+            addCell(rowStart + x);
           }
         }
+        else
+        {
+          addCell(rowStart);
+          addCell(rowStart + xPoints - 1);
+        }
+      }
+      std::sort(features.begin(), features.end());
+      features.erase(std::unique(features.begin(), features.end()), features.end());
+    }
+  });
+
+  const usize numFeatures = surfaceFeatures.getNumberOfTuples();
+  for(const auto& features : sliceFeatures)
+  {
+    for(int32 gnum : features)
+    {
+      if(static_cast<usize>(gnum) < numFeatures)
+      {
+        surfaceFeatures[gnum] = true;
       }
     }
   }
 }
 
+/**
+ * @brief Marks the features that touch the outer faces of the geometry or feature 0. Every cell has
+ * to be visited, so the cells are reduced into one flag per feature in parallel.
+ */
+void markFeature0NeighborFeatures(const Int32Array& featureIds, usize xPoints, usize yPoints, usize zPoints, BoolArray& surfaceFeatures)
+{
+  const usize numFeatures = surfaceFeatures.getNumberOfTuples();
+  const usize sliceSize = xPoints * yPoints;
+
+  std::vector<uint8> isSurfaceFeature = SegmentedReduction::Reduce<uint8>(
+      featureIds, numFeatures, 0,
+      [&](uint8& isSurface, usize cell) {
+        if(isSurface != 0 || featureIds[cell] == 0)
+        {
+          return;
+        }
+        const usize x = cell % xPoints;
+        const usize y = (cell / xPoints) % yPoints;
+        if(zPoints > 1)
+        {
+          isSurface = isPointASurfaceFeature(Point3D<usize>{x, y, cell / sliceSize}, xPoints, yPoints, zPoints, true, featureIds) ? 1 : 0;
+        }
+        else
+        {
+          isSurface = isPointASurfaceFeature(Point2D<usize>{x, y}, xPoints, yPoints, true, featureIds) ? 1 : 0;
+        }
+      },
+      [](uint8& total, const uint8& slabTotal) { total |= slabTotal; });
+
+  for(usize i = 0; i < numFeatures; i++)
+  {
+    surfaceFeatures[i] = isSurfaceFeature[i] != 0;
+  }
+}
+
+void findSurfaceFeatures3D(DataStructure& ds, const DataPath& featureGeometryPathValue, const DataPath& featureIdsArrayPathValue, const DataPath& surfaceFeaturesArrayPathValue,
+                           bool markFeature0Neighbors, const std::atomic_bool& shouldCancel)
+{
+  const ImageGeom& featureGeometry = ds.getDataRefAs<ImageGeom>(featureGeometryPathValue);
+  const Int32Array& featureIds = ds.getDataRefAs<Int32Array>(featureIdsArrayPathValue);
+  BoolArray& surfaceFeatures = ds.getDataRefAs<BoolArray>(surfaceFeaturesArrayPathValue);
+
+  usize xPoints = featureGeometry.getNumXPoints();
+  usize yPoints = featureGeometry.getNumYPoints();
+  usize zPoints = featureGeometry.getNumZPoints();
+
+  if(markFeature0Neighbors)
+  {
+    markFeature0NeighborFeatures(featureIds, xPoints, yPoints, zPoints, surfaceFeatures);
+  }
+  else
+  {
+    markBoundaryFeatures(featureIds, xPoints, yPoints, zPoints, surfaceFeatures, shouldCancel);
+  }
+}
+
 void findSurfaceFeatures2D(DataStructure& ds, const DataPath& featureGeometryPathValue, const DataPath& featureIdsArrayPathValue, const DataPath& surfaceFeaturesArrayPathValue,
                            bool markFeature0Neighbors, const std::atomic_bool& shouldCancel)
 {
@@ -163,25 +247,13 @@ void findSurfaceFeatures2D(DataStructure& ds, const DataPath& featureGeometryPat
     yPoints = featureGeometry.getNumYPoints();
   }
 
-  for(usize y = 0; y < yPoints; y++)
+  if(markFeature0Neighbors)
   {
-    usize yStride = y * xPoints;
-    for(usize x = 0; x < xPoints; x++)
-    {
-      if(shouldCancel)
-      {
-        return;
-      }
-
-      int32 gnum = featureIds[yStride + x];
-      if(gnum != 0 && surfaceFeatures[gnum] == 0)
-      {
-        if(isPointASurfaceFeature(Point2D{x, y}, xPoints, yPoints, markFeature0Neighbors, featureIds))
-        {
-          surfaceFeatures[gnum] = 1;
-        }
-      }
-    }
+    markFeature0NeighborFeatures(featureIds, xPoints, yPoints, 1, surfaceFeatures);
+  }
+  else
+  {
+    markBoundaryFeatures(featureIds, xPoints, yPoints, 1, surfaceFeatures, shouldCancel);
   }
 }
 } // namespace
@@ -280,10 +352,9 @@ Result<> FindSurfaceFeatures::executeImpl(DataStructure& dataStructure, const Ar
   BoolArray& surfaceFeatures = dataStructure.getDataRefAs<BoolArray>(pSurfaceFeaturesArrayPathValue);
   DataStore<bool>& surfaceFeaturesStore = surfaceFeatures.getIDataStoreRefAs<DataStore<bool>>();
 
-  usize featureIdsMaxIdx = std::distance(featureIds.begin(), std::max_element(featureIds.cbegin(), featureIds.cend()));
-  usize maxFeature = featureIds[featureIdsMaxIdx];
+  usize numFeatures = SegmentedReduction::FindNumberOfFeatures(featureIds);
 
-  surfaceFeaturesStore.reshapeTuples(std::vector<usize>{maxFeature + 1});
+  surfaceFeaturesStore.reshapeTuples(std::vector<usize>{numFeatures});
   surfaceFeaturesStore.fill(0);
 
   // Find surface features
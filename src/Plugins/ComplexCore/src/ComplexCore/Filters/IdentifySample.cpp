@@ -5,6 +5,10 @@
 #include "complex/Parameters/ArraySelectionParameter.hpp"
 #include "complex/Parameters/BoolParameter.hpp"
 #include "complex/Parameters/GeometrySelectionParameter.hpp"
+#include "complex/Utilities/ExecutionContext.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
 
 namespace complex
 {
@@ -12,216 +16,266 @@ namespace
 {
 constexpr int64 k_MISSING_GEOM_ERR = -650;
 
-template <typename T>
-void _execute(DataStructure& data, const DataPath& imageGeomPath, const DataPath& goodVoxelsArrayPath, bool fillHoles)
+// Voxels that do not belong to the labeled set
+constexpr int64 k_Unlabeled = -1;
+
+/**
+ * @brief Finds the root of a voxel, halving the path on the way. Every voxel points at a
+ * voxel with a smaller or equal index, so the root of a component is its first voxel.
+ * @param parents
+ * @param index
+ * @return int64
+ */
+int64 findRoot(std::vector<int64>& parents, int64 index)
 {
-  using ArrayType = DataArray<T>;
-
-  auto* imageGeom = data.getDataAs<ImageGeom>(imageGeomPath);
-
-  std::vector<usize> cDims = {1};
-  auto* goodVoxelsPtr = data.getDataAs<ArrayType>(goodVoxelsArrayPath);
-  auto& goodVoxels = goodVoxelsPtr->getDataStoreRef();
-
-  int64 totalPoints = static_cast<int64>(goodVoxelsPtr->getNumberOfTuples());
-
-  SizeVec3 udims = imageGeom->getDimensions();
-
-  int64 dims[3] = {
-      static_cast<int64>(udims[0]),
-      static_cast<int64>(udims[1]),
-      static_cast<int64>(udims[2]),
-  };
+  while(parents[index] != index)
+  {
+    parents[index] = parents[parents[index]];
+    index = parents[index];
+  }
+  return index;
+}
 
-  int64 neighpoints[6] = {0, 0, 0, 0, 0, 0};
-  int64 xp = dims[0];
-  int64 yp = dims[1];
-  int64 zp = dims[2];
-
-  neighpoints[0] = -(xp * yp);
-  neighpoints[1] = -xp;
-  neighpoints[2] = -1;
-  neighpoints[3] = 1;
-  neighpoints[4] = xp;
-  neighpoints[5] = (xp * yp);
-  std::vector<int64> currentvlist;
-  std::vector<bool> checked(totalPoints, false);
-  std::vector<bool> sample(totalPoints, false);
-  int64 biggestBlock = 0;
-  usize count = 0;
-  int32 good = 0;
-  int64 neighbor = 0;
-  int64 column = 0, row = 0, plane = 0;
-  int64 index = 0;
-
-  // In this loop over the data we are finding the biggest contiguous set of GoodVoxels and calling that the 'sample'  All GoodVoxels that do not touch the 'sample'
-  // are flipped to be called 'bad' voxels or 'not sample'
-  float threshold = 0.0f;
-  for(int64 i = 0; i < totalPoints; i++)
+void unite(std::vector<int64>& parents, int64 first, int64 second)
+{
+  first = findRoot(parents, first);
+  second = findRoot(parents, second);
+  if(first < second)
   {
-    float percentIncrement = static_cast<float>(i) / static_cast<float>(totalPoints) * 100.0f;
-    if(percentIncrement > threshold)
-    {
-      // std::string ss = fmt::format("{}% Scanned", static_cast<int32>(percentIncrement));
-      // filter->notifyStatusMessage(ss);
-      threshold = threshold + 5.0f;
-      if(threshold < percentIncrement)
-      {
-        threshold = percentIncrement;
-      }
-    }
+    parents[second] = first;
+  }
+  else if(second < first)
+  {
+    parents[first] = second;
+  }
+}
 
-    if(!checked[i] && goodVoxels.getValue(i))
+/**
+ * @brief Labels the face connected components of the voxels for which isMember returns true.
+ *
+ * The rows of the volume are split into slabs that are labeled in parallel with a union-find.
+ * The unions across slab boundaries and the final relabeling are cheap serial passes. Components
+ * are numbered in the order of their first voxel, which is the order a scan over the volume
+ * would discover them in.
+ * @param dims
+ * @param isMember
+ * @param labels Receives the component of each voxel or k_Unlabeled
+ * @return std::vector<usize> The number of voxels in each component
+ */
+template <typename PredicateT>
+std::vector<usize> labelComponents(const SizeVec3& dims, PredicateT isMember, std::vector<int64>& labels)
+{
+  const int64 xp = static_cast<int64>(dims[0]);
+  const int64 yp = static_cast<int64>(dims[1]);
+  const int64 numRows = yp * static_cast<int64>(dims[2]);
+  const int64 totalPoints = xp * numRows;
+  labels.resize(totalPoints);
+
+  const int64 numSlabs = std::max<int64>(1, std::min<int64>(numRows, 4 * std::max<int64>(ExecutionContext::Global().getMaxConcurrency(), 1)));
+  const int64 rowsPerSlab = (numRows + numSlabs - 1) / numSlabs;
+
+  // Union each voxel with its -X, -Y and -Z neighbors as long as they lie in the same slab
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, static_cast<usize>(numSlabs));
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize slab = range.min(); slab < range.max(); slab++)
     {
-      currentvlist.push_back(i);
-      count = 0;
-      while(count < currentvlist.size())
+      const int64 firstRow = static_cast<int64>(slab) * rowsPerSlab;
+      const int64 lastRow = std::min(numRows, firstRow + rowsPerSlab);
+      for(int64 row = firstRow; row < lastRow; row++)
       {
-        index = currentvlist[count];
-        column = index % xp;
-        row = (index / xp) % yp;
-        plane = index / (xp * yp);
-        for(int32 j = 0; j < 6; j++)
+        const bool hasYNeighbor = (row % yp) != 0 && row - 1 >= firstRow;
+        const bool hasZNeighbor = row - yp >= firstRow;
+        for(int64 column = 0; column < xp; column++)
         {
-          good = 1;
-          neighbor = index + neighpoints[j];
-          if(j == 0 && plane == 0)
-          {
-            good = 0;
-          }
-          if(j == 5 && plane == (zp - 1))
-          {
-            good = 0;
-          }
-          if(j == 1 && row == 0)
-          {
-            good = 0;
-          }
-          if(j == 4 && row == (yp - 1))
+          const int64 index = row * xp + column;
+          if(!isMember(index))
           {
-            good = 0;
+            labels[index] = k_Unlabeled;
+            continue;
           }
-          if(j == 2 && column == 0)
+          labels[index] = index;
+          if(column > 0 && labels[index - 1] != k_Unlabeled)
           {
-            good = 0;
+            unite(labels, index, index - 1);
           }
-          if(j == 3 && column == (xp - 1))
+          if(hasYNeighbor && labels[index - xp] != k_Unlabeled)
           {
-            good = 0;
+            unite(labels, index, index - xp);
           }
-          if(good == 1 && !checked[neighbor] && goodVoxels.getValue(neighbor))
+          if(hasZNeighbor && labels[index - xp * yp] != k_Unlabeled)
           {
-            currentvlist.push_back(neighbor);
-            checked[neighbor] = true;
+            unite(labels, index, index - xp * yp);
           }
         }
-        count++;
       }
-      if(static_cast<int64>(currentvlist.size()) >= biggestBlock)
+    }
+  });
+
+  // Join the components that cross a slab boundary. Only the first plane of rows in each
+  // slab has neighbors in an earlier slab.
+  for(int64 firstRow = rowsPerSlab; firstRow < numRows; firstRow += rowsPerSlab)
+  {
+    const int64 lastRow = std::min({numRows, firstRow + rowsPerSlab, firstRow + yp});
+    for(int64 row = firstRow; row < lastRow; row++)
+    {
+      const bool hasYNeighbor = row == firstRow && (row % yp) != 0;
+      const bool hasZNeighbor = row >= yp;
+      for(int64 column = 0; column < xp; column++)
       {
-        biggestBlock = currentvlist.size();
-        sample.assign(totalPoints, false);
-        for(int64 j = 0; j < biggestBlock; j++)
+        const int64 index = row * xp + column;
+        if(labels[index] == k_Unlabeled)
+        {
+          continue;
+        }
+        if(hasYNeighbor && labels[index - xp] != k_Unlabeled)
+        {
+          unite(labels, index, index - xp);
+        }
+        if(hasZNeighbor && labels[index - xp * yp] != k_Unlabeled)
         {
-          sample[currentvlist[j]] = true;
+          unite(labels, index, index - xp * yp);
         }
       }
-      currentvlist.clear();
     }
   }
-  for(int64 i = 0; i < totalPoints; i++)
+
+  // Replace the parents with component ids. Parents always have a smaller index so they
+  // are already relabeled when a voxel is reached. Relabeled voxels are stored as
+  // -(id + 2) until the pass is done so they can be told apart from voxel indices.
+  std::vector<usize> componentSizes;
+  for(int64 index = 0; index < totalPoints; index++)
   {
-    if(!sample[i] && goodVoxels.getValue(i))
+    const int64 parent = labels[index];
+    if(parent == k_Unlabeled)
+    {
+      continue;
+    }
+    if(parent == index)
+    {
+      labels[index] = -static_cast<int64>(componentSizes.size()) - 2;
+      componentSizes.push_back(1);
+    }
+    else
+    {
+      labels[index] = labels[parent];
+      componentSizes[-labels[index] - 2]++;
+    }
+  }
+
+  dataAlg.setRange(0, static_cast<usize>(totalPoints));
+  dataAlg.execute([&labels](const ComplexRange& range) {
+    for(usize index = range.min(); index < range.max(); index++)
     {
-      goodVoxels.setValue(i, false);
+      if(labels[index] != k_Unlabeled)
+      {
+        labels[index] = -labels[index] - 2;
+      }
     }
+  });
+
+  return componentSizes;
+}
+
+template <typename T>
+void _execute(DataStructure& data, const DataPath& imageGeomPath, const DataPath& goodVoxelsArrayPath, bool fillHoles, const std::atomic_bool& shouldCancel)
+{
+  using ArrayType = DataArray<T>;
+
+  auto* imageGeom = data.getDataAs<ImageGeom>(imageGeomPath);
+
+  auto* goodVoxelsPtr = data.getDataAs<ArrayType>(goodVoxelsArrayPath);
+  auto& goodVoxels = goodVoxelsPtr->getDataStoreRef();
+
+  const SizeVec3 udims = imageGeom->getDimensions();
+  const int64 xp = static_cast<int64>(udims[0]);
+  const int64 yp = static_cast<int64>(udims[1]);
+  const int64 zp = static_cast<int64>(udims[2]);
+  const usize totalPoints = udims[0] * udims[1] * udims[2];
+
+  // Find the biggest contiguous set of GoodVoxels and call that the 'sample'. When several
+  // sets share the biggest size the one found last by a scan over the volume wins.
+  std::vector<int64> labels;
+  std::vector<usize> componentSizes = labelComponents(udims, [&goodVoxels](int64 index) { return static_cast<bool>(goodVoxels.getValue(index)); }, labels);
+  if(shouldCancel)
+  {
+    return;
   }
-  sample.clear();
-  checked.assign(totalPoints, false);
 
-  // In this loop we are going to 'close' all of the 'holes' inside of the region already identified as the 'sample' if the user chose to do so.
-  // This is done by flipping all 'bad' voxel features that do not touch the outside of the sample (i.e. they are fully contained inside of the 'sample'.
-  threshold = 0.0F;
-  if(fillHoles)
+  int64 sampleId = k_Unlabeled;
+  usize biggestBlock = 0;
+  for(usize id = 0; id < componentSizes.size(); id++)
   {
-    bool touchesBoundary = false;
-    for(int64 i = 0; i < totalPoints; i++)
+    if(componentSizes[id] >= biggestBlock)
+    {
+      biggestBlock = componentSizes[id];
+      sampleId = static_cast<int64>(id);
+    }
+  }
+
+  // All GoodVoxels that do not touch the 'sample' are flipped to be called 'bad' voxels or 'not sample'
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalPoints);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize index = range.min(); index < range.max(); index++)
     {
-      float percentIncrement = static_cast<float>(i) / static_cast<float>(totalPoints) * 100.0f;
-      if(percentIncrement > threshold)
+      if(labels[index] != k_Unlabeled && labels[index] != sampleId)
       {
-        // std::string ss = fmt::format("{}% Filling Holes", static_cast<int32>(percentIncrement));
-        // filter->notifyStatusMessage(ss);
-        threshold = threshold + 5.0f;
-        if(threshold < percentIncrement)
-        {
-          threshold = percentIncrement;
-        }
+        goodVoxels.setValue(index, static_cast<T>(false));
       }
+    }
+  });
+
+  if(!fillHoles || shouldCancel)
+  {
+    return;
+  }
+
+  // 'Close' all of the 'holes' inside of the region identified as the 'sample'. These are
+  // the sets of 'bad' voxels that do not touch the outside of the volume.
+  componentSizes = labelComponents(udims, [&goodVoxels](int64 index) { return !static_cast<bool>(goodVoxels.getValue(index)); }, labels);
+  if(shouldCancel)
+  {
+    return;
+  }
 
-      if(!checked[i] && !goodVoxels.getValue(i))
+  std::vector<bool> touchesBoundary(componentSizes.size(), false);
+  auto markBoundary = [&](int64 column, int64 row, int64 plane) {
+    const int64 label = labels[(plane * yp + row) * xp + column];
+    if(label != k_Unlabeled)
+    {
+      touchesBoundary[label] = true;
+    }
+  };
+  for(int64 plane = 0; plane < zp; plane++)
+  {
+    const bool boundaryPlane = plane == 0 || plane == zp - 1;
+    for(int64 row = 0; row < yp; row++)
+    {
+      if(boundaryPlane || row == 0 || row == yp - 1)
       {
-        currentvlist.push_back(i);
-        count = 0;
-        touchesBoundary = false;
-        while(count < currentvlist.size())
-        {
-          index = currentvlist[count];
-          column = index % xp;
-          row = (index / xp) % yp;
-          plane = index / (xp * yp);
-          if(column == 0 || column == (xp - 1) || row == 0 || row == (yp - 1) || plane == 0 || plane == (zp - 1))
-          {
-            touchesBoundary = true;
-          }
-          for(int32 j = 0; j < 6; j++)
-          {
-            good = 1;
-            neighbor = index + neighpoints[j];
-            if(j == 0 && plane == 0)
-            {
-              good = 0;
-            }
-            if(j == 5 && plane == (zp - 1))
-            {
-              good = 0;
-            }
-            if(j == 1 && row == 0)
-            {
-              good = 0;
-            }
-            if(j == 4 && row == (yp - 1))
-            {
-              good = 0;
-            }
-            if(j == 2 && column == 0)
-            {
-              good = 0;
-            }
-            if(j == 3 && column == (xp - 1))
-            {
-              good = 0;
-            }
-            if(good == 1 && !checked[neighbor] && !goodVoxels.getValue(neighbor))
-            {
-              currentvlist.push_back(neighbor);
-              checked[neighbor] = true;
-            }
-          }
-          count++;
-        }
-        if(!touchesBoundary)
+        for(int64 column = 0; column < xp; column++)
         {
-          for(usize j = 0; j < currentvlist.size(); j++)
-          {
-            goodVoxels.setValue(currentvlist[j], true);
-          }
+          markBoundary(column, row, plane);
         }
-        currentvlist.clear();
+      }
+      else
+      {
+        markBoundary(0, row, plane);
+        markBoundary(xp - 1, row, plane);
       }
     }
   }
-  checked.clear();
+
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize index = range.min(); index < range.max(); index++)
+    {
+      if(labels[index] != k_Unlabeled && !touchesBoundary[labels[index]])
+      {
+        goodVoxels.setValue(index, static_cast<T>(true));
+      }
+    }
+  });
 }
 
 int16 getArrayType(const IDataArray* inputData)
@@ -326,11 +380,11 @@ Result<> IdentifySample::executeImpl(DataStructure& data, const Arguments& args,
 
   if(arrayType == 1)
   {
-    _execute<bool>(data, imageGeomPath, goodVoxelsArrayPath, fillHoles);
+    _execute<bool>(data, imageGeomPath, goodVoxelsArrayPath, fillHoles, shouldCancel);
   }
   if(arrayType == 2)
   {
-    _execute<uint8>(data, imageGeomPath, goodVoxelsArrayPath, fillHoles);
+    _execute<uint8>(data, imageGeomPath, goodVoxelsArrayPath, fillHoles, shouldCancel);
   }
 
   return {};
@@ -3,19 +3,20 @@
 #include "complex/Common/TypeTraits.hpp"
 #include "complex/DataStructure/AbstractDataStore.hpp"
 #include "complex/DataStructure/Geometry/ImageGeom.hpp"
+#include "complex/Parameters/BoolParameter.hpp"
 #include "complex/Parameters/ChoicesParameter.hpp"
 #include "complex/Parameters/GeometrySelectionParameter.hpp"
 #include "complex/Parameters/MultiArraySelectionParameter.hpp"
 #include "complex/Parameters/NumberParameter.hpp"
 #include "complex/Parameters/VectorParameter.hpp"
+#include "complex/Utilities/CounterBasedRandom.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
 
 #include <fmt/core.h>
 
 #include <array>
 #include <chrono>
 #include <limits>
-#include <random>
-#include <thread>
 
 using namespace complex;
 
@@ -75,29 +76,9 @@ std::optional<Error> CheckInitialization(const IDataArray& dataArray, Initialize
   return {};
 }
 
-template <class T>
-auto CreateRandomGenerator(T rangeMin, T rangeMax)
-{
-  std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-  std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  generator.seed(seed);
-
-  if constexpr(std::is_integral_v<T>)
-  {
-    std::uniform_int_distribution<> distribution(rangeMin, rangeMax);
-    return std::make_pair(distribution, generator);
-  }
-  else if constexpr(std::is_floating_point_v<T>)
-  {
-    std::uniform_real_distribution<T> distribution(rangeMin, rangeMax);
-    return std::make_pair(distribution, generator);
-  }
-}
-
 template <class T>
 void InitializeArray(IDataArray& dataArray, const std::array<usize, 3>& dims, uint64 xMin, uint64 xMax, uint64 yMin, uint64 yMax, uint64 zMin, uint64 zMax, InitializeData::InitType initType,
-                     float64 initValue, const RangeType& initRange)
+                     float64 initValue, const RangeType& initRange, const Philox4x32& generator, uint64 stream)
 {
   T rangeMin;
   T rangeMax;
@@ -114,29 +95,32 @@ void InitializeArray(IDataArray& dataArray, const std::array<usize, 3>& dims, ui
 
   auto& dataStore = dataArray.getIDataStoreRefAs<AbstractDataStore<T>>();
 
-  auto&& [distribution, generator] = CreateRandomGenerator(rangeMin, rangeMax);
-
-  for(uint64 k = zMin; k < zMax + 1; k++)
-  {
-    for(uint64 j = yMin; j < yMax + 1; j++)
+  // Each random value is drawn from the index of its cell, so the planes can be filled in any order
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(zMin, zMax + 1);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(uint64 k = range.min(); k < range.max(); k++)
     {
-      for(uint64 i = xMin; i < xMax + 1; i++)
+      for(uint64 j = yMin; j < yMax + 1; j++)
       {
-        usize index = (k * dims[0] * dims[1]) + (j * dims[0]) + i;
-
-        if(initType == InitializeData::InitType::Manual)
+        for(uint64 i = xMin; i < xMax + 1; i++)
         {
-          T num = static_cast<T>(initValue);
-          dataStore.fillTuple(index, num);
-        }
-        else
-        {
-          T randNum = distribution(generator);
-          dataStore.fillTuple(index, randNum);
+          usize index = (k * dims[0] * dims[1]) + (j * dims[0]) + i;
+
+          if(initType == InitializeData::InitType::Manual)
+          {
+            T num = static_cast<T>(initValue);
+            dataStore.fillTuple(index, num);
+          }
+          else
+          {
+            T randNum = CounterBasedRandom::UniformValue<T>(generator(index, stream), rangeMin, rangeMax);
+            dataStore.fillTuple(index, randNum);
+          }
         }
       }
     }
-  }
+  });
 }
 } // namespace
 
@@ -173,8 +157,12 @@ Parameters InitializeData::parameters() const
   params.insertLinkableParameter(std::make_unique<ChoicesParameter>(k_InitType_Key, "Initialization Type", "", 0, ChoicesParameter::Choices{"Manual", "Random", "Random With Range"}));
   params.insert(std::make_unique<Float64Parameter>(k_InitValue_Key, "Initialization Value", "", 0.0f));
   params.insert(std::make_unique<VectorFloat64Parameter>(k_InitRange_Key, "Initialization Range", "", VectorFloat64Parameter::ValueType{0.0, 0.0}));
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseSeed_Key, "Use Seed for Random Generation",
+                                                                 "When true the user will be able to put in a seed for random generation so that the initialized values are reproducible", false));
+  params.insert(std::make_unique<UInt64Parameter>(k_SeedValue_Key, "Seed", "The seed fed into the random generator", 0));
   params.linkParameters(k_InitType_Key, k_InitValue_Key, std::make_any<ChoicesParameter::ValueType>(0));
   params.linkParameters(k_InitType_Key, k_InitRange_Key, std::make_any<ChoicesParameter::ValueType>(2));
+  params.linkParameters(k_UseSeed_Key, k_SeedValue_Key, std::make_any<bool>(true));
   return params;
 }
 
@@ -379,8 +367,21 @@ Result<> InitializeData::executeImpl(DataStructure& data, const Arguments& args,
 
   std::array<usize, 3> dims = imageGeom.getDimensions().toArray();
 
-  for(const DataPath& path : cellArrayPaths)
+  uint64 seed = args.value<uint64>(k_SeedValue_Key);
+  if(!args.value<bool>(k_UseSeed_Key))
+  {
+    seed = static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+  }
+  if(initType != InitType::Manual)
   {
+    messageHandler(IFilter::Message::Type::Info, fmt::format("Initializing {} arrays using seed {}", cellArrayPaths.size(), seed));
+  }
+  // Every array draws from its own stream of the same generator
+  const Philox4x32 generator(seed);
+
+  for(usize stream = 0; stream < cellArrayPaths.size(); stream++)
+  {
+    const DataPath& path = cellArrayPaths[stream];
     IDataArray& dataArray = data.getDataRefAs<IDataArray>(path);
 
     DataType type = dataArray.getDataType();
@@ -388,55 +389,49 @@ Result<> InitializeData::executeImpl(DataStructure& data, const Arguments& args,
     switch(type)
     {
     case DataType::int8: {
-      InitializeArray<int8>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<int8>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     case DataType::int16: {
-      InitializeArray<int16>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<int16>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     case DataType::int32: {
-      InitializeArray<int32>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<int32>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     case DataType::int64: {
-      InitializeArray<int64>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<int64>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     case DataType::uint8: {
-      InitializeArray<uint8>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<uint8>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     case DataType::uint16: {
-      InitializeArray<uint16>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<uint16>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     case DataType::uint32: {
-      InitializeArray<uint32>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<uint32>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     case DataType::uint64: {
-      InitializeArray<uint64>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<uint64>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     case DataType::float32: {
-      InitializeArray<float32>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<float32>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     case DataType::float64: {
-      InitializeArray<float32>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMin, initType, initValue, initRange);
+      InitializeArray<float64>(dataArray, dims, xMin, xMax, yMin, yMax, zMin, zMax, initType, initValue, initRange, generator, stream);
       break;
     }
     default: {
       throw std::runtime_error(fmt::format("InitializeData: Invalid array type for '{}'", path.toString()));
     }
     }
-
-    // Delay the execution by 1 second to avoid the exact same seedings for each array
-    {
-      using namespace std::chrono_literals;
-      std::this_thread::sleep_for(1s);
-    }
   }
 
   return {};
@@ -28,6 +28,8 @@ public:
   static inline constexpr StringLiteral k_InitType_Key = "init_type";
   static inline constexpr StringLiteral k_InitValue_Key = "init_value";
   static inline constexpr StringLiteral k_InitRange_Key = "init_range";
+  static inline constexpr StringLiteral k_UseSeed_Key = "use_seed";
+  static inline constexpr StringLiteral k_SeedValue_Key = "seed_value";
 
   enum class InitType : uint64
   {
@@ -1,6 +1,10 @@
 #include "InterpolatePointCloudToRegularGridFilter.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <limits>
+#include <optional>
 
 #include "complex/DataStructure/DataArray.hpp"
 #include "complex/DataStructure/Geometry/ImageGeom.hpp"
@@ -20,6 +24,9 @@
 #include "complex/Parameters/NumberParameter.hpp"
 #include "complex/Parameters/NumericTypeParameter.hpp"
 #include "complex/Parameters/VectorParameter.hpp"
+#include "complex/Utilities/CountingSort.hpp"
+#include "complex/Utilities/FilterUtilities.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
 
 namespace complex
 {
@@ -28,6 +35,10 @@ namespace
 constexpr int64 k_MissingVertexGeom = -24500;
 constexpr int64 k_MissingImageGeom = -24501;
 
+// The values of the output mode parameter
+constexpr uint64 k_NeighborListOutput = 0;
+constexpr uint64 k_DenseCellOutput = 1;
+
 template <typename T>
 void mapPointCloudDataByKernel(IDataArray* source, INeighborList* dynamic, std::vector<float>& kernelVals, int64 kernel[3], usize dims[3], usize curX, usize curY, usize curZ, usize vertIdx)
 {
@@ -177,6 +188,217 @@ void mapKernelDistances(NeighborList<float32>* kernelDistances, std::vector<floa
     }
   }
 }
+
+/**
+ * @brief Lists the points that fall into each cell of the image geometry. The point ids of
+ * cell i are stored at [offsets[i], offsets[i + 1]) of pointIds in ascending order, which lets
+ * every cell gather its kernel neighborhood without any per cell allocations.
+ */
+struct CellPointBins
+{
+  std::vector<usize> offsets;
+  std::vector<usize> pointIds;
+};
+
+/**
+ * @brief The kernel half widths (in cells) and the image dimensions that the gather kernels work on.
+ */
+struct KernelWindow
+{
+  int64 halfSize[3] = {0, 0, 0};
+  int64 dims[3] = {0, 0, 0};
+};
+
+/**
+ * @brief Calls func(kernelIndex, neighborCell) for every cell of the kernel centered on the
+ * given cell that lies within the image.
+ */
+template <typename FuncT>
+void forEachKernelCell(const KernelWindow& window, usize cell, FuncT&& func)
+{
+  const int64 x = static_cast<int64>(cell) % window.dims[0];
+  const int64 y = (static_cast<int64>(cell) / window.dims[0]) % window.dims[1];
+  const int64 z = static_cast<int64>(cell) / (window.dims[0] * window.dims[1]);
+  const int64 kernelDims[3] = {2 * window.halfSize[0] + 1, 2 * window.halfSize[1] + 1, 2 * window.halfSize[2] + 1};
+
+  for(int64 dz = -window.halfSize[2]; dz <= window.halfSize[2]; dz++)
+  {
+    const int64 nz = z + dz;
+    if(nz < 0 || nz >= window.dims[2])
+    {
+      continue;
+    }
+    for(int64 dy = -window.halfSize[1]; dy <= window.halfSize[1]; dy++)
+    {
+      const int64 ny = y + dy;
+      if(ny < 0 || ny >= window.dims[1])
+      {
+        continue;
+      }
+      for(int64 dx = -window.halfSize[0]; dx <= window.halfSize[0]; dx++)
+      {
+        const int64 nx = x + dx;
+        if(nx < 0 || nx >= window.dims[0])
+        {
+          continue;
+        }
+        const usize kernelIndex = static_cast<usize>(((dz + window.halfSize[2]) * kernelDims[1] + (dy + window.halfSize[1])) * kernelDims[0] + (dx + window.halfSize[0]));
+        const usize neighborCell = static_cast<usize>((nz * window.dims[1] + ny) * window.dims[0] + nx);
+        func(kernelIndex, neighborCell);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Computes the kernel weighted average of the points around every cell. Each task
+ * only writes the cells of its own range, so no synchronization is needed.
+ */
+template <typename T, typename OutT>
+class InterpolateByKernelImpl
+{
+public:
+  InterpolateByKernelImpl(const IDataArray& source, IDataArray& output, const CellPointBins& bins, const KernelWindow& window, const std::vector<float32>& kernelValues,
+                          const std::atomic_bool& shouldCancel)
+  : m_Source(dynamic_cast<const DataArray<T>&>(source).getDataStoreRef())
+  , m_Output(dynamic_cast<DataArray<OutT>&>(output).getDataStoreRef())
+  , m_Bins(bins)
+  , m_Window(window)
+  , m_KernelValues(kernelValues)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const ComplexRange& range) const
+  {
+    for(usize cell = range.min(); cell < range.max(); cell++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      float64 weightedSum = 0.0;
+      float64 totalWeight = 0.0;
+      forEachKernelCell(m_Window, cell, [&](usize kernelIndex, usize neighborCell) {
+        const float64 weight = m_KernelValues[kernelIndex];
+        if(weight == 0.0)
+        {
+          return;
+        }
+        for(usize i = m_Bins.offsets[neighborCell]; i < m_Bins.offsets[neighborCell + 1]; i++)
+        {
+          weightedSum += weight * static_cast<float64>(m_Source[m_Bins.pointIds[i]]);
+          totalWeight += weight;
+        }
+      });
+      m_Output[cell] = totalWeight > 0.0 ? static_cast<OutT>(weightedSum / totalWeight) : static_cast<OutT>(0);
+    }
+  }
+
+private:
+  const AbstractDataStore<T>& m_Source;
+  AbstractDataStore<OutT>& m_Output;
+  const CellPointBins& m_Bins;
+  const KernelWindow& m_Window;
+  const std::vector<float32>& m_KernelValues;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Copies the value of the point in the closest occupied cell of the kernel. Ties are
+ * broken by the lower point index so the result does not depend on the thread count.
+ */
+template <typename T>
+class CopyNearestByKernelImpl
+{
+public:
+  CopyNearestByKernelImpl(const IDataArray& source, IDataArray& output, const CellPointBins& bins, const KernelWindow& window, const std::vector<float32>& kernelDistances,
+                          const std::atomic_bool& shouldCancel)
+  : m_Source(dynamic_cast<const DataArray<T>&>(source).getDataStoreRef())
+  , m_Output(dynamic_cast<DataArray<T>&>(output).getDataStoreRef())
+  , m_Bins(bins)
+  , m_Window(window)
+  , m_KernelDistances(kernelDistances)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const ComplexRange& range) const
+  {
+    for(usize cell = range.min(); cell < range.max(); cell++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      float32 bestDistance = std::numeric_limits<float32>::max();
+      std::optional<usize> bestPoint;
+      forEachKernelCell(m_Window, cell, [&](usize kernelIndex, usize neighborCell) {
+        const float32 distance = m_KernelDistances[kernelIndex];
+        const usize begin = m_Bins.offsets[neighborCell];
+        if(begin == m_Bins.offsets[neighborCell + 1] || distance > bestDistance)
+        {
+          return;
+        }
+        const usize pointId = m_Bins.pointIds[begin];
+        if(!bestPoint.has_value() || distance < bestDistance || pointId < *bestPoint)
+        {
+          bestDistance = distance;
+          bestPoint = pointId;
+        }
+      });
+      if(bestPoint.has_value())
+      {
+        m_Output[cell] = m_Source[*bestPoint];
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<T>& m_Source;
+  AbstractDataStore<T>& m_Output;
+  const CellPointBins& m_Bins;
+  const KernelWindow& m_Window;
+  const std::vector<float32>& m_KernelDistances;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+struct InterpolateByKernelFunctor
+{
+  template <typename T>
+  void operator()(const IDataArray& source, IDataArray& output, const CellPointBins& bins, const KernelWindow& window, const std::vector<float32>& kernelValues, const std::atomic_bool& shouldCancel)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, output.getNumberOfTuples());
+    if(output.getDataType() == DataType::float64)
+    {
+      dataAlg.execute(InterpolateByKernelImpl<T, float64>(source, output, bins, window, kernelValues, shouldCancel));
+    }
+    else
+    {
+      dataAlg.execute(InterpolateByKernelImpl<T, float32>(source, output, bins, window, kernelValues, shouldCancel));
+    }
+  }
+};
+
+struct CopyNearestByKernelFunctor
+{
+  template <typename T>
+  void operator()(const IDataArray& source, IDataArray& output, const CellPointBins& bins, const KernelWindow& window, const std::vector<float32>& kernelDistances, const std::atomic_bool& shouldCancel)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, output.getNumberOfTuples());
+    dataAlg.execute(CopyNearestByKernelImpl<T>(source, output, bins, window, kernelDistances, shouldCancel));
+  }
+};
+
+/**
+ * @brief Returns the type of the dense array that holds the interpolated values of the source type.
+ */
+DataType getInterpolatedDataType(DataType sourceType)
+{
+  return sourceType == DataType::float64 ? DataType::float64 : DataType::float32;
+}
 } // namespace
 
 std::string InterpolatePointCloudToRegularGridFilter::name() const
@@ -203,7 +425,10 @@ Parameters InterpolatePointCloudToRegularGridFilter::parameters() const
 {
   Parameters params;
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseMask_Key, "Use Mask", "Specifies whether or not to use a mask array", true));
-  params.insert(std::make_unique<BoolParameter>(k_StoreKernelDistances_Key, "Store Kernel Distances", "Specifies whether or not to store kernel distances", true));
+  params.insert(std::make_unique<BoolParameter>(k_StoreKernelDistances_Key, "Store Kernel Distances", "Specifies whether or not to store kernel distances", false));
+  params.insert(std::make_unique<ChoicesParameter>(k_OutputMode_Key, "Output Mode",
+                                                   "Neighbor Lists stores every kernel weighted value that reaches each cell. Dense Cell Arrays stores one reduced value per cell",
+                                                   k_NeighborListOutput, std::vector<std::string>{"Neighbor Lists", "Dense Cell Arrays"}));
   params.insert(std::make_unique<ChoicesParameter>(k_InterpolationTechnique_Key, "Interpolation Technique", "Selected Interpolation Technique", 0, std::vector<std::string>{"Uniform", "Gaussian"}));
 
   params.insert(std::make_unique<VectorFloat32Parameter>(k_KernelSize_Key, "Kernel Size", "Specifies the kernel size", std::vector<float32>{0, 0, 0}, std::vector<std::string>{"x", "y", "z"}));
@@ -244,6 +469,7 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
 
   auto useMask = args.value<bool>(k_UseMask_Key);
   auto storeKernelDistances = args.value<bool>(k_StoreKernelDistances_Key);
+  auto outputMode = args.value<uint64>(k_OutputMode_Key);
 
   auto maskArrayPath = args.value<DataPath>(k_Mask_Key);
 
@@ -276,6 +502,12 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
     return {nonstd::make_unexpected(std::vector<Error>{Error{-11000, ss}})};
   }
 
+  if(outputMode != k_NeighborListOutput && outputMode != k_DenseCellOutput)
+  {
+    std::string ss = fmt::format("Output Mode must be 0 [Neighbor Lists] or 1 [Dense Cell Arrays]");
+    return {nonstd::make_unexpected(std::vector<Error>{Error{-11003, ss}})};
+  }
+
   if(kernelSize[0] < 0 || kernelSize[1] < 0 || kernelSize[2] < 0)
   {
     std::string ss = fmt::format("All kernel dimensions must be positive.\n "
@@ -320,14 +552,21 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
   // If we are in a vertex attribute matrix, create data arrays for all in the new interpolated data attribute matrix
   // Else, we are in a feature/ensemble attribute matrix, and just deep copy it into the new data container
 
-  const usize cDims = 1;
+  // The Neighbor Lists mode copies the selected arrays and collects every kernel weighted value of a cell in a
+  // NeighborList. The Dense Cell Arrays mode reduces them into arrays with one tuple per cell instead.
+  SizeVec3 imageDims = image->getDimensions();
+  std::vector<usize> cellTupleShape = {imageDims[2], imageDims[1], imageDims[0]};
+  usize numCells = image->getNumberOfElements();
 
   for(const auto& interpolatePath : interpolatedDataPaths)
   {
     auto targetArray = data.getDataAs<IDataArray>(interpolatePath);
     auto targetPath = interpolatedGroupPath.createChildPath(targetArray->getName());
-    auto copyAction = std::make_unique<CopyArrayInstanceAction>(interpolatePath, targetPath);
-    actions.actions.push_back(std::move(copyAction));
+    if(outputMode == k_NeighborListOutput)
+    {
+      auto copyAction = std::make_unique<CopyArrayInstanceAction>(interpolatePath, targetPath);
+      actions.actions.push_back(std::move(copyAction));
+    }
 
     dataArrays.push_back(targetArray);
     auto tmpDims = targetArray->getNumberOfComponents();
@@ -337,10 +576,15 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
       return {nonstd::make_unexpected(std::vector<Error>{Error{-11002, ss}})};
     }
     auto dataType = targetArray->getDataType();
-    if(dataType != DataType::boolean)
+    if(outputMode == k_DenseCellOutput)
+    {
+      auto createArrayAction = std::make_unique<CreateArrayAction>(getInterpolatedDataType(dataType), cellTupleShape, std::vector<usize>{1}, targetPath);
+      actions.actions.push_back(std::move(createArrayAction));
+    }
+    else if(dataType != DataType::boolean)
     {
       auto neighborPath = interpolatedGroupPath.createChildPath(targetArray->getName() + " Neighbors");
-      auto neighborAction = std::make_unique<CreateNeighborListAction>(dataType, targetArray->getNumberOfTuples(), neighborPath);
+      auto neighborAction = std::make_unique<CreateNeighborListAction>(dataType, numCells, neighborPath);
       actions.actions.push_back(std::move(neighborAction));
     }
   }
@@ -349,8 +593,11 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
   {
     auto targetArray = data.getDataAs<IDataArray>(copyPath);
     auto targetPath = interpolatedGroupPath.createChildPath(targetArray->getName());
-    auto copyAction = std::make_unique<CopyArrayInstanceAction>(copyPath, targetPath);
-    actions.actions.push_back(std::move(copyAction));
+    if(outputMode == k_NeighborListOutput)
+    {
+      auto copyAction = std::make_unique<CopyArrayInstanceAction>(copyPath, targetPath);
+      actions.actions.push_back(std::move(copyAction));
+    }
 
     dataArrays.push_back(targetArray);
     auto tmpDims = targetArray->getNumberOfComponents();
@@ -360,10 +607,15 @@ IFilter::PreflightResult InterpolatePointCloudToRegularGridFilter::preflightImpl
       return {nonstd::make_unexpected(std::vector<Error>{Error{-11002, ss}})};
     }
     auto dataType = targetArray->getDataType();
-    if(dataType != DataType::boolean)
+    if(outputMode == k_DenseCellOutput)
+    {
+      auto createArrayAction = std::make_unique<CreateArrayAction>(dataType, cellTupleShape, std::vector<usize>{1}, targetPath);
+      actions.actions.push_back(std::move(createArrayAction));
+    }
+    else if(dataType != DataType::boolean)
     {
       auto neighborPath = interpolatedGroupPath.createChildPath(targetArray->getName() + " Neighbors");
-      auto neighborAction = std::make_unique<CreateNeighborListAction>(dataType, targetArray->getNumberOfTuples(), neighborPath);
+      auto neighborAction = std::make_unique<CreateNeighborListAction>(dataType, numCells, neighborPath);
       actions.actions.push_back(std::move(neighborAction));
     }
   }
@@ -412,6 +664,7 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
 
   auto useMask = args.value<bool>(k_UseMask_Key);
   auto storeKernelDistances = args.value<bool>(k_StoreKernelDistances_Key);
+  auto outputMode = args.value<uint64>(k_OutputMode_Key);
   auto maskPath = args.value<DataPath>(k_Mask_Key);
   auto voxelIndicesPath = args.value<DataPath>(k_VoxelIndices_Key);
 
@@ -436,8 +689,11 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
 
   std::vector<float32> kernel;
 
-  auto maskArray = data.getDataAs<BoolArray>(maskPath);
-  auto mask = maskArray->getDataStore();
+  const AbstractDataStore<bool>* mask = nullptr;
+  if(useMask)
+  {
+    mask = data.getDataAs<BoolArray>(maskPath)->getDataStore();
+  }
 
   auto voxelIndicesArray = data.getDataAs<DataArray<usize>>(voxelIndicesPath);
   auto voxelIndices = voxelIndicesArray->getDataStore();
@@ -478,64 +734,135 @@ Result<> InterpolatePointCloudToRegularGridFilter::executeImpl(DataStructure& da
   std::vector<float> uniformKernel(totalKernel, 1.0f);
 
   std::vector<float32> kernelValDistances;
-  if(storeKernelDistances)
+  if(storeKernelDistances || (outputMode == k_DenseCellOutput && !copyDataPaths.empty()))
   {
     kernelValDistances.resize(totalKernel);
     std::fill(kernelValDistances.begin(), kernelValDistances.end(), 0.0f);
     determineKernelDistances(kernelValDistances, kernelNumVoxels, res);
   }
 
-  usize progIncrement = numVerts / 100;
-  usize prog = 1;
-  usize progressInt = 0;
+  // Look up the cell of every point in parallel. Masked points get a key past the last cell.
+  const usize numCells = image->getNumberOfElements();
+  std::vector<usize> pointCells(numVerts);
+  std::atomic_bool hasInvalidIndex = false;
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numVerts);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize i = range.min(); i < range.max(); i++)
+      {
+        if(useMask && !mask->getValue(i))
+        {
+          pointCells[i] = numCells;
+          continue;
+        }
+        pointCells[i] = voxelIndices->getValue(i);
+        if(pointCells[i] > maxImageIndex)
+        {
+          hasInvalidIndex = true;
+        }
+      }
+    });
+  }
+  if(hasInvalidIndex)
+  {
+    index = *std::find_if(pointCells.cbegin(), pointCells.cend(), [&](usize cell) { return cell > maxImageIndex && cell != numCells; });
+    std::string ss = fmt::format("Index present in the selected Voxel Indices array that falls outside the selected Image Geometry for interpolation.\n Index = {}\n Max Image Index = {}\n", index,
+                                 maxImageIndex);
+    return {nonstd::make_unexpected(std::vector<Error>{Error{-1, ss}})};
+  }
 
-  for(usize i = 0; i < numVerts; i++)
+  messageHandler("Interpolating Point Cloud...");
+  if(outputMode == k_DenseCellOutput)
   {
-    if(useMask)
+    // Bin the points by their cell so that every cell can gather its kernel neighborhood
+    // directly instead of every point scattering into the cells around it
+    CellPointBins bins;
+    CountingSort::GroupByKey(pointCells, numCells, bins.offsets, bins.pointIds);
+
+    KernelWindow window;
+    for(usize i = 0; i < 3; i++)
     {
-      if(!mask->getValue(i))
+      window.halfSize[i] = kernelNumVoxels[i];
+      window.dims[i] = static_cast<int64>(dims[i]);
+    }
+
+    for(const auto& interpolatedDataPathItem : interpolatedDataPaths)
+    {
+      const auto& sourceArray = data.getDataRefAs<IDataArray>(interpolatedDataPathItem);
+      auto& interpolatedArray = data.getDataRefAs<IDataArray>(interpolatedDataPath.createChildPath(sourceArray.getName()));
+      ExecuteDataFunction(InterpolateByKernelFunctor{}, sourceArray.getDataType(), sourceArray, interpolatedArray, bins, window, kernel, shouldCancel);
+    }
+    for(const auto& copyDataPath : copyDataPaths)
+    {
+      const auto& sourceArray = data.getDataRefAs<IDataArray>(copyDataPath);
+      auto& copiedArray = data.getDataRefAs<IDataArray>(interpolatedDataPath.createChildPath(sourceArray.getName()));
+      ExecuteDataFunction(CopyNearestByKernelFunctor{}, sourceArray.getDataType(), sourceArray, copiedArray, bins, window, kernelValDistances, shouldCancel);
+    }
+  }
+
+  if(shouldCancel || (outputMode != k_NeighborListOutput && !storeKernelDistances))
+  {
+    return {};
+  }
+
+  // The NeighborList outputs keep every kernel weighted value of each cell
+  std::vector<std::pair<IDataArray*, INeighborList*>> interpolatedNeighborLists;
+  std::vector<std::pair<IDataArray*, INeighborList*>> copiedNeighborLists;
+  if(outputMode == k_NeighborListOutput)
+  {
+    for(const auto& interpolatedDataPathItem : interpolatedDataPaths)
+    {
+      auto* interpolatedArray = data.getDataAs<IDataArray>(interpolatedDataPathItem);
+      auto* neighborList = data.getDataAs<INeighborList>(interpolatedDataPath.createChildPath(interpolatedArray->getName() + " Neighbors"));
+      if(neighborList != nullptr)
       {
-        continue;
+        interpolatedNeighborLists.emplace_back(interpolatedArray, neighborList);
       }
     }
-    index = voxelIndices->getValue(i);
-    if(index > maxImageIndex)
+    for(const auto& copyDataPath : copyDataPaths)
     {
-      std::string ss = fmt::format("Index present in the selected Voxel Indices array that falls outside the selected Image Geometry for interpolation.\n Index = %1\n Max Image Index = %2\n", index,
-                                   maxImageIndex);
-      return {nonstd::make_unexpected(std::vector<Error>{Error{-1, ss}})};
+      auto* copyArray = data.getDataAs<IDataArray>(copyDataPath);
+      auto* neighborList = data.getDataAs<INeighborList>(interpolatedDataPath.createChildPath(copyArray->getName() + " Neighbors"));
+      if(neighborList != nullptr)
+      {
+        copiedNeighborLists.emplace_back(copyArray, neighborList);
+      }
+    }
+  }
+  FloatNeighborListType* kernelDistances = nullptr;
+  if(storeKernelDistances)
+  {
+    kernelDistances = data.getDataAs<FloatNeighborListType>(kernelDistancesDataPath.createChildPath("Neighbor List"));
+  }
+
+  usize progIncrement = numVerts / 100;
+  usize prog = 1;
+  usize progressInt = 0;
+
+  for(usize i = 0; i < numVerts; i++)
+  {
+    index = pointCells[i];
+    if(index == numCells)
+    {
+      continue;
     }
     x = index % dims[0];
     y = (index / dims[0]) % dims[1];
     z = index / (dims[0] * dims[1]);
 
-    if(!interpolatedDataPaths.empty())
+    for(const auto& [interpolatedArray, neighborList] : interpolatedNeighborLists)
     {
-      for(const auto& interpolatedDataPathItem : interpolatedDataPaths)
-      {
-        auto parentPath = interpolatedDataPathItem.getParent();
-        auto dynamicArrayPath = parentPath.createChildPath(interpolatedDataPathItem.getTargetName() + "Neighbors");
-        auto* dynamicArrayToInterpolate = data.getDataAs<INeighborList>(dynamicArrayPath);
-        auto* interpolatedArray = data.getDataAs<IDataArray>(interpolatedDataPathItem);
-        mapPointCloudDataByKernel(interpolatedArray, dynamicArrayToInterpolate, kernel, kernelNumVoxels, dims.data(), x, y, z, i);
-      }
+      mapPointCloudDataByKernel(interpolatedArray, neighborList, kernel, kernelNumVoxels, dims.data(), x, y, z, i);
     }
 
-    if(copyDataPaths.size() > 0)
+    for(const auto& [copyArray, neighborList] : copiedNeighborLists)
     {
-      for(const auto& copyDataPath : copyDataPaths)
-      {
-        auto dynamicArrayPath = interpolatedDataPath.createChildPath(copyDataPath.getTargetName() + " Neighbors");
-        auto* dynamicArrayToCopy = data.getDataAs<INeighborList>(dynamicArrayPath);
-        auto* copyArray = data.getDataAs<IDataArray>(copyDataPath);
-        mapPointCloudDataByKernel(copyArray, dynamicArrayToCopy, uniformKernel, kernelNumVoxels, dims.data(), x, y, z, i);
-      }
+      mapPointCloudDataByKernel(copyArray, neighborList, uniformKernel, kernelNumVoxels, dims.data(), x, y, z, i);
     }
 
-    if(storeKernelDistances)
+    if(kernelDistances != nullptr)
     {
-      auto kernelDistancesNeighborsPath = kernelDistancesDataPath.createChildPath("Neighbor List");
-      auto kernelDistances = data.getDataAs<FloatNeighborListType>(kernelDistancesNeighborsPath);
       mapKernelDistances(kernelDistances, kernelValDistances, kernelNumVoxels, dims.data(), x, y, z);
     }
 
@@ -11,8 +11,8 @@
 #include "complex/Parameters/BoolParameter.hpp"
 #include "complex/Parameters/DataPathSelectionParameter.hpp"
 #include "complex/Parameters/NumberParameter.hpp"
-
-#include "ComplexCore/utils/nanoflann.hpp"
+#include "complex/Utilities/KdTreeIndex.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
 
 namespace complex
 {
@@ -22,46 +22,7 @@ constexpr int32 k_MissingMovingVertex = -4500;
 constexpr int32 k_MissingTargetVertex = -4501;
 constexpr int32 k_BadNumIterations = -4502;
 constexpr int32 k_MissingVertices = -4503;
-
-template <typename Derived>
-struct VertexGeomAdaptor
-{
-  const Derived& obj;
-  Float32Array* verts;
-  size_t m_NumComponents = 0;
-  size_t m_NumTuples = 0;
-
-  VertexGeomAdaptor(const Derived& obj_)
-  : obj(obj_)
-  {
-    // These values never change for the life time of this object so cache them now.
-    verts = derived()->getVertices();
-    m_NumComponents = verts->getNumberOfComponents();
-    m_NumTuples = verts->getNumberOfTuples();
-  }
-
-  inline const Derived& derived() const
-  {
-    return obj;
-  }
-
-  inline usize kdtree_get_point_count() const
-  {
-    return m_NumTuples;
-  }
-
-  inline float kdtree_get_pt(const usize idx, const usize dim) const
-  {
-    auto offset = idx * m_NumComponents;
-    return (*verts)[offset + dim];
-  }
-
-  template <class BBOX>
-  bool kdtree_get_bbox(BBOX& /*bb*/) const
-  {
-    return false;
-  }
-};
+constexpr int32 k_EmptyTargetVertex = -4504;
 } // namespace
 
 std::string IterativeClosestPointFilter::name() const
@@ -116,11 +77,17 @@ IFilter::PreflightResult IterativeClosestPointFilter::preflightImpl(const DataSt
     auto ss = fmt::format("Moving Vertex Geometry not found at path: {}", movingVertexPath.toString());
     return {nonstd::make_unexpected(std::vector<Error>{Error{k_MissingMovingVertex, ss}})};
   }
-  if(data.getDataAs<VertexGeom>(targetVertexPath) == nullptr)
+  const auto* targetVertexGeom = data.getDataAs<VertexGeom>(targetVertexPath);
+  if(targetVertexGeom == nullptr)
   {
     auto ss = fmt::format("Target Vertex Geometry not found at path: {}", targetVertexPath.toString());
     return {nonstd::make_unexpected(std::vector<Error>{Error{k_MissingTargetVertex, ss}})};
   }
+  if(targetVertexGeom->getVertices() != nullptr && targetVertexGeom->getNumberOfVertices() == 0)
+  {
+    auto ss = fmt::format("Target Vertex Geometry at path '{}' has no vertices to match against", targetVertexPath.toString());
+    return {nonstd::make_unexpected(std::vector<Error>{Error{k_EmptyTargetVertex, ss}})};
+  }
 
   if(numIterations < 1)
   {
@@ -170,6 +137,11 @@ Result<> IterativeClosestPointFilter::executeImpl(DataStructure& data, const Arg
     auto ss = fmt::format("Target Vertex Geometry does not contain a vertex array");
     return {nonstd::make_unexpected(std::vector<Error>{Error{k_MissingVertices, ss}})};
   }
+  if(targetVertexGeom->getNumberOfVertices() == 0)
+  {
+    auto ss = fmt::format("Target Vertex Geometry at path '{}' has no vertices to match against", targetVertexPath.toString());
+    return {nonstd::make_unexpected(std::vector<Error>{Error{k_EmptyTargetVertex, ss}})};
+  }
 
   auto* movingPtr = movingVertexGeom->getVertices();
   Float32Array& targetPtr = *(targetVertexGeom->getVertices());
@@ -183,17 +155,16 @@ Result<> IterativeClosestPointFilter::executeImpl(DataStructure& data, const Arg
   std::vector<float32> dynTarget(numMovingVerts * 3, 0.0F);
   float* dynTargetPtr = dynTarget.data();
 
-  using Adaptor = VertexGeomAdaptor<VertexGeom*>;
-  const Adaptor adaptor(targetVertexGeom);
-
   messageHandler("Building kd-tree index...");
 
-  using KDtree = nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Adaptor<float32, Adaptor>, Adaptor, 3>;
-  KDtree index(3, adaptor, nanoflann::KDTreeSingleIndexAdaptorParams(30));
-  index.buildIndex();
+  if(targetVertexGeom->findKdTree() < 0)
+  {
+    auto ss = fmt::format("Unable to build the kd-tree index for the Target Vertex Geometry");
+    return {nonstd::make_unexpected(std::vector<Error>{Error{k_MissingVertices, ss}})};
+  }
+  const KdTreeIndex& index = *(targetVertexGeom->getKdTree());
 
   usize iters = numIterations;
-  const usize nn = 1;
 
   typedef Eigen::Matrix<float, 3, Eigen::Dynamic, Eigen::ColMajor> PointCloud;
   typedef Eigen::Matrix<float, 4, 4, Eigen::ColMajor> UmeyamaTransform;
@@ -213,17 +184,18 @@ Result<> IterativeClosestPointFilter::executeImpl(DataStructure& data, const Arg
       return {};
     }
 
-    for(usize j = 0; j < numMovingVerts; j++)
-    {
-      usize id;
-      float dist;
-      nanoflann::KNNResultSet<float> results(nn);
-      results.init(&id, &dist);
-      index.findNeighbors(results, movingCopyPtr + (3 * j), nanoflann::SearchParams());
-      dynTargetPtr[3 * j + 0] = targetPtr[3 * id + 0];
-      dynTargetPtr[3 * j + 1] = targetPtr[3 * id + 1];
-      dynTargetPtr[3 * j + 2] = targetPtr[3 * id + 2];
-    }
+    // Each moving vertex is matched against the shared target index independently
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numMovingVerts);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize j = range.min(); j < range.max(); j++)
+      {
+        const usize id = *index.findNearest(Point3Df(movingCopyPtr[3 * j + 0], movingCopyPtr[3 * j + 1], movingCopyPtr[3 * j + 2]));
+        dynTargetPtr[3 * j + 0] = targetPtr[3 * id + 0];
+        dynTargetPtr[3 * j + 1] = targetPtr[3 * id + 1];
+        dynTargetPtr[3 * j + 2] = targetPtr[3 * id + 2];
+      }
+    });
 
     Eigen::Map<PointCloud> moving_(movingCopyPtr, 3, numMovingVerts);
     Eigen::Map<PointCloud> target_(dynTargetPtr, 3, numMovingVerts);
@@ -262,6 +234,8 @@ Result<> IterativeClosestPointFilter::executeImpl(DataStructure& data, const Arg
         (*movingPtr)[3 * j + k] = transformedPosition.data()[k];
       }
     }
+    movingVertexGeom->deleteKdTree();
+    movingVertexGeom->deleteVertexBins();
   }
 
   globalTransform.transposeInPlace();
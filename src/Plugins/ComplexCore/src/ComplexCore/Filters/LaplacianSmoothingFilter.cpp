@@ -70,9 +70,14 @@ Parameters LaplacianSmoothingFilter::parameters() const
   params.insert(std::make_unique<Float32Parameter>(k_SurfaceTripleLineLambda_Key, "Outer Triple Line Lambda", "Value of λ for triple lines that lie on the outer surface of the volume", 0.0f));
   params.insert(
       std::make_unique<Float32Parameter>(k_SurfaceQuadPointLambda_Key, "Outer Quadruple Points Lambda", "Value of λ for the quadruple Points that lie on the outer surface of the volume.", 0.0f));
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseConvergenceTolerance_Key, "Stop at Convergence Tolerance",
+                                                                 "Stop iterating early once no vertex moves further than the tolerance during an iteration", false));
+  params.insert(std::make_unique<Float32Parameter>(k_ConvergenceTolerance_Key, "Convergence Tolerance", "The largest distance a vertex may move during an iteration for the mesh to be converged",
+                                                   0.0001f));
 
   // Associate the Linkable Parameter(s) to the children parameters that they control
   params.linkParameters(k_UseTaubinSmoothing_Key, k_MuFactor_Key, true);
+  params.linkParameters(k_UseConvergenceTolerance_Key, k_ConvergenceTolerance_Key, true);
 
   return params;
 }
@@ -101,6 +106,8 @@ IFilter::PreflightResult LaplacianSmoothingFilter::preflightImpl(const DataStruc
   auto pSurfacePointLambdaValue = filterArgs.value<float32>(k_SurfacePointLambda_Key);
   auto pSurfaceTripleLineLambdaValue = filterArgs.value<float32>(k_SurfaceTripleLineLambda_Key);
   auto pSurfaceQuadPointLambdaValue = filterArgs.value<float32>(k_SurfaceQuadPointLambda_Key);
+  auto pUseConvergenceToleranceValue = filterArgs.value<bool>(k_UseConvergenceTolerance_Key);
+  auto pConvergenceToleranceValue = filterArgs.value<float32>(k_ConvergenceTolerance_Key);
   auto pSurfaceMeshNodeTypeArrayPathValue = filterArgs.value<DataPath>(k_SurfaceMeshNodeTypeArrayPath_Key);
 
   // If your filter is making structural changes to the DataStructure then the filter
@@ -114,6 +121,11 @@ IFilter::PreflightResult LaplacianSmoothingFilter::preflightImpl(const DataStruc
   // the std::vector<PreflightValue> object.
   std::vector<PreflightValue> preflightUpdatedValues;
 
+  if(pUseConvergenceToleranceValue && pConvergenceToleranceValue <= 0.0f)
+  {
+    return {MakeErrorResult<OutputActions>(-562, fmt::format("The Convergence Tolerance must be greater than 0 but {} was given.", pConvergenceToleranceValue))};
+  }
+
   // Return both the resultOutputActions and the preflightUpdatedValues via std::move()
   return {std::move(resultOutputActions), std::move(preflightUpdatedValues)};
 }
@@ -134,6 +146,8 @@ Result<> LaplacianSmoothingFilter::executeImpl(DataStructure& dataStructure, con
   inputValues.pSurfacePointLambda = filterArgs.value<float32>(k_SurfacePointLambda_Key);
   inputValues.pSurfaceTripleLineLambda = filterArgs.value<float32>(k_SurfaceTripleLineLambda_Key);
   inputValues.pSurfaceQuadPointLambda = filterArgs.value<float32>(k_SurfaceQuadPointLambda_Key);
+  inputValues.pUseConvergenceTolerance = filterArgs.value<bool>(k_UseConvergenceTolerance_Key);
+  inputValues.pConvergenceTolerance = filterArgs.value<float32>(k_ConvergenceTolerance_Key);
   inputValues.pSurfaceMeshNodeTypeArrayPath = filterArgs.value<DataPath>(k_SurfaceMeshNodeTypeArrayPath_Key);
 
   // Let the Algorithm instance do the work
@@ -34,6 +34,8 @@ public:
   static inline constexpr StringLiteral k_SurfacePointLambda_Key = "SurfacePointLambda";
   static inline constexpr StringLiteral k_SurfaceTripleLineLambda_Key = "SurfaceTripleLineLambda";
   static inline constexpr StringLiteral k_SurfaceQuadPointLambda_Key = "SurfaceQuadPointLambda";
+  static inline constexpr StringLiteral k_UseConvergenceTolerance_Key = "UseConvergenceTolerance";
+  static inline constexpr StringLiteral k_ConvergenceTolerance_Key = "ConvergenceTolerance";
   static inline constexpr StringLiteral k_SurfaceMeshNodeTypeArrayPath_Key = "SurfaceMeshNodeTypeArrayPath";
   static inline constexpr StringLiteral k_SurfaceMeshFaceLabelsArrayPath_Key = "SurfaceMeshFaceLabelsArrayPath";
 
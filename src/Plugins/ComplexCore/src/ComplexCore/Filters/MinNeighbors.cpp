@@ -8,6 +8,7 @@
 #include "complex/Parameters/GeometrySelectionParameter.hpp"
 #include "complex/Parameters/MultiArraySelectionParameter.hpp"
 #include "complex/Parameters/NumberParameter.hpp"
+#include "complex/Utilities/NeighborFill.hpp"
 
 namespace complex
 {
@@ -20,175 +21,18 @@ void assignBadPoints(DataStructure& data, const Arguments& args)
 {
   auto imageGeomPath = args.value<DataPath>(MinNeighbors::k_ImageGeom_Key);
   auto featureIdsPath = args.value<DataPath>(MinNeighbors::k_FeatureIds_Key);
-  auto numNeighborsPath = args.value<DataPath>(MinNeighbors::k_NumNeighbors_Key);
   auto voxelArrayPaths = args.value<std::vector<DataPath>>(MinNeighbors::k_VoxelArrays_Key);
 
   auto& featureIdsArray = data.getDataRefAs<Int32Array>(featureIdsPath);
-  auto& numNeighborsArray = data.getDataRefAs<Int32Array>(numNeighborsPath);
-
-  auto& featureIds = featureIdsArray.getDataStoreRef();
 
-  auto applyToSinglePhase = args.value<bool>(MinNeighbors::k_ApplyToSinglePhase_Key);
-  Int32Array* featurePhasesArray = nullptr;
-  if(applyToSinglePhase)
-  {
-    auto featurePhasesPath = args.value<DataPath>(MinNeighbors::k_FeaturePhases_Key);
-    featurePhasesArray = data.getDataAs<Int32Array>(featurePhasesPath);
-  }
-  std::vector<std::reference_wrapper<IDataArray>> voxelArrays;
+  std::vector<IDataArray*> voxelArrays;
   for(const auto& arrayPath : voxelArrayPaths)
   {
-    voxelArrays.push_back(data.getDataRefAs<IDataArray>(arrayPath));
+    voxelArrays.push_back(data.getDataAs<IDataArray>(arrayPath));
   }
 
-  usize totalPoints = featureIdsArray.getNumberOfTuples();
   SizeVec3 udims = data.getDataRefAs<ImageGeom>(imageGeomPath).getDimensions();
-
-  std::array<int64, 3> dims = {
-      static_cast<int64>(udims[0]),
-      static_cast<int64>(udims[1]),
-      static_cast<int64>(udims[2]),
-  };
-
-  Int32DataStore neighbors(IDataStore::ShapeType{totalPoints}, IDataStore::ShapeType{1}, -1);
-
-  int32 good = 1;
-  int32 current = 0;
-  int32 most = 0;
-  int64 neighpoint = 0;
-  usize numfeatures = numNeighborsArray.getNumberOfTuples();
-
-  int64 neighpoints[6] = {0, 0, 0, 0, 0, 0};
-  neighpoints[0] = -dims[0] * dims[1];
-  neighpoints[1] = -dims[0];
-  neighpoints[2] = -1;
-  neighpoints[3] = 1;
-  neighpoints[4] = dims[0];
-  neighpoints[5] = dims[0] * dims[1];
-
-  usize counter = 1;
-  int64 count = 0;
-  int64 kstride = 0, jstride = 0;
-  int32 featurename = 0, feature = 0;
-  int32 neighbor = 0;
-  std::vector<int32> n(numfeatures + 1, 0);
-  while(counter != 0)
-  {
-    counter = 0;
-    for(int64 k = 0; k < dims[2]; k++)
-    {
-      kstride = dims[0] * dims[1] * k;
-      for(int64 j = 0; j < dims[1]; j++)
-      {
-        jstride = dims[0] * j;
-        for(int64 i = 0; i < dims[0]; i++)
-        {
-          count = kstride + jstride + i;
-          featurename = featureIds[count];
-          if(featurename < 0)
-          {
-            counter++;
-            current = 0;
-            most = 0;
-            for(int32 l = 0; l < 6; l++)
-            {
-              good = 1;
-              neighpoint = count + neighpoints[l];
-              if(l == 0 && k == 0)
-              {
-                good = 0;
-              }
-              if(l == 5 && k == (dims[2] - 1))
-              {
-                good = 0;
-              }
-              if(l == 1 && j == 0)
-              {
-                good = 0;
-              }
-              if(l == 4 && j == (dims[1] - 1))
-              {
-                good = 0;
-              }
-              if(l == 2 && i == 0)
-              {
-                good = 0;
-              }
-              if(l == 3 && i == (dims[0] - 1))
-              {
-                good = 0;
-              }
-              if(good == 1)
-              {
-                feature = featureIds[neighpoint];
-                if(feature >= 0)
-                {
-                  n[feature]++;
-                  current = n[feature];
-                  if(current > most)
-                  {
-                    most = current;
-                    neighbors[count] = neighpoint;
-                  }
-                }
-              }
-            }
-            for(int32 l = 0; l < 6; l++)
-            {
-              good = 1;
-              neighpoint = count + neighpoints[l];
-              if(l == 0 && k == 0)
-              {
-                good = 0;
-              }
-              if(l == 5 && k == (dims[2] - 1))
-              {
-                good = 0;
-              }
-              if(l == 1 && j == 0)
-              {
-                good = 0;
-              }
-              if(l == 4 && j == (dims[1] - 1))
-              {
-                good = 0;
-              }
-              if(l == 2 && i == 0)
-              {
-                good = 0;
-              }
-              if(l == 3 && i == (dims[0] - 1))
-              {
-                good = 0;
-              }
-              if(good == 1)
-              {
-                feature = featureIds[neighpoint];
-                if(feature >= 0)
-                {
-                  n[feature] = 0;
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-
-    // TODO This can be parallelized much like NeighborOrientationCorrelation
-    for(usize j = 0; j < totalPoints; j++)
-    {
-      featurename = featureIds[j];
-      neighbor = neighbors[j];
-      if(featurename < 0 && neighbor >= 0 && featureIds[neighbor] >= 0)
-      {
-        for(const auto& voxelArray : voxelArrays)
-        {
-          voxelArray.get().copyTuple(neighbor, j);
-        }
-      }
-    }
-  }
+  NeighborFill::FillBadCells(featureIdsArray, udims, voxelArrays);
 }
 
 nonstd::expected<std::vector<bool>, Error> mergeContainedFeatures(DataStructure& data, const Arguments& args)
@@ -1,7 +1,7 @@
 #include "PointSampleTriangleGeometryFilter.hpp"
 
 #include "complex/DataStructure/DataPath.hpp"
-#include "complex/Filter/Actions/CopyArrayInstanceAction.hpp"
+#include "complex/Filter/Actions/CreateArrayAction.hpp"
 #include "complex/Filter/Actions/CreateDataGroupAction.hpp"
 #include "complex/Filter/Actions/CreateVertexGeometryAction.hpp"
 #include "complex/Parameters/ArrayCreationParameter.hpp"
@@ -58,6 +58,9 @@ Parameters PointSampleTriangleGeometryFilter::parameters() const
   // Create the parameter descriptors that are needed for this filter
   // params.insertLinkableParameter(std::make_unique<ChoicesParameter>(k_SamplesNumberType_Key, "Source for Number of Samples", "", 0, ChoicesParameter::Choices{"Manual", "Other Geometry"}));
   params.insert(std::make_unique<Int32Parameter>(k_NumberOfSamples_Key, "Number of Sample Points", "The number of sample points to use", 1000));
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseSeed_Key, "Use Seed for Random Generation",
+                                                                 "When true the user will be able to put in a seed for random generation so that the sampled points are reproducible", false));
+  params.insert(std::make_unique<UInt64Parameter>(k_SeedValue_Key, "Seed", "The seed fed into the random generator", 0));
   params.insert(std::make_unique<DataPathSelectionParameter>(k_TriangleGeometry_Key, "Triangle Geometry to Sample", "The complete path to the triangle Geometry from which to sample", DataPath{}));
   // params.insert(std::make_unique<DataPathSelectionParameter>(k_ParentGeometry_Key, "Source Geometry for Number of Sample Points", "", DataPath{}, true));
   params.insertLinkableParameter(
@@ -84,6 +87,7 @@ Parameters PointSampleTriangleGeometryFilter::parameters() const
   //  params.linkParameters(k_SamplesNumberType_Key, k_NumberOfSamples_Key, 0);
   //  params.linkParameters(k_SamplesNumberType_Key, k_ParentGeometry_Key, 1);
   params.linkParameters(k_UseMask_Key, k_MaskArrayPath_Key, true);
+  params.linkParameters(k_UseSeed_Key, k_SeedValue_Key, true);
 
   return params;
 }
@@ -130,6 +134,11 @@ IFilter::PreflightResult PointSampleTriangleGeometryFilter::preflightImpl(const
   // the std::vector<PreflightValue> object.
   std::vector<PreflightValue> preflightUpdatedValues;
 
+  if(pNumberOfSamples < 1)
+  {
+    return {MakeErrorResult<OutputActions>(-504, fmt::format("The Number of Sample Points must be at least 1 but {} was given.", pNumberOfSamples))};
+  }
+
   // Create the Vertex Geometry action and store it
   {
     auto createVertexGeometryAction = std::make_unique<CreateVertexGeometryAction>(pVertexGeometryDataPath, pNumberOfSamples);
@@ -141,17 +150,24 @@ IFilter::PreflightResult PointSampleTriangleGeometryFilter::preflightImpl(const
     auto createDataGroupAction = std::make_unique<CreateDataGroupAction>(pVertexGroupDataPath);
     resultOutputActions.value().actions.push_back(std::move(createDataGroupAction));
   }
-  // Create all the target DataArray based on the Selected Node Arrays
+  // Collect all the errors
+  std::vector<Error> errors;
+
+  // Create all the target DataArray based on the Selected Face Arrays. There is one tuple per sampled point.
   for(const auto& selectedDataPath : pSelectedDataArrayPaths)
   {
+    const auto* selectedArray = dataStructure.getDataAs<IDataArray>(selectedDataPath);
+    if(nullptr == selectedArray)
+    {
+      errors.push_back(Error{-501, fmt::format("The selected Face Attribute Array '{}' does not exist.", selectedDataPath.toString())});
+      continue;
+    }
     DataPath createdDataPath = pVertexGroupDataPath.createChildPath(selectedDataPath.getTargetName());
-    auto createArrayAction = std::make_unique<CopyArrayInstanceAction>(selectedDataPath, createdDataPath);
+    auto createArrayAction = std::make_unique<CreateArrayAction>(selectedArray->getDataType(), std::vector<usize>{static_cast<usize>(pNumberOfSamples)},
+                                                                 selectedArray->getIDataStoreRef().getComponentShape(), createdDataPath);
     resultOutputActions.value().actions.push_back(std::move(createArrayAction));
   }
 
-  // Collect all the errors
-  std::vector<Error> errors;
-
   // Ensure that if pMaskValue is TRUE that the Mask Path is valid
   if(pUseMask)
   {
@@ -184,6 +200,8 @@ Result<> PointSampleTriangleGeometryFilter::executeImpl(DataStructure& dataStruc
 
   inputs.pNumberOfSamples = filterArgs.value<int32>(k_NumberOfSamples_Key);
   inputs.pUseMask = filterArgs.value<bool>(k_UseMask_Key);
+  inputs.pUseSeed = filterArgs.value<bool>(k_UseSeed_Key);
+  inputs.pSeedValue = filterArgs.value<uint64>(k_SeedValue_Key);
   inputs.pTriangleGeometry = filterArgs.value<DataPath>(k_TriangleGeometry_Key);
   inputs.pTriangleAreasArrayPath = filterArgs.value<DataPath>(k_TriangleAreasArrayPath_Key);
   inputs.pMaskArrayPath = filterArgs.value<DataPath>(k_MaskArrayPath_Key);
@@ -28,6 +28,8 @@ public:
   // static inline constexpr StringLiteral k_SamplesNumberType_Key = "SamplesNumberType";
   static inline constexpr StringLiteral k_NumberOfSamples_Key = "NumberOfSamples";
   static inline constexpr StringLiteral k_UseMask_Key = "UseMask";
+  static inline constexpr StringLiteral k_UseSeed_Key = "UseSeed";
+  static inline constexpr StringLiteral k_SeedValue_Key = "SeedValue";
   static inline constexpr StringLiteral k_TriangleGeometry_Key = "TriangleGeometryPath";
   // static inline constexpr StringLiteral k_ParentGeometry_Key = "ParentGeometry";
   static inline constexpr StringLiteral k_TriangleAreasArrayPath_Key = "TriangleAreasArrayPath";
@@ -9,7 +9,8 @@
 #include "complex/Parameters/DataGroupCreationParameter.hpp"
 #include "complex/Parameters/GeometrySelectionParameter.hpp"
 #include "complex/Parameters/MultiArraySelectionParameter.hpp"
-#include "complex/Utilities/FilterUtilities.hpp"
+#include "complex/Utilities/StreamCompaction.hpp"
+#include "complex/Utilities/TupleCopier.hpp"
 
 #include <fmt/format.h>
 
@@ -22,29 +23,6 @@ namespace
 constexpr int32 k_VertexGeomNotFound = -277;
 constexpr int32 k_ArrayNotFound = -278;
 constexpr int32 k_TupleShapeNotOneDim = -279;
-
-struct RemoveFlaggedVerticesFunctor
-{
-  // copy data to masked geometry
-  template <class T>
-  void operator()(IDataArray& inputDataPtr, IDataArray& maskedDataPtr, const std::vector<int64>& maskPoints) const
-  {
-    auto& inputData = dynamic_cast<DataArray<T>&>(inputDataPtr);
-    auto& maskedData = dynamic_cast<DataArray<T>&>(maskedDataPtr);
-    maskedData.getDataStore()->reshapeTuples({maskPoints.size()});
-    usize nComps = inputData.getNumberOfComponents();
-
-    for(usize i = 0; i < maskPoints.size(); i++)
-    {
-      for(usize compIdx = 0; compIdx < nComps; compIdx++)
-      {
-        usize destinationIndex = nComps * i + compIdx;
-        usize sourceIndex = nComps * maskPoints[i] + compIdx;
-        maskedData[destinationIndex] = inputData[sourceIndex];
-      }
-    }
-  }
-};
 } // namespace
 
 namespace complex
@@ -176,36 +154,24 @@ Result<> RemoveFlaggedVertices::executeImpl(DataStructure& data, const Arguments
   auto& mask = data.getDataRefAs<BoolArray>(maskArrayPath);
 
   size_t numMaskTuples = mask.getSize();
-  size_t trueCount = std::count(mask.begin(), mask.end(), true);
-  std::vector<int64> trueIndices(trueCount);
-  size_t trueIndex = 0;
-  for(int64 i = 0; i < numMaskTuples; i++)
-  {
-    if(mask[i])
-    {
-      trueIndices[trueIndex++] = i;
-    }
-  }
+  std::vector<int64> trueIndices = StreamCompaction::SelectIndices<int64>(numMaskTuples, [&mask](usize index) { return mask[index]; });
+  size_t trueCount = trueIndices.size();
 
   VertexGeom& reducedVertex = data.getDataRefAs<VertexGeom>(reducedVertexPath);
   reducedVertex.resizeVertexList(trueCount);
 
-  for(size_t i = 0; i < trueCount; i++)
-  {
-    Point3D<float> coords = std::move(vertex.getCoords(trueIndices[i]));
-    reducedVertex.setCoords(i, coords);
-  }
-
-  std::vector<usize> tDims = {trueIndices.size()};
-
+  // Gather the coordinates and the selected arrays of the flagged vertices in a single pass
+  TupleCopier tupleCopier;
+  tupleCopier.addArrays(*vertex.getVertices(), *reducedVertex.getVertices());
   for(const auto& targetArrayPath : targetArrayPaths)
   {
     DataPath destinationPath = reducedVertexPath.createChildPath(targetArrayPath.getTargetName());
     auto& src = data.getDataRefAs<IDataArray>(targetArrayPath);
     auto& dest = data.getDataRefAs<IDataArray>(destinationPath);
-
-    ExecuteDataFunction(RemoveFlaggedVerticesFunctor{}, src.getDataType(), src, dest, trueIndices);
+    dest.getIDataStore()->reshapeTuples({trueCount});
+    tupleCopier.addArrays(src, dest);
   }
+  tupleCopier.gather(nonstd::span<const int64>(trueIndices.data(), trueIndices.size()));
 
   return {};
 }
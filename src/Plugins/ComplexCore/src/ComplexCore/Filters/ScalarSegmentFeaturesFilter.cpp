@@ -71,6 +71,10 @@ Parameters ScalarSegmentFeaturesFilter::parameters() const
   params.insertSeparator(Parameters::Separator{"Segmentation Parameters"});
   params.insert(std::make_unique<NumberParameter<int>>(k_ScalarToleranceKey, "Scalar Tolerance", "Tolerance for segmenting input Cell Data", 1));
   params.insert(std::make_unique<BoolParameter>(k_RandomizeFeatures_Key, "Randomize Feature IDs", "Specifies if feature IDs should be randomized during calculations", false));
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseSeed_Key, "Use Seed for Random Generation",
+                                                                 "When true the user will be able to put in a seed for random generation so that the randomized feature IDs are reproducible", false));
+  params.insert(std::make_unique<UInt64Parameter>(k_SeedValue_Key, "Seed", "The seed fed into the random generator", 0));
+  params.linkParameters(k_UseSeed_Key, k_SeedValue_Key, std::make_any<bool>(true));
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseGoodVoxelsKey, "Use Mask Array", "Determines if a mask array is used for segmenting", false));
   params.insert(std::make_unique<ArraySelectionParameter>(k_GoodVoxelsPath_Key, "Mask", "Path to the DataArray Mask", DataPath(), ArraySelectionParameter::AllowedTypes{DataType::boolean}));
   params.linkParameters(k_UseGoodVoxelsKey, k_GoodVoxelsPath_Key, std::make_any<bool>(true));
@@ -180,6 +184,8 @@ Result<> ScalarSegmentFeaturesFilter::executeImpl(DataStructure& data, const Arg
   inputValues.pInputDataPath = args.value<DataPath>(k_InputArrayPathKey);
   inputValues.pScalarTolerance = args.value<int>(k_ScalarToleranceKey);
   inputValues.pShouldRandomizeFeatureIds = args.value<bool>(k_RandomizeFeatures_Key);
+  inputValues.pUseSeed = args.value<bool>(k_UseSeed_Key);
+  inputValues.pSeedValue = args.value<uint64>(k_SeedValue_Key);
   inputValues.pActiveArrayPath = args.value<DataPath>(k_ActiveArrayPathKey);
   inputValues.pFeatureIdsPath = args.value<DataPath>(k_FeatureIdsPathKey);
   inputValues.pUseGoodVoxels = args.value<bool>(k_UseGoodVoxelsKey);
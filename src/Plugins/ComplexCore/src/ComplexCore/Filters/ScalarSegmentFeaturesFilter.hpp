@@ -37,6 +37,8 @@ public:
   // static inline constexpr StringLiteral k_CellFeaturePathKey = "cell feature group path";
   static inline constexpr StringLiteral k_ActiveArrayPathKey = "active array path";
   static inline constexpr StringLiteral k_RandomizeFeatures_Key = "randomize features";
+  static inline constexpr StringLiteral k_UseSeed_Key = "use seed";
+  static inline constexpr StringLiteral k_SeedValue_Key = "seed value";
 
   /**
    * @brief Returns the filter's name.
@@ -1,10 +1,13 @@
 #include <catch2/catch.hpp>
 
+#include "complex/DataStructure/EmptyDataStore.hpp"
+#include "complex/DataStructure/Geometry/ImageGeom.hpp"
 #include "complex/DataStructure/Geometry/TriangleGeom.hpp"
 #include "complex/Parameters/ArrayCreationParameter.hpp"
 #include "complex/Parameters/ChoicesParameter.hpp"
 #include "complex/Parameters/DynamicTableParameter.hpp"
 #include "complex/Parameters/FileSystemPathParameter.hpp"
+#include "complex/Parameters/StringParameter.hpp"
 #include "complex/Parameters/VectorParameter.hpp"
 #include "complex/UnitTest/UnitTestCommon.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5FileWriter.hpp"
@@ -396,3 +399,113 @@ TEST_CASE("ComplexCore::ApplyTransformationToGeometryFilter_Precomputed", "[Comp
   herr_t err = dataGraph.writeHdf5(fileWriter);
   REQUIRE(err >= 0);
 }
+
+TEST_CASE("ComplexCore::ApplyTransformationToGeometryFilter_ImageGeom", "[ComplexCore][ApplyTransformationToGeometryFilter]")
+{
+  const std::string imageGeomName = "Image Geometry";
+  const std::string transformedGeomName = "Transformed Image Geometry";
+  const std::string cellDataName = "Cell Data";
+  const SizeVec3 dims = {4, 3, 2};
+  const usize numCells = dims[0] * dims[1] * dims[2];
+
+  DataStructure dataGraph;
+  auto* imageGeom = ImageGeom::Create(dataGraph, imageGeomName);
+  imageGeom->setDimensions(dims);
+  imageGeom->setOrigin({1.0f, 2.0f, 3.0f});
+  imageGeom->setSpacing({0.5f, 1.0f, 2.0f});
+  auto* ids = Int32Array::CreateWithStore<Int32DataStore>(dataGraph, "Ids", {dims[2], dims[1], dims[0]}, {1}, imageGeom->getId());
+  auto* ramp = Float32Array::CreateWithStore<Float32DataStore>(dataGraph, "Ramp", {dims[2], dims[1], dims[0]}, {1}, imageGeom->getId());
+  for(usize i = 0; i < numCells; i++)
+  {
+    (*ids)[i] = static_cast<int32>(i);
+    (*ramp)[i] = static_cast<float32>(i % dims[0]);
+  }
+
+  const DataPath geometryPath({imageGeomName});
+  const DataPath transformedGeomPath({transformedGeomName});
+  ApplyTransformationToGeometryFilter filter;
+  Arguments args;
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_GeometryToTransform_Key, std::make_any<DataPath>(geometryPath));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TransformType_Key, std::make_any<complex::ChoicesParameter::ValueType>(5));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_Scale_Key, std::make_any<complex::VectorFloat32Parameter::ValueType>({2.0F, 2.0F, 2.0F}));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_ResampleImageGeometry_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_CellArrays_Key,
+                      std::make_any<std::vector<DataPath>>(std::vector<DataPath>{geometryPath.createChildPath("Ids"), geometryPath.createChildPath("Ramp")}));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TransformedImageGeometry_Key, std::make_any<DataPath>(transformedGeomPath));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TransformedCellDataName_Key, std::make_any<StringParameter::ValueType>(cellDataName));
+
+  // Doubling the size keeps the spacing, so every source cell becomes a block of 2x2x2 cells
+  SECTION("Nearest neighbor")
+  {
+    args.insertOrAssign(ApplyTransformationToGeometryFilter::k_InterpolationType_Key, std::make_any<complex::ChoicesParameter::ValueType>(0));
+  }
+  SECTION("Linear")
+  {
+    args.insertOrAssign(ApplyTransformationToGeometryFilter::k_InterpolationType_Key, std::make_any<complex::ChoicesParameter::ValueType>(1));
+  }
+  const bool linear = args.value<complex::ChoicesParameter::ValueType>(ApplyTransformationToGeometryFilter::k_InterpolationType_Key) == 1;
+
+  auto preflightResult = filter.preflight(dataGraph, args);
+  COMPLEX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+  auto executeResult = filter.execute(dataGraph, args);
+  COMPLEX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  const auto& transformedGeom = dataGraph.getDataRefAs<ImageGeom>(transformedGeomPath);
+  const SizeVec3 transformedDims = transformedGeom.getDimensions();
+  REQUIRE(transformedDims[0] == 8);
+  REQUIRE(transformedDims[1] == 6);
+  REQUIRE(transformedDims[2] == 4);
+  REQUIRE(transformedGeom.getOrigin()[0] == Approx(2.0f));
+  REQUIRE(transformedGeom.getOrigin()[1] == Approx(4.0f));
+  REQUIRE(transformedGeom.getOrigin()[2] == Approx(6.0f));
+  REQUIRE(transformedGeom.getSpacing()[2] == Approx(2.0f));
+
+  const auto& transformedIds = dataGraph.getDataRefAs<Int32Array>(transformedGeomPath.createChildPath(cellDataName).createChildPath("Ids"));
+  const auto& transformedRamp = dataGraph.getDataRefAs<Float32Array>(transformedGeomPath.createChildPath(cellDataName).createChildPath("Ramp"));
+  REQUIRE(transformedIds.getNumberOfTuples() == 8 * 6 * 4);
+  for(usize z = 0; z < transformedDims[2]; z++)
+  {
+    for(usize y = 0; y < transformedDims[1]; y++)
+    {
+      for(usize x = 0; x < transformedDims[0]; x++)
+      {
+        const usize index = (z * transformedDims[1] + y) * transformedDims[0] + x;
+        // Integer arrays always take the nearest source cell
+        REQUIRE(transformedIds[index] == static_cast<int32>(((z / 2) * dims[1] + y / 2) * dims[0] + x / 2));
+        // Cell x samples the source at x / 2 - 0.25, where the ramp is linear between the clamped border cells
+        const float32 expectedRamp = linear ? std::clamp(static_cast<float32>(x) / 2.0f - 0.25f, 0.0f, 3.0f) : static_cast<float32>(x / 2);
+        REQUIRE(transformedRamp[index] == Approx(expectedRamp));
+      }
+    }
+  }
+}
+
+TEST_CASE("ComplexCore::ApplyTransformationToGeometryFilter_ImageGeomPrecomputedPreflight", "[ComplexCore][ApplyTransformationToGeometryFilter]")
+{
+  const std::string imageGeomName = "Image Geometry";
+  const SizeVec3 dims = {4, 3, 2};
+
+  DataStructure dataGraph;
+  auto* imageGeom = ImageGeom::Create(dataGraph, imageGeomName);
+  imageGeom->setDimensions(dims);
+  // A matrix created by an earlier filter holds no values during preflight
+  Float32Array::Create(dataGraph, "Matrix", std::make_shared<EmptyDataStore<float32>>(std::vector<usize>{16}, std::vector<usize>{1}));
+
+  const DataPath geometryPath({imageGeomName});
+  const DataPath transformedGeomPath({"Transformed Image Geometry"});
+  ApplyTransformationToGeometryFilter filter;
+  Arguments args;
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_GeometryToTransform_Key, std::make_any<DataPath>(geometryPath));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TransformType_Key, std::make_any<complex::ChoicesParameter::ValueType>(1));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_ComputedTransformationMatrix_Key, std::make_any<DataPath>(DataPath({"Matrix"})));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_ResampleImageGeometry_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TransformedImageGeometry_Key, std::make_any<DataPath>(transformedGeomPath));
+
+  auto preflightResult = filter.preflight(dataGraph, args);
+  COMPLEX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  // Without the resample option an Image Geometry is rejected
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_ResampleImageGeometry_Key, std::make_any<bool>(false));
+  preflightResult = filter.preflight(dataGraph, args);
+  COMPLEX_RESULT_REQUIRE_INVALID(preflightResult.outputActions);
+}
@@ -25,6 +25,27 @@ TEST_CASE("ComplexCore::CopyDataGroup(Instantiate)", "[ComplexCore][CopyDataGrou
 
   auto result = filter.execute(ds, args);
   COMPLEX_RESULT_REQUIRE_VALID(result.result);
+
+  const auto* originalGroup = ds.getDataAs<BaseGroup>(k_DataPath);
+  const auto* copyGroup = ds.getDataAs<BaseGroup>(k_CopyPath);
+  REQUIRE(originalGroup != nullptr);
+  REQUIRE(copyGroup != nullptr);
+  REQUIRE(originalGroup->getId() != copyGroup->getId());
+  REQUIRE(originalGroup->getName() == k_DataPath.getTargetName());
+  REQUIRE(copyGroup->getName() == k_CopyPath.getTargetName());
+
+  const auto childNames = originalGroup->getDataMap().getNames();
+  REQUIRE(!childNames.empty());
+  REQUIRE(copyGroup->getSize() == originalGroup->getSize());
+  for(const auto& childName : childNames)
+  {
+    const auto* originalChild = ds.getData(k_DataPath.createChildPath(childName));
+    const auto* copyChild = ds.getData(k_CopyPath.createChildPath(childName));
+    REQUIRE(originalChild != nullptr);
+    REQUIRE(copyChild != nullptr);
+    REQUIRE(originalChild->getId() != copyChild->getId());
+    REQUIRE(copyChild->getParentIds() == DataObject::ParentCollectionType{copyGroup->getId()});
+  }
 }
 
 TEST_CASE("ComplexCore::CopyDataGroup(Invalid Parameters)", "[ComplexCore][CopyDataGroup]")
@@ -4,6 +4,7 @@
 
 #include "ComplexCore/ComplexCore_test_dirs.hpp"
 
+#include "complex/DataStructure/Geometry/ImageGeom.hpp"
 #include "complex/UnitTest/UnitTestCommon.hpp"
 
 using namespace complex;
@@ -30,3 +31,53 @@ TEST_CASE("ComplexCore::IdentifySample(Instantiate)", "[ComplexCore][IdentifySam
   auto executeResult = filter.execute(dataGraph, args);
   REQUIRE(executeResult.result.valid());
 }
+
+TEST_CASE("ComplexCore::IdentifySample(Largest Feature and Holes)", "[ComplexCore][IdentifySample]")
+{
+  // A 3x3x3 block of good voxels with a hole in its center and a single good voxel in a corner
+  const SizeVec3 dims = {5, 5, 5};
+  auto isInBlock = [](usize x, usize y, usize z) { return x >= 1 && x <= 3 && y >= 1 && y <= 3 && z >= 1 && z <= 3; };
+  auto isHole = [](usize x, usize y, usize z) { return x == 2 && y == 2 && z == 2; };
+
+  for(bool fillHoles : {false, true})
+  {
+    DataStructure dataGraph;
+    auto* imageGeom = ImageGeom::Create(dataGraph, "Image Geometry");
+    imageGeom->setDimensions(dims);
+    auto* mask = BoolArray::CreateWithStore<DataStore<bool>>(dataGraph, "Mask", {dims[0] * dims[1] * dims[2]}, {1}, imageGeom->getId());
+    for(usize z = 0; z < dims[2]; z++)
+    {
+      for(usize y = 0; y < dims[1]; y++)
+      {
+        for(usize x = 0; x < dims[0]; x++)
+        {
+          (*mask)[(z * dims[1] + y) * dims[0] + x] = (isInBlock(x, y, z) && !isHole(x, y, z)) || (x == 0 && y == 0 && z == 0);
+        }
+      }
+    }
+
+    IdentifySample filter;
+    Arguments args;
+    args.insert(IdentifySample::k_FillHoles_Key, std::make_any<bool>(fillHoles));
+    args.insert(IdentifySample::k_ImageGeom_Key, std::make_any<DataPath>(DataPath({"Image Geometry"})));
+    args.insert(IdentifySample::k_GoodVoxels_Key, std::make_any<DataPath>(DataPath({"Image Geometry", "Mask"})));
+
+    auto preflightResult = filter.preflight(dataGraph, args);
+    REQUIRE(preflightResult.outputActions.valid());
+
+    auto executeResult = filter.execute(dataGraph, args);
+    REQUIRE(executeResult.result.valid());
+
+    for(usize z = 0; z < dims[2]; z++)
+    {
+      for(usize y = 0; y < dims[1]; y++)
+      {
+        for(usize x = 0; x < dims[0]; x++)
+        {
+          const bool expected = isInBlock(x, y, z) && (fillHoles || !isHole(x, y, z));
+          REQUIRE((*mask)[(z * dims[1] + y) * dims[0] + x] == expected);
+        }
+      }
+    }
+  }
+}
@@ -392,3 +392,58 @@ TEST_CASE("ComplexCore::InitializeData(RandomWithRange)", "[ComplexCore][Initial
     }
   }
 }
+
+TEST_CASE("ComplexCore::InitializeData(Seeded)", "[ComplexCore][InitializeData]")
+{
+  InitializeData filter;
+  DataStructure ds = CreateDataStructure();
+  DataStructure seededDs = CreateDataStructure();
+
+  constexpr uint64 xMin = 5;
+  constexpr uint64 yMin = 5;
+  constexpr uint64 zMin = 5;
+  constexpr uint64 xMax = 15;
+  constexpr uint64 yMax = 15;
+  constexpr uint64 zMax = 15;
+  constexpr std::pair<float64, float64> initRange = {1.0, 25.0};
+  const std::vector<DataPath> cellArrayPaths = {k_Int32ArrayPath, k_Float32ArrayPath};
+  Arguments args = CreateArgs(cellArrayPaths, k_ImageGeomPath, xMin, yMin, zMin, xMax, yMax, zMax, InitializeData::InitType::RandomWithRange, 0.0, initRange);
+  args.insert(InitializeData::k_UseSeed_Key, std::make_any<bool>(true));
+  args.insert(InitializeData::k_SeedValue_Key, std::make_any<uint64>(5489));
+
+  auto result = filter.execute(ds, args);
+  COMPLEX_RESULT_REQUIRE_VALID(result.result);
+  auto seededResult = filter.execute(seededDs, args);
+  COMPLEX_RESULT_REQUIRE_VALID(seededResult.result);
+
+  std::array<usize, 3> imageDims = {k_ImageDims.at(0), k_ImageDims.at(1), k_ImageDims.at(2)};
+
+  // The same seed always produces the same values and every cell of the bounding box is initialized
+  const auto& int32Array = ds.getDataRefAs<Int32Array>(k_Int32ArrayPath);
+  const auto& seededInt32Array = seededDs.getDataRefAs<Int32Array>(k_Int32ArrayPath);
+  const auto& float32Array = ds.getDataRefAs<Float32Array>(k_Float32ArrayPath);
+  const auto& seededFloat32Array = seededDs.getDataRefAs<Float32Array>(k_Float32ArrayPath);
+  for(usize i = 0; i < int32Array.getSize(); i++)
+  {
+    REQUIRE(int32Array[i] == seededInt32Array[i]);
+    REQUIRE(float32Array[i] == seededFloat32Array[i]);
+  }
+  for(uint64 k = zMin; k < zMax + 1; k++)
+  {
+    for(uint64 j = yMin; j < yMax + 1; j++)
+    {
+      for(uint64 i = xMin; i < xMax + 1; i++)
+      {
+        usize index = ((k * imageDims[0] * imageDims[1]) + (j * imageDims[0]) + i) * k_ComponentDims[0];
+        REQUIRE(int32Array[index] >= initRange.first);
+        REQUIRE(int32Array[index] <= initRange.second);
+        REQUIRE(float32Array[index] >= initRange.first);
+        REQUIRE(float32Array[index] <= initRange.second);
+      }
+    }
+  }
+
+  // Every array draws its own values
+  const usize firstCell = (zMin * imageDims[0] * imageDims[1]) + (yMin * imageDims[0]) + xMin;
+  REQUIRE(static_cast<float32>(int32Array[firstCell * 3]) != float32Array[firstCell * 3]);
+}
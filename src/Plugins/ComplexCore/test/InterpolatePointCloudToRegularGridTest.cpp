@@ -126,3 +126,113 @@ TEST_CASE("ComplexCore::InterpolatePointCloudToRegularGridFilter: Test Algorithm
   auto executeResult = filter.execute(dataGraph, args);
   COMPLEX_RESULT_REQUIRE_VALID(executeResult.result);
 }
+
+namespace
+{
+/**
+ * @brief Builds a three point cloud mapped onto a 3 x 1 x 1 image where the last point is masked out.
+ */
+Arguments CreateSmallPointCloud(DataStructure& dataGraph, uint64 outputMode)
+{
+  DataGroup* topLevelGroup = DataGroup::Create(dataGraph, Constants::k_SmallIN100);
+  ImageGeom* imageGeom = ImageGeom::Create(dataGraph, Constants::k_ImageGeometry, topLevelGroup->getId());
+  imageGeom->setSpacing({1.0f, 1.0f, 1.0f});
+  imageGeom->setOrigin({0.0f, 0.0f, 0.0f});
+  imageGeom->setDimensions({3, 1, 1});
+
+  const std::vector<usize> tupleShape = {3};
+  Float32Array* coords = UnitTest::CreateTestDataArray<float32>(dataGraph, "Coords", tupleShape, {3}, topLevelGroup->getId());
+  VertexGeom* vertexGeom = VertexGeom::Create(dataGraph, Constants::k_VertexGeometry, topLevelGroup->getId());
+  vertexGeom->setVertices(coords);
+
+  USizeArray* voxelIndices = UnitTest::CreateTestDataArray<usize>(dataGraph, "Voxel Indices", tupleShape, {1}, topLevelGroup->getId());
+  Float32Array* values = UnitTest::CreateTestDataArray<float32>(dataGraph, "Values", tupleShape, {1}, topLevelGroup->getId());
+  Int32Array* phases = UnitTest::CreateTestDataArray<int32>(dataGraph, "Phases", tupleShape, {1}, topLevelGroup->getId());
+  BoolArray* mask = UnitTest::CreateTestDataArray<bool>(dataGraph, Constants::k_ConditionalArray, tupleShape, {1}, topLevelGroup->getId());
+  for(usize i = 0; i < 3; i++)
+  {
+    (*voxelIndices)[i] = i;
+    (*phases)[i] = static_cast<int32>(5 + i);
+    (*mask)[i] = i < 2;
+  }
+  (*values)[0] = 1.0f;
+  (*values)[1] = 2.0f;
+  (*values)[2] = 4.0f;
+
+  Arguments args;
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_UseMask_Key, std::make_any<bool>(true));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_StoreKernelDistances_Key, std::make_any<bool>(false));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_OutputMode_Key, std::make_any<uint64>(outputMode));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolationTechnique_Key, std::make_any<uint64>(0));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelSize_Key, std::make_any<std::vector<float32>>(std::vector<float32>{2, 0, 0}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_GaussianSigmas_Key, std::make_any<std::vector<float32>>(std::vector<float32>{1, 1, 1}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_VertexGeom_Key, std::make_any<DataPath>(DataPath({Constants::k_SmallIN100, Constants::k_VertexGeometry})));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_ImageGeom_Key, std::make_any<DataPath>(DataPath({Constants::k_SmallIN100, Constants::k_ImageGeometry})));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_VoxelIndices_Key, std::make_any<DataPath>(DataPath({Constants::k_SmallIN100, "Voxel Indices"})));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_Mask_Key, std::make_any<DataPath>(DataPath({Constants::k_SmallIN100, Constants::k_ConditionalArray})));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolateArrays_Key,
+                      std::make_any<std::vector<DataPath>>(std::vector<DataPath>{DataPath({Constants::k_SmallIN100, "Values"})}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_CopyArrays_Key, std::make_any<std::vector<DataPath>>(std::vector<DataPath>{DataPath({Constants::k_SmallIN100, "Phases"})}));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_InterpolatedGroup_Key, std::make_any<DataPath>(DataPath({"Interpolated Group"})));
+  args.insertOrAssign(InterpolatePointCloudToRegularGridFilter::k_KernelDistancesGroup_Key, std::make_any<DataPath>(DataPath({"Kernel Distances"})));
+  return args;
+}
+} // namespace
+
+TEST_CASE("ComplexCore::InterpolatePointCloudToRegularGridFilter: Neighbor List Output", "[DREAM3DReview][InterpolatePointCloudToRegularGridFilter]")
+{
+  InterpolatePointCloudToRegularGridFilter filter;
+  DataStructure dataGraph;
+  Arguments args = CreateSmallPointCloud(dataGraph, 0);
+  DataPath interpolatedGroupPath = DataPath({"Interpolated Group"});
+
+  // Preflight the filter and check result
+  auto preflightResult = filter.preflight(dataGraph, args);
+  COMPLEX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  // Execute the filter and check the result
+  auto executeResult = filter.execute(dataGraph, args);
+  COMPLEX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  // The selected arrays get a per vertex instance of the same type
+  REQUIRE(dataGraph.getDataRefAs<Float32Array>(interpolatedGroupPath.createChildPath("Values")).getNumberOfTuples() == 3);
+  REQUIRE(dataGraph.getDataRefAs<Int32Array>(interpolatedGroupPath.createChildPath("Phases")).getNumberOfTuples() == 3);
+
+  // Every cell lists the kernel weighted value of each unmasked point that reaches it
+  const auto& neighbors = dataGraph.getDataRefAs<NeighborList<float32>>(interpolatedGroupPath.createChildPath("Values Neighbors"));
+  REQUIRE(neighbors.getListSize(0) == 2);
+  REQUIRE(neighbors.getListSize(1) == 2);
+  REQUIRE(neighbors.getListSize(2) == 1);
+  REQUIRE(neighbors.getListReference(2)[0] == Approx(2.0f));
+}
+
+TEST_CASE("ComplexCore::InterpolatePointCloudToRegularGridFilter: Dense Output", "[DREAM3DReview][InterpolatePointCloudToRegularGridFilter]")
+{
+  InterpolatePointCloudToRegularGridFilter filter;
+  DataStructure dataGraph;
+  Arguments args = CreateSmallPointCloud(dataGraph, 1);
+  DataPath interpolatedGroupPath = DataPath({"Interpolated Group"});
+
+  // Preflight the filter and check result
+  auto preflightResult = filter.preflight(dataGraph, args);
+  COMPLEX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  // Execute the filter and check the result
+  auto executeResult = filter.execute(dataGraph, args);
+  COMPLEX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  REQUIRE(dataGraph.getDataAs<INeighborList>(interpolatedGroupPath.createChildPath("Values Neighbors")) == nullptr);
+
+  // The third point is masked out so the last cell only sees the second point
+  const auto& interpolated = dataGraph.getDataRefAs<Float32Array>(interpolatedGroupPath.createChildPath("Values"));
+  REQUIRE(interpolated.getNumberOfTuples() == 3);
+  REQUIRE(interpolated[0] == Approx(1.5f));
+  REQUIRE(interpolated[1] == Approx(1.5f));
+  REQUIRE(interpolated[2] == Approx(2.0f));
+
+  const auto& copied = dataGraph.getDataRefAs<Int32Array>(interpolatedGroupPath.createChildPath("Phases"));
+  REQUIRE(copied.getNumberOfTuples() == 3);
+  REQUIRE(copied[0] == 5);
+  REQUIRE(copied[1] == 6);
+  REQUIRE(copied[2] == 6);
+}
@@ -73,3 +73,33 @@ TEST_CASE("ComplexCore::IterativeClosestPointFilter: Test Algorithm", "[DREAM3DR
   auto executeResult = filter.execute(dataGraph, args);
   REQUIRE(executeResult.result.valid());
 }
+
+TEST_CASE("ComplexCore::IterativeClosestPointFilter: Empty Target", "[DREAM3DReview][IterativeClosestPointFilter]")
+{
+  IterativeClosestPointFilter filter;
+  DataStructure dataGraph = UnitTest::CreateDataStructure();
+  Arguments args;
+
+  DataPath movingVertexPath({Constants::k_SmallIN100, Constants::k_EbsdScanData, Constants::k_VertexGeometry});
+  auto movingVertexGeom = dataGraph.getDataAs<VertexGeom>(movingVertexPath);
+  DataPath transformArrayPath({Constants::k_SmallIN100, "Transform Array"});
+
+  auto* targetVertexGeom = VertexGeom::Create(dataGraph, "Empty Vertex Geometry", movingVertexGeom->getParentIds().front());
+  auto* emptyVertices = Float32Array::CreateWithStore<DataStore<float>>(dataGraph, "Empty Vertices", {0}, {3}, targetVertexGeom->getParentIds().front());
+  targetVertexGeom->setVertices(emptyVertices);
+  DataPath targetVertexPath({Constants::k_SmallIN100, Constants::k_EbsdScanData, targetVertexGeom->getName()});
+
+  args.insertOrAssign(IterativeClosestPointFilter::k_MovingVertexPath_Key, std::make_any<DataPath>(movingVertexPath));
+  args.insertOrAssign(IterativeClosestPointFilter::k_TargetVertexPath_Key, std::make_any<DataPath>(targetVertexPath));
+  args.insertOrAssign(IterativeClosestPointFilter::k_NumIterations_Key, std::make_any<uint64>(1));
+  args.insertOrAssign(IterativeClosestPointFilter::k_ApplyTransformation_Key, std::make_any<bool>(true));
+  args.insertOrAssign(IterativeClosestPointFilter::k_TransformArrayPath_Key, std::make_any<DataPath>(transformArrayPath));
+
+  // An empty target has no nearest neighbors, so the filter rejects it before building the index
+  auto preflightResult = filter.preflight(dataGraph, args);
+  REQUIRE(preflightResult.outputActions.invalid());
+  REQUIRE(preflightResult.outputActions.errors().front().code == -4504);
+
+  auto executeResult = filter.execute(dataGraph, args);
+  REQUIRE(executeResult.result.invalid());
+}
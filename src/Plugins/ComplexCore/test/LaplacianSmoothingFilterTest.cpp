@@ -15,6 +15,7 @@
 #include "ComplexCore/Filters/LaplacianSmoothingFilter.hpp"
 #include "ComplexCore/Filters/StlFileReaderFilter.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <string>
 namespace fs = std::filesystem;
@@ -114,6 +115,24 @@ TEST_CASE("ComplexCore::LaplacianSmoothingFilter", "[SurfaceMeshing][LaplacianSm
     // Execute the filter and check the result
     auto executeResult = filter.execute(dataGraph, args);
     REQUIRE(executeResult.result.valid());
+
+    // With a tolerance that every vertex satisfies the smoothing stops after the first iteration
+    AbstractGeometry::SharedVertexList& vertices = *triangleGeom.getVertices();
+    std::vector<float32> startPositions(vertices.begin(), vertices.end());
+
+    args.insertOrAssign(LaplacianSmoothingFilter::k_IterationSteps_Key, std::make_any<int32>(1));
+    executeResult = filter.execute(dataGraph, args);
+    REQUIRE(executeResult.result.valid());
+    std::vector<float32> oneIterationPositions(vertices.begin(), vertices.end());
+    REQUIRE(oneIterationPositions != startPositions);
+
+    std::copy(startPositions.begin(), startPositions.end(), vertices.begin());
+    args.insertOrAssign(LaplacianSmoothingFilter::k_IterationSteps_Key, std::make_any<int32>(100));
+    args.insertOrAssign(LaplacianSmoothingFilter::k_UseConvergenceTolerance_Key, std::make_any<bool>(true));
+    args.insertOrAssign(LaplacianSmoothingFilter::k_ConvergenceTolerance_Key, std::make_any<float32>(1000.0F));
+    executeResult = filter.execute(dataGraph, args);
+    REQUIRE(executeResult.result.valid());
+    REQUIRE(std::equal(oneIterationPositions.begin(), oneIterationPositions.end(), vertices.begin()));
   }
 
   Result<H5::FileWriter> result = H5::FileWriter::CreateFile(fmt::format("{}/LaplacianSmoothing.dream3d", unit_test::k_BinaryDir));
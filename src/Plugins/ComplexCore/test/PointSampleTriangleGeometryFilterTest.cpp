@@ -17,6 +17,7 @@
 #include "ComplexCore/Filters/PointSampleTriangleGeometryFilter.hpp"
 #include "ComplexCore/Filters/StlFileReaderFilter.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <limits>
 
@@ -228,4 +229,58 @@ TEST_CASE("ComplexCore::PointSampleTriangleGeometryFilter", "[DREAM3DReview][Poi
     REQUIRE(minMaxVerts[4] >= -0.5f);
     REQUIRE(minMaxVerts[5] <= 3.7f);
   }
+
+  // Sampling with the same seed must give the same points and transferred face values
+  {
+    DataPath triangleGeometryPath({triangleGeometryName});
+    DataPath triangleAreasDataPath = triangleGeometryPath.createChildPath(triangleFaceDataGroupName).createChildPath(triangleAreasName);
+    const int32 numSamples = 10000;
+
+    std::array<DataPath, 2> seededGeometryPaths = {DataPath({"[Seeded Vertex Geometry 1]"}), DataPath({"[Seeded Vertex Geometry 2]"})};
+    for(const auto& seededGeometryPath : seededGeometryPaths)
+    {
+      PointSampleTriangleGeometryFilter filter;
+      Arguments args;
+
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_NumberOfSamples_Key, std::make_any<int32>(numSamples));
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_UseMask_Key, std::make_any<bool>(false));
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_UseSeed_Key, std::make_any<bool>(true));
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_SeedValue_Key, std::make_any<uint64>(5489));
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_TriangleGeometry_Key, std::make_any<DataPath>(triangleGeometryPath));
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_TriangleAreasArrayPath_Key, std::make_any<DataPath>(triangleAreasDataPath));
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_MaskArrayPath_Key, std::make_any<DataPath>(DataPath{}));
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_SelectedDataArrayPaths_Key,
+                          std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{triangleAreasDataPath}));
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_VertexGeometryPath_Key, std::make_any<DataPath>(seededGeometryPath));
+      args.insertOrAssign(PointSampleTriangleGeometryFilter::k_VertexDataGroupPath_Key, std::make_any<DataPath>(seededGeometryPath.createChildPath(vertexNodeDataGroup)));
+
+      auto preflightResult = filter.preflight(dataGraph, args);
+      REQUIRE(preflightResult.outputActions.valid());
+
+      auto executeResult = filter.execute(dataGraph, args);
+      REQUIRE(executeResult.result.valid());
+    }
+
+    VertexGeom& firstGeom = dataGraph.getDataRefAs<VertexGeom>(seededGeometryPaths[0]);
+    VertexGeom& secondGeom = dataGraph.getDataRefAs<VertexGeom>(seededGeometryPaths[1]);
+    REQUIRE(firstGeom.getNumberOfVertices() == numSamples);
+    REQUIRE(secondGeom.getNumberOfVertices() == numSamples);
+
+    AbstractGeometry::SharedVertexList& firstVertices = *firstGeom.getVertices();
+    AbstractGeometry::SharedVertexList& secondVertices = *secondGeom.getVertices();
+    for(usize i = 0; i < firstVertices.getSize(); i++)
+    {
+      REQUIRE(firstVertices[i] == secondVertices[i]);
+    }
+
+    const Float64Array& faceAreas = dataGraph.getDataRefAs<Float64Array>(triangleAreasDataPath);
+    const auto& firstAreas = dataGraph.getDataRefAs<Float64Array>(seededGeometryPaths[0].createChildPath(vertexNodeDataGroup).createChildPath(triangleAreasName));
+    const auto& secondAreas = dataGraph.getDataRefAs<Float64Array>(seededGeometryPaths[1].createChildPath(vertexNodeDataGroup).createChildPath(triangleAreasName));
+    REQUIRE(firstAreas.getNumberOfTuples() == numSamples);
+    for(usize i = 0; i < firstAreas.getSize(); i++)
+    {
+      REQUIRE(firstAreas[i] == secondAreas[i]);
+      REQUIRE(std::find(faceAreas.begin(), faceAreas.end(), firstAreas[i]) != faceAreas.end());
+    }
+  }
 }
@@ -133,6 +133,11 @@ FilterList* Application::getFilterList() const
   return m_FilterList.get();
 }
 
+ExecutionContext& Application::getExecutionContext() const
+{
+  return ExecutionContext::Global();
+}
+
 std::unordered_set<AbstractPlugin*> Application::getPluginList() const
 {
   return m_FilterList->getLoadedPlugins();
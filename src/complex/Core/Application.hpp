@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "complex/Filter/FilterList.hpp"
+#include "complex/Utilities/ExecutionContext.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5DataFactoryManager.hpp"
 
 #include "complex/complex_export.hpp"
@@ -106,6 +107,14 @@ public:
    */
   H5::DataFactoryManager* getH5FactoryManager() const;
 
+  /**
+   * @brief Returns the process wide ExecutionContext that controls the
+   * threads used by parallel algorithms. Settings made here apply to every
+   * pipeline in the process.
+   * @return ExecutionContext&
+   */
+  ExecutionContext& getExecutionContext() const;
+
   /**
    * @brief Returns a filepath pointing to the current executable.
    * @return std::filesystem::path
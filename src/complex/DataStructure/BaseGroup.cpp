@@ -1,5 +1,7 @@
 #include "BaseGroup.hpp"
 
+#include "complex/DataStructure/DataStructure.hpp"
+
 #include <exception>
 
 #include "complex/Utilities/Parsing/HDF5/H5GroupReader.hpp"
@@ -120,6 +122,7 @@ bool BaseGroup::insert(const std::weak_ptr<DataObject>& obj)
   if(m_DataMap.insert(ptr))
   {
     ptr->addParent(this);
+    invalidatePathCache();
     return true;
   }
   return false;
@@ -131,26 +134,35 @@ bool BaseGroup::remove(DataObject* obj)
   {
     return false;
   }
+  invalidatePathCache();
   return m_DataMap.remove(obj->getId());
 }
 
 bool BaseGroup::remove(const std::string& name)
 {
-  for(auto iter = m_DataMap.begin(); iter != m_DataMap.end(); iter++)
+  auto iter = m_DataMap.find(name);
+  if(iter == m_DataMap.end())
   {
-    if((*iter).second->getName() == name)
-    {
-      (*iter).second->removeParent(this);
-      m_DataMap.erase(iter);
-      return true;
-    }
+    return false;
   }
-  return false;
+  (*iter).second->removeParent(this);
+  m_DataMap.erase(iter);
+  invalidatePathCache();
+  return true;
 }
 
 void BaseGroup::clear()
 {
   m_DataMap.clear();
+  invalidatePathCache();
+}
+
+void BaseGroup::invalidatePathCache()
+{
+  if(DataStructure* dataStructure = getDataStructure(); dataStructure != nullptr)
+  {
+    dataStructure->invalidatePathCache();
+  }
 }
 
 BaseGroup::Iterator BaseGroup::begin()
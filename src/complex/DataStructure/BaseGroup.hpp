@@ -37,6 +37,8 @@ public:
   using Iterator = typename DataMap::Iterator;
   using ConstIterator = typename DataMap::ConstIterator;
 
+  friend class DataStructure;
+
   /**
    * @brief Copy constructor creates a BaseGroup as a shallow copy of the
    * provided group.
@@ -312,6 +314,12 @@ protected:
   H5::ErrorType writeHdf5(H5::DataStructureWriter& dataStructureWriter, H5::GroupWriter& parentGroupWriter, bool importable) const override;
 
 private:
+  /**
+   * @brief Tells the DataStructure that DataPaths through this group may now
+   * resolve differently.
+   */
+  void invalidatePathCache();
+
   DataMap m_DataMap;
 };
 } // namespace complex
@@ -16,11 +16,13 @@ using namespace complex;
 DataMap::DataMap() = default;
 DataMap::DataMap(const DataMap& other)
 : m_Map(other.m_Map)
+, m_NameIndex(other.m_NameIndex)
 {
 }
 
 DataMap::DataMap(DataMap&& other) noexcept
 : m_Map(std::move(other.m_Map))
+, m_NameIndex(std::move(other.m_NameIndex))
 {
 }
 
@@ -56,7 +58,13 @@ bool DataMap::insert(const std::shared_ptr<DataObject>& obj)
     return false;
   }
 
-  m_Map[obj->getId()] = obj;
+  auto& entry = m_Map[obj->getId()];
+  if(entry != nullptr)
+  {
+    unindexName(entry->getName(), obj->getId());
+  }
+  entry = obj;
+  indexName(obj->getName(), obj->getId());
   return true;
 }
 
@@ -83,13 +91,17 @@ bool DataMap::erase(const Iterator& iter)
   {
     return false;
   }
+  std::string name = iter->second->getName();
+  IdType id = iter->first;
   m_Map.erase(iter);
+  unindexName(name, id);
   return true;
 }
 
 void DataMap::clear()
 {
   m_Map.clear();
+  m_NameIndex.clear();
 }
 
 std::vector<DataMap::IdType> DataMap::getKeys() const
@@ -145,14 +157,7 @@ std::vector<std::string> DataMap::getNames() const
 
 bool DataMap::contains(const std::string& name) const
 {
-  for(auto& iter : m_Map)
-  {
-    if(iter.second->getName() == name)
-    {
-      return true;
-    }
-  }
-  return false;
+  return m_NameIndex.find(name) != m_NameIndex.end();
 }
 
 bool DataMap::contains(const DataObject* obj) const
@@ -189,26 +194,22 @@ const DataObject* DataMap::operator[](IdType key) const
 
 DataObject* DataMap::operator[](const std::string& name)
 {
-  for(auto& iter : m_Map)
+  auto iter = find(name);
+  if(iter == m_Map.end())
   {
-    if(iter.second->getName() == name)
-    {
-      return iter.second.get();
-    }
+    return nullptr;
   }
-  return nullptr;
+  return iter->second.get();
 }
 
 const DataObject* DataMap::operator[](const std::string& name) const
 {
-  for(auto& iter : m_Map)
+  auto iter = find(name);
+  if(iter == m_Map.end())
   {
-    if(iter.second->getName() == name)
-    {
-      return iter.second.get();
-    }
+    return nullptr;
   }
-  return nullptr;
+  return iter->second.get();
 }
 
 DataMap::Iterator DataMap::find(IdType id)
@@ -223,26 +224,22 @@ DataMap::ConstIterator DataMap::find(IdType id) const
 
 DataMap::Iterator DataMap::find(const std::string& name)
 {
-  for(auto iter = begin(); iter != end(); iter++)
+  auto indexIter = m_NameIndex.find(name);
+  if(indexIter == m_NameIndex.end())
   {
-    if((*iter).second->getName() == name)
-    {
-      return iter;
-    }
+    return end();
   }
-  return end();
+  return m_Map.find(indexIter->second);
 }
 
 DataMap::ConstIterator DataMap::find(const std::string& name) const
 {
-  for(auto iter = begin(); iter != end(); iter++)
+  auto indexIter = m_NameIndex.find(name);
+  if(indexIter == m_NameIndex.end())
   {
-    if((*iter).second->getName() == name)
-    {
-      return iter;
-    }
+    return end();
   }
-  return end();
+  return m_Map.find(indexIter->second);
 }
 
 void DataMap::setDataStructure(DataStructure* dataStr)
@@ -286,6 +283,7 @@ DataMap::ConstIterator DataMap::end() const
 DataMap& DataMap::operator=(const DataMap& rhs)
 {
   m_Map = rhs.m_Map;
+  m_NameIndex = rhs.m_NameIndex;
   auto keys = rhs.getKeys();
   for(auto& key : keys)
   {
@@ -299,6 +297,7 @@ DataMap& DataMap::operator=(const DataMap& rhs)
 DataMap& DataMap::operator=(DataMap&& rhs) noexcept
 {
   m_Map = std::move(rhs.m_Map);
+  m_NameIndex = std::move(rhs.m_NameIndex);
   return *this;
 }
 
@@ -339,4 +338,59 @@ void DataMap::updateIds(const std::vector<std::pair<IdType, IdType>>& updatedIds
     extractedPair.key() = updatedId.second;
     m_Map.insert(std::move(extractedPair));
   }
+  rebuildNameIndex();
+}
+
+void DataMap::updateName(IdType id, const std::string& previousName)
+{
+  auto iter = m_Map.find(id);
+  if(iter == m_Map.end())
+  {
+    return;
+  }
+  unindexName(previousName, id);
+  indexName(iter->second->getName(), id);
+}
+
+void DataMap::indexName(const std::string& name, IdType id)
+{
+  auto [indexIter, inserted] = m_NameIndex.try_emplace(name, id);
+  if(!inserted && id < indexIter->second)
+  {
+    indexIter->second = id;
+  }
+}
+
+void DataMap::unindexName(const std::string& name, IdType id)
+{
+  auto indexIter = m_NameIndex.find(name);
+  if(indexIter == m_NameIndex.end() || indexIter->second != id)
+  {
+    return;
+  }
+  m_NameIndex.erase(indexIter);
+
+  // Only search for another DataObject with the same name if there are more
+  // DataObjects than indexed names
+  if(m_NameIndex.size() == m_Map.size())
+  {
+    return;
+  }
+  for(const auto& [otherId, dataObject] : m_Map)
+  {
+    if(dataObject->getName() == name)
+    {
+      m_NameIndex[name] = otherId;
+      return;
+    }
+  }
+}
+
+void DataMap::rebuildNameIndex()
+{
+  m_NameIndex.clear();
+  for(const auto& [id, dataObject] : m_Map)
+  {
+    indexName(dataObject->getName(), id);
+  }
 }
@@ -4,6 +4,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "complex/Utilities/Parsing/HDF5/H5.hpp"
@@ -298,7 +299,38 @@ public:
    */
   void updateIds(const std::vector<std::pair<IdType, IdType>>& updatedIds);
 
+  /**
+   * @brief Updates the name lookup after the DataObject with the target ID was
+   * renamed from the specified name.
+   * @param id
+   * @param previousName
+   */
+  void updateName(IdType id, const std::string& previousName);
+
 private:
+  /**
+   * @brief Adds the name of the target DataObject to the name lookup. When
+   * several DataObjects share a name, the lowest ID is kept so lookups match
+   * the iteration order of the map.
+   * @param name
+   * @param id
+   */
+  void indexName(const std::string& name, IdType id);
+
+  /**
+   * @brief Removes the name of a DataObject that is no longer in the map, or
+   * no longer has that name, from the name lookup.
+   * @param name
+   * @param id
+   */
+  void unindexName(const std::string& name, IdType id);
+
+  /**
+   * @brief Rebuilds the name lookup from the contents of the map.
+   */
+  void rebuildNameIndex();
+
   MapType m_Map;
+  std::unordered_map<std::string, IdType> m_NameIndex;
 };
 } // namespace complex
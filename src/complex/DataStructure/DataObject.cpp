@@ -151,6 +151,12 @@ bool DataObject::canRename(const std::string& name) const
   {
     return false;
   }
+  // A copy that has not been inserted yet still carries the id and parents of its original
+  // but is not held by any group, so no sibling names can collide with it
+  if(dataStruct->getData(getId()) != this)
+  {
+    return true;
+  }
   return !std::any_of(m_ParentList.cbegin(), m_ParentList.cend(), [dataStruct, name](IdType parentId) { return dataStruct->getDataAs<BaseGroup>(parentId)->contains(name); });
 }
 
@@ -161,7 +167,13 @@ bool DataObject::rename(const std::string& name)
     return false;
   }
 
+  std::string previousName = std::move(m_Name);
   m_Name = name;
+  DataStructure* dataStruct = getDataStructure();
+  if(dataStruct->getData(getId()) == this)
+  {
+    dataStruct->dataRenamed(getId(), previousName, m_Name);
+  }
   return true;
 }
 
@@ -188,7 +188,9 @@ public:
   bool canRename(const std::string& name) const;
 
   /**
-   * @brief Attempts to rename the DataObject to the provided value.
+   * @brief Attempts to rename the DataObject to the provided value. Objects held by the
+   * DataStructure update the name lookup of their parents and emit a DataRenamedMessage.
+   * A copy that has not been inserted into the DataStructure yet is only renamed.
    * @param name
    * @return bool
    */
@@ -1,9 +1,11 @@
 #include "DataPath.hpp"
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
-
-#include <fmt/format.h>
+#include <unordered_map>
 
 #include "complex/Common/Types.hpp"
 #include "complex/DataStructure/DataObject.hpp"
@@ -11,32 +13,147 @@
 
 using namespace complex;
 
+namespace
+{
+/**
+ * @brief Process wide table of DataPath segments. Every distinct name is stored
+ * once and never freed, so the returned pointers stay valid for the lifetime
+ * of the process and equal names always share the same pointer.
+ */
+class SegmentTable
+{
+public:
+  static SegmentTable& Instance()
+  {
+    // Intentionally leaked so DataPaths with static storage can outlive it
+    static auto* table = new SegmentTable();
+    return *table;
+  }
+
+  const std::string* intern(std::string_view segment)
+  {
+    {
+      std::shared_lock lock(m_Mutex);
+      auto iter = m_Segments.find(segment);
+      if(iter != m_Segments.end())
+      {
+        return iter->second.get();
+      }
+    }
+
+    std::unique_lock lock(m_Mutex);
+    auto iter = m_Segments.find(segment);
+    if(iter == m_Segments.end())
+    {
+      auto storedSegment = std::make_unique<const std::string>(segment);
+      std::string_view key = *storedSegment;
+      iter = m_Segments.emplace(key, std::move(storedSegment)).first;
+    }
+    return iter->second.get();
+  }
+
+private:
+  std::shared_mutex m_Mutex;
+  std::unordered_map<std::string_view, std::unique_ptr<const std::string>> m_Segments;
+};
+
+const std::string* InternSegment(std::string_view segment)
+{
+  if(!DataObject::IsValidName(segment))
+  {
+    throw std::invalid_argument("DataPath: Invalid DataObject name");
+  }
+  return SegmentTable::Instance().intern(segment);
+}
+
+/**
+ * @brief Compares two paths the same way their "/" joined strings would compare
+ * without building the strings. Names cannot contain '/', so a segment that is
+ * a prefix of another is followed by either the end of the path or a '/'.
+ * @param lhs
+ * @param rhs
+ * @return int
+ */
+int CompareJoined(const std::vector<const std::string*>& lhs, const std::vector<const std::string*>& rhs)
+{
+  const usize count = std::min(lhs.size(), rhs.size());
+  for(usize i = 0; i < count; i++)
+  {
+    if(lhs[i] == rhs[i])
+    {
+      continue;
+    }
+    const std::string& lhsSegment = *lhs[i];
+    const std::string& rhsSegment = *rhs[i];
+    const usize commonLength = std::min(lhsSegment.size(), rhsSegment.size());
+    int result = lhsSegment.compare(0, commonLength, rhsSegment, 0, commonLength);
+    if(result != 0)
+    {
+      return result;
+    }
+
+    // One segment is a prefix of the other
+    const bool lhsIsShorter = lhsSegment.size() < rhsSegment.size();
+    const auto& shorterPath = lhsIsShorter ? lhs : rhs;
+    const auto nextLongerChar = static_cast<unsigned char>((lhsIsShorter ? rhsSegment : lhsSegment)[commonLength]);
+    const bool shorterIsLess = (i + 1 == shorterPath.size()) || static_cast<unsigned char>('/') < nextLongerChar;
+    return (shorterIsLess == lhsIsShorter) ? -1 : 1;
+  }
+
+  if(lhs.size() == rhs.size())
+  {
+    return 0;
+  }
+  return lhs.size() < rhs.size() ? -1 : 1;
+}
+} // namespace
+
 namespace complex
 {
 DataPath::DataPath() = default;
 
 DataPath::DataPath(std::vector<std::string> path)
-: m_Path(std::move(path))
 {
-  for(const auto& item : m_Path)
+  m_Path.reserve(path.size());
+  for(const auto& item : path)
   {
-    if(!DataObject::IsValidName(item))
-    {
-      throw std::invalid_argument("DataPath: Invalid DataObject name");
-    }
+    m_Path.push_back(InternSegment(item));
   }
+  updateHash();
 }
 
 DataPath::DataPath(const DataPath& rhs) = default;
 
-DataPath::DataPath(DataPath&& rhs) noexcept = default;
+DataPath::DataPath(DataPath&& rhs) noexcept
+: m_Path(std::move(rhs.m_Path))
+, m_Hash(rhs.m_Hash)
+{
+  // Leave rhs as a valid empty path
+  rhs.m_Path.clear();
+  rhs.m_Hash = 0;
+}
 
 DataPath& DataPath::operator=(const DataPath& rhs) = default;
 
-DataPath& DataPath::operator=(DataPath&& rhs) noexcept = default;
+DataPath& DataPath::operator=(DataPath&& rhs) noexcept
+{
+  m_Path = std::move(rhs.m_Path);
+  m_Hash = rhs.m_Hash;
+  rhs.m_Path.clear();
+  rhs.m_Hash = 0;
+  return *this;
+}
 
 DataPath::~DataPath() noexcept = default;
 
+DataPath DataPath::FromInterned(std::vector<const std::string*> segments)
+{
+  DataPath dataPath;
+  dataPath.m_Path = std::move(segments);
+  dataPath.updateHash();
+  return dataPath;
+}
+
 std::optional<DataPath> DataPath::FromString(std::string_view inputPath, char delimiter)
 {
   if(inputPath.empty())
@@ -73,12 +190,18 @@ std::string DataPath::getTargetName() const
   {
     return "";
   }
-  return m_Path.back();
+  return *m_Path.back();
 }
 
 std::vector<std::string> DataPath::getPathVector() const
 {
-  return m_Path;
+  std::vector<std::string> pathVector;
+  pathVector.reserve(m_Path.size());
+  for(const std::string* segment : m_Path)
+  {
+    pathVector.push_back(*segment);
+  }
+  return pathVector;
 }
 
 DataPath DataPath::getParent() const
@@ -88,22 +211,35 @@ DataPath DataPath::getParent() const
     return {};
   }
 
-  std::vector<std::string> parentPath(m_Path.cbegin(), m_Path.cend() - 1);
-  return DataPath(std::move(parentPath));
+  return FromInterned(std::vector<const std::string*>(m_Path.cbegin(), m_Path.cend() - 1));
 }
 
 DataPath DataPath::createChildPath(std::string name) const
 {
-  std::vector<std::string> path = m_Path;
-  path.push_back(std::move(name));
-  return DataPath(std::move(path));
+  std::vector<const std::string*> path;
+  path.reserve(m_Path.size() + 1);
+  path.insert(path.end(), m_Path.cbegin(), m_Path.cend());
+  path.push_back(InternSegment(name));
+  return FromInterned(std::move(path));
 }
 
 DataPath DataPath::replace(std::string_view symbol, std::string_view targetName) const
 {
-  std::vector<std::string> newPath = m_Path;
-  std::replace(newPath.begin(), newPath.end(), symbol, targetName);
-  return DataPath(std::move(newPath));
+  std::vector<const std::string*> newPath = m_Path;
+  const std::string* target = nullptr;
+  for(auto& segment : newPath)
+  {
+    if(*segment != symbol)
+    {
+      continue;
+    }
+    if(target == nullptr)
+    {
+      target = InternSegment(targetName);
+    }
+    segment = target;
+  }
+  return FromInterned(std::move(newPath));
 }
 
 bool DataPath::attemptRename(const DataPath& oldPath, const DataPath& newPath)
@@ -125,12 +261,13 @@ bool DataPath::attemptRename(const DataPath& oldPath, const DataPath& newPath)
   {
     m_Path[i] = newPath.m_Path[i];
   }
+  updateHash();
   return true;
 }
 
 bool DataPath::operator==(const DataPath& rhs) const
 {
-  return m_Path == rhs.m_Path;
+  return m_Hash == rhs.m_Hash && m_Path == rhs.m_Path;
 }
 
 bool DataPath::operator!=(const DataPath& rhs) const
@@ -140,21 +277,46 @@ bool DataPath::operator!=(const DataPath& rhs) const
 
 bool DataPath::operator<(const DataPath& rhs) const
 {
-  return toString() < rhs.toString();
+  return CompareJoined(m_Path, rhs.m_Path) < 0;
 }
 
 bool DataPath::operator>(const DataPath& rhs) const
 {
-  return toString() > rhs.toString();
+  return CompareJoined(m_Path, rhs.m_Path) > 0;
 }
 
 const std::string& DataPath::operator[](usize index) const
 {
-  return m_Path.at(index);
+  return *m_Path.at(index);
 }
 
 std::string DataPath::toString(std::string_view div) const
 {
-  return fmt::format("{}", fmt::join(m_Path, div));
+  std::string result;
+  for(usize i = 0; i < m_Path.size(); i++)
+  {
+    if(i > 0)
+    {
+      result += div;
+    }
+    result += *m_Path[i];
+  }
+  return result;
+}
+
+usize DataPath::getHash() const
+{
+  return m_Hash;
+}
+
+void DataPath::updateHash()
+{
+  usize hash = m_Path.size();
+  std::hash<const std::string*> hasher;
+  for(const std::string* segment : m_Path)
+  {
+    hash ^= hasher(segment) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+  }
+  m_Hash = hash;
 }
 } // namespace complex
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -17,6 +18,18 @@ namespace complex
  * to a DataObject, but by providing a path, it is possible to extrapolate
  * which set of siblings a user may be interested in or iterate over a data
  * group with common children names.
+ *
+ * Path segments are interned in a process wide table, so a DataPath only holds
+ * pointers to shared strings. Copying a DataPath does not copy any names, and
+ * equality is decided by comparing pointers after a precomputed hash.
+ *
+ * Interned segments are never freed. Every distinct name ever used in a path
+ * stays in the table until the process exits, even after all DataPaths using
+ * it are gone. Freeing them would need a reference count on every copy and
+ * destruction of a path, which is what interning avoids. Pipelines reuse a
+ * small set of names, so the table stays small. Long running processes that
+ * build paths from generated names (per job or per file suffixes, for
+ * example) grow the table by one allocation per distinct name.
  */
 class COMPLEX_EXPORT DataPath
 {
@@ -170,7 +183,39 @@ public:
    */
   std::string toString(std::string_view div = "/") const;
 
+  /**
+   * @brief Returns the hash of the path. Equal paths have equal hashes within
+   * the same process.
+   * @return usize
+   */
+  usize getHash() const;
+
 private:
-  std::vector<std::string> m_Path;
+  /**
+   * @brief Creates a DataPath from segments that were already interned and validated.
+   * @param segments
+   * @return DataPath
+   */
+  static DataPath FromInterned(std::vector<const std::string*> segments);
+
+  /**
+   * @brief Recomputes the hash after the segments changed.
+   */
+  void updateHash();
+
+  std::vector<const std::string*> m_Path;
+  usize m_Hash = 0;
 };
 } // namespace complex
+
+namespace std
+{
+template <>
+struct hash<::complex::DataPath>
+{
+  std::size_t operator()(const ::complex::DataPath& value) const noexcept
+  {
+    return value.getHash();
+  }
+};
+} // namespace std
@@ -317,6 +317,19 @@ public:
     return {data(), this->getSize()};
   }
 
+  /**
+   * @brief Creates a DataStore with the tuple and component shapes of the
+   * HDF5 dataset without reading or initializing its values.
+   * @param datasetReader
+   * @return std::unique_ptr<DataStore>
+   */
+  static std::unique_ptr<DataStore> CreateHdf5(const H5::DatasetReader& datasetReader)
+  {
+    auto tupleShape = IDataStore::ReadTupleShape(datasetReader);
+    auto componentShape = IDataStore::ReadComponentShape(datasetReader);
+    return std::make_unique<DataStore<T>>(tupleShape, componentShape, std::nullopt);
+  }
+
   /**
    * @brief Writes the data store to HDF5. Returns the HDF5 error code should
    * one be encountered. Otherwise, returns 0.
@@ -366,11 +379,8 @@ public:
 
   static std::unique_ptr<DataStore> ReadHdf5(const H5::DatasetReader& datasetReader)
   {
-    auto tupleShape = IDataStore::ReadTupleShape(datasetReader);
-    auto componentShape = IDataStore::ReadComponentShape(datasetReader);
-
-    // Create DataStore
-    auto dataStore = std::make_unique<DataStore<T>>(tupleShape, componentShape, static_cast<T>(0));
+    // The read overwrites every value so there is no need to fill the DataStore first
+    auto dataStore = CreateHdf5(datasetReader);
 
     if(!datasetReader.readIntoSpan(dataStore->createSpan()))
     {
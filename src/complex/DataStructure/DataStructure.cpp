@@ -6,6 +6,7 @@
 #include "complex/DataStructure/LinkedPath.hpp"
 #include "complex/DataStructure/Messaging/DataAddedMessage.hpp"
 #include "complex/DataStructure/Messaging/DataRemovedMessage.hpp"
+#include "complex/DataStructure/Messaging/DataRenamedMessage.hpp"
 #include "complex/DataStructure/Messaging/DataReparentedMessage.hpp"
 #include "complex/DataStructure/Observers/AbstractDataStructureObserver.hpp"
 #include "complex/Filter/DataParameter.hpp"
@@ -17,6 +18,7 @@
 
 #include <numeric>
 #include <stdexcept>
+#include <utility>
 
 #include <fmt/core.h>
 
@@ -104,6 +106,7 @@ void DataStructure::clear()
     removeData(dataId);
   }
   m_DataObjects.clear();
+  invalidatePathCache();
 }
 
 std::optional<DataObject::IdType> DataStructure::getId(const DataPath& path) const
@@ -222,6 +225,28 @@ std::vector<DataObject::IdType> DataStructure::getAllDataObjectIds() const
   return dataIds;
 }
 
+std::map<DataObject::IdType, uint64> DataStructure::getArrayMemoryUsage() const
+{
+  std::map<DataObject::IdType, uint64> arrayMemoryUsage;
+  for(const auto& [id, weakPtr] : m_DataObjects)
+  {
+    auto dataArray = std::dynamic_pointer_cast<const IDataArray>(weakPtr.lock());
+    if(dataArray == nullptr || dataArray->getIDataStore() == nullptr)
+    {
+      continue;
+    }
+    const IDataStore* dataStore = dataArray->getIDataStore();
+    arrayMemoryUsage[id] = static_cast<uint64>(dataStore->getSize()) * dataStore->getTypeSize();
+  }
+  return arrayMemoryUsage;
+}
+
+uint64 DataStructure::getTotalArrayMemoryUsage() const
+{
+  auto arrayMemoryUsage = getArrayMemoryUsage();
+  return std::accumulate(arrayMemoryUsage.cbegin(), arrayMemoryUsage.cend(), uint64(0), [](uint64 total, const auto& entry) { return total + entry.second; });
+}
+
 DataObject* DataStructure::getData(DataObject::IdType id)
 {
   auto iter = m_DataObjects.find(id);
@@ -247,40 +272,29 @@ DataObject* DataStructure::getData(const std::optional<DataObject::IdType>& id)
   return iter->second.lock().get();
 }
 
-DataObject* traversePath(DataObject* obj, const DataPath& path, usize index)
+const DataObject* traversePath(const DataObject* obj, const DataPath& path, usize index)
 {
   if(path.getLength() == index)
   {
     return obj;
   }
-  auto col = dynamic_cast<BaseGroup*>(obj);
+  auto col = dynamic_cast<const BaseGroup*>(obj);
   if(col == nullptr)
   {
     return nullptr;
   }
-  DataObject* child = (*col)[path[index]];
+  const DataObject* child = (*col)[path[index]];
   return traversePath(child, path, index + 1);
 }
 
 DataObject* DataStructure::getData(const DataPath& path)
 {
-  if(path.empty())
+  const DataObject* dataObject = std::as_const(*this).getData(path);
+  if(dataObject == nullptr)
   {
     return nullptr;
   }
-  auto topLevel = getTopLevelData();
-  for(DataObject* obj : topLevel)
-  {
-    if(obj == nullptr)
-    {
-      continue;
-    }
-    if(obj->getName() == path[0])
-    {
-      return traversePath(obj, path, 1);
-    }
-  }
-  return nullptr;
+  return getData(dataObject->getId());
 }
 
 DataObject& DataStructure::getDataRef(const DataPath& path)
@@ -330,19 +344,22 @@ const DataObject* DataStructure::getData(const DataPath& path) const
     return nullptr;
   }
 
-  auto topLevel = getTopLevelData();
-  for(DataObject* obj : topLevel)
   {
-    if(obj == nullptr)
+    std::lock_guard<std::mutex> lock(m_PathCacheMutex);
+    auto iter = m_PathCache.find(path);
+    if(iter != m_PathCache.end())
     {
-      continue;
-    }
-    if(obj->getName() == path[0])
-    {
-      return traversePath(obj, path, 1);
+      return getData(iter->second);
     }
   }
-  return nullptr;
+
+  const DataObject* dataObject = traversePath(m_RootGroup[path[0]], path, 1);
+  if(dataObject != nullptr)
+  {
+    std::lock_guard<std::mutex> lock(m_PathCacheMutex);
+    m_PathCache[path] = dataObject->getId();
+  }
+  return dataObject;
 }
 
 const DataObject& DataStructure::getDataRef(const DataPath& path) const
@@ -394,6 +411,7 @@ void DataStructure::setData(DataObject::IdType id, std::shared_ptr<DataObject> d
   }
 
   m_DataObjects[id] = dataObject;
+  invalidatePathCache();
 }
 
 bool DataStructure::removeData(const std::optional<DataObject::IdType>& id)
@@ -446,10 +464,39 @@ void DataStructure::dataDeleted(DataObject::IdType id, const std::string& name)
     return;
   }
 
+  invalidatePathCache();
   auto msg = std::make_shared<DataRemovedMessage>(this, id, name);
   notify(msg);
 }
 
+void DataStructure::dataRenamed(DataObject::IdType id, const std::string& previousName, const std::string& newName)
+{
+  if(m_RootGroup.contains(id))
+  {
+    m_RootGroup.updateName(id, previousName);
+  }
+  const DataObject* dataObject = getData(id);
+  if(dataObject != nullptr)
+  {
+    for(DataObject::IdType parentId : dataObject->getParentIds())
+    {
+      if(auto* parent = getDataAs<BaseGroup>(parentId))
+      {
+        parent->getDataMap().updateName(id, previousName);
+      }
+    }
+  }
+
+  invalidatePathCache();
+  notify(std::make_shared<DataRenamedMessage>(this, id, previousName, newName));
+}
+
+void DataStructure::invalidatePathCache()
+{
+  std::lock_guard<std::mutex> lock(m_PathCacheMutex);
+  m_PathCache.clear();
+}
+
 std::vector<DataObject*> DataStructure::getTopLevelData() const
 {
   std::vector<DataObject*> topLevel;
@@ -484,6 +531,7 @@ bool DataStructure::insertTopLevel(const std::shared_ptr<DataObject>& obj)
     return false;
   }
 
+  invalidatePathCache();
   return m_RootGroup.insert(obj);
 }
 
@@ -494,6 +542,7 @@ bool DataStructure::removeTopLevel(DataObject* data)
   {
     return false;
   }
+  invalidatePathCache();
 
   DataPath path({name});
   std::vector<DataPath> paths({path});
@@ -559,7 +608,9 @@ bool DataStructure::insert(const std::shared_ptr<DataObject>& dataObject, const
 
   if(getData(dataObject->getId()) != nullptr)
   {
+    // A copy of a held object also inherits the parents of the original
     dataObject->setId(generateId());
+    dataObject->m_ParentList.clear();
   }
 
   if(dataPath.empty())
@@ -587,6 +638,7 @@ bool DataStructure::insertIntoRoot(const std::shared_ptr<DataObject>& dataObject
   {
     return false;
   }
+  invalidatePathCache();
   trackDataObject(dataObject);
   return true;
 }
@@ -672,6 +724,7 @@ DataStructure& DataStructure::operator=(const DataStructure& rhs)
   m_RootGroup = rhs.m_RootGroup;
   m_IsValid = rhs.m_IsValid;
   m_NextId = rhs.m_NextId;
+  invalidatePathCache();
 
   // Hold a shared_ptr copy of the DataObjects long enough for
   // m_RootGroup.setDataStructure(this) to operate.
@@ -698,6 +751,7 @@ DataStructure& DataStructure::operator=(DataStructure&& rhs) noexcept
   m_RootGroup = std::move(rhs.m_RootGroup);
   m_IsValid = std::move(rhs.m_IsValid);
   m_NextId = std::move(rhs.m_NextId);
+  invalidatePathCache();
 
   applyAllDataStructure();
   return *this;
@@ -792,6 +846,7 @@ void DataStructure::resetIds(DataObject::IdType startingId)
 
   // Update m_DataObjects collection
   m_DataObjects = newCollection;
+  invalidatePathCache();
 
   // Update ID references between DataObjects
   for(auto& dataObjectIter : m_DataObjects)
@@ -3,6 +3,7 @@
 #include "complex/Common/Result.hpp"
 #include "complex/DataStructure/DataMap.hpp"
 #include "complex/DataStructure/DataObject.hpp"
+#include "complex/DataStructure/DataPath.hpp"
 #include "complex/DataStructure/LinkedPath.hpp"
 #include "complex/complex_export.hpp"
 
@@ -11,17 +12,19 @@
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace complex
 {
 class AbstractDataStructureMessage;
+class BaseGroup;
 class DataGroup;
-class DataPath;
 
 namespace Constants
 {
@@ -66,6 +69,7 @@ public:
   using Iterator = DataMap::Iterator;
   using ConstIterator = DataMap::ConstIterator;
 
+  friend class BaseGroup;
   friend class DataMap;
   friend class DataObject;
   friend class H5::DataStructureReader;
@@ -458,6 +462,23 @@ public:
    */
   std::vector<DataObject::IdType> getAllDataObjectIds() const;
 
+  /**
+   * @brief Returns the number of bytes each DataArray needs to hold its
+   * values, keyed by the array's id. The arrays of a preflight DataStructure
+   * hold no values but report the size they will have once executed. Other
+   * DataObjects, such as NeighborLists whose lists are only sized while
+   * executing, are not included.
+   * @return std::map<DataObject::IdType, uint64>
+   */
+  std::map<DataObject::IdType, uint64> getArrayMemoryUsage() const;
+
+  /**
+   * @brief Returns the total number of bytes the DataArrays need to hold
+   * their values. See getArrayMemoryUsage().
+   * @return uint64
+   */
+  uint64 getTotalArrayMemoryUsage() const;
+
   /**
    * @brief Returns the top-level of the DataStructure.
    * @return std::vector<DataObject*>
@@ -672,6 +693,21 @@ private:
    */
   void dataDeleted(DataObject::IdType id, const std::string& name);
 
+  /**
+   * @brief Called when a DataObject in the DataStructure is renamed. This
+   * updates the name lookup of its parents and notifies observers to the change.
+   * @param id
+   * @param previousName
+   * @param newName
+   */
+  void dataRenamed(DataObject::IdType id, const std::string& previousName, const std::string& newName);
+
+  /**
+   * @brief Forgets every DataPath resolved so far. Called whenever DataObjects
+   * are added, removed, renamed, or moved.
+   */
+  void invalidatePathCache();
+
   /**
    * @brief Resets the DataStructure for all known DataObjecs in the DataStructure.
    * This method exists for methods that copy or move another DataStructure.
@@ -691,5 +727,7 @@ private:
   DataMap m_RootGroup;
   bool m_IsValid = false;
   DataObject::IdType m_NextId = 1;
+  mutable std::mutex m_PathCacheMutex;
+  mutable std::unordered_map<DataPath, DataObject::IdType> m_PathCache;
 };
 } // namespace complex
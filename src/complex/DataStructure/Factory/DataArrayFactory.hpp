@@ -8,7 +8,10 @@
 #include "complex/Utilities/Parsing/HDF5/H5DataStructureReader.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5GroupReader.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5IDataFactory.hpp"
+#include "complex/Utilities/Parsing/HDF5/H5IOEngine.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -38,8 +41,10 @@ public:
   }
 
   /**
-   * @brief Creates and imports a DataArray based on the provided DatasetReader
-   * @param dataStructure
+   * @brief Creates and imports a DataArray based on the provided DatasetReader.
+   * When the DataStructureReader provides an IOEngine, the array is created
+   * right away but its data is read later by the engine.
+   * @param dataStructureReader
    * @param datasetReader
    * @param dataArrayName
    * @param importId
@@ -48,13 +53,44 @@ public:
    * @param preflight
    */
   template <typename K>
-  void importDataArray(DataStructure& dataStructure, const H5::DatasetReader& datasetReader, const std::string dataArrayName, DataObject::IdType importId, H5::ErrorType& err,
+  void importDataArray(H5::DataStructureReader& dataStructureReader, const H5::DatasetReader& datasetReader, const std::string dataArrayName, DataObject::IdType importId, H5::ErrorType& err,
                        const std::optional<DataObject::IdType>& parentId, bool preflight)
   {
-    std::unique_ptr<AbstractDataStore<K>> dataStore =
-        preflight ? std::unique_ptr<AbstractDataStore<K>>(EmptyDataStore<K>::ReadHdf5(datasetReader)) : std::unique_ptr<AbstractDataStore<K>>(DataStore<K>::ReadHdf5(datasetReader));
+    DataStructure& dataStructure = dataStructureReader.getDataStructure();
+    H5::IOEngine* ioEngine = dataStructureReader.getIOEngine();
+    if(preflight || ioEngine == nullptr)
+    {
+      std::unique_ptr<AbstractDataStore<K>> dataStore =
+          preflight ? std::unique_ptr<AbstractDataStore<K>>(EmptyDataStore<K>::ReadHdf5(datasetReader)) : std::unique_ptr<AbstractDataStore<K>>(DataStore<K>::ReadHdf5(datasetReader));
+      DataArray<K>* data = DataArray<K>::Import(dataStructure, dataArrayName, importId, std::move(dataStore), parentId);
+      err = (data == nullptr) ? -400 : 0;
+      return;
+    }
+
+    auto dataStore = DataStore<K>::CreateHdf5(datasetReader);
+    DataStore<K>* dataStorePtr = dataStore.get();
     DataArray<K>* data = DataArray<K>::Import(dataStructure, dataArrayName, importId, std::move(dataStore), parentId);
-    err = (data == nullptr) ? -400 : 0;
+    if(data == nullptr)
+    {
+      err = -400;
+      return;
+    }
+
+    // The dataset stays open after its parent group is closed by the walk
+    auto transferReader = std::make_shared<H5::DatasetReader>(datasetReader.getParentId(), datasetReader.getName());
+    H5::IOEngine::Job job;
+    job.prepare = [dataStorePtr]() {
+      // Touch the pages from the thread pool so the serial read does not pay for them
+      K* buffer = dataStorePtr->data();
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, dataStorePtr->getSize());
+      dataAlg.execute([buffer](const ComplexRange& range) { std::fill(buffer + range.min(), buffer + range.max(), static_cast<K>(0)); });
+    };
+    job.transfer = [dataStorePtr, transferReader]() -> H5::ErrorType {
+      return transferReader->readIntoSpan(dataStorePtr->createSpan()) ? 0 : -401;
+    };
+    ioEngine->submit(std::move(job));
+    err = 0;
   }
 
   /**
@@ -107,41 +143,41 @@ public:
     switch(type)
     {
     case H5::Type::float32:
-      importDataArray<float32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+      importDataArray<float32>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       break;
     case H5::Type::float64:
-      importDataArray<float64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+      importDataArray<float64>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       break;
     case H5::Type::int8:
-      importDataArray<int8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+      importDataArray<int8>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       break;
     case H5::Type::int16:
-      importDataArray<int16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+      importDataArray<int16>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       break;
     case H5::Type::int32:
-      importDataArray<int32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+      importDataArray<int32>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       break;
     case H5::Type::int64:
-      importDataArray<int64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+      importDataArray<int64>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       break;
     case H5::Type::uint8:
       if(isBoolArray)
       {
-        importDataArray<bool>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+        importDataArray<bool>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       }
       else
       {
-        importDataArray<uint8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+        importDataArray<uint8>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       }
       break;
     case H5::Type::uint16:
-      importDataArray<uint16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+      importDataArray<uint16>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       break;
     case H5::Type::uint32:
-      importDataArray<uint32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+      importDataArray<uint32>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       break;
     case H5::Type::uint64:
-      importDataArray<uint64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, preflight);
+      importDataArray<uint64>(dataStructureReader, datasetReader, dataArrayName, importId, err, parentId, preflight);
       break;
     default:
       err = -777;
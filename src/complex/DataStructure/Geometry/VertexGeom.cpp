@@ -6,9 +6,11 @@
 #include "complex/DataStructure/DataStore.hpp"
 #include "complex/DataStructure/DataStructure.hpp"
 #include "complex/Utilities/GeometryHelpers.hpp"
+#include "complex/Utilities/KdTreeIndex.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5Constants.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5GroupReader.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5GroupWriter.hpp"
+#include "complex/Utilities/UniformGridIndex.hpp"
 
 using namespace complex;
 
@@ -36,6 +38,8 @@ VertexGeom::VertexGeom(const VertexGeom& other)
 : AbstractGeometry(other)
 , m_VertexListId(other.m_VertexListId)
 , m_VertexSizesId(other.m_VertexSizesId)
+, m_KdTree(other.m_KdTree)
+, m_VertexBins(other.m_VertexBins)
 {
 }
 
@@ -43,6 +47,8 @@ VertexGeom::VertexGeom(VertexGeom&& other) noexcept
 : AbstractGeometry(std::move(other))
 , m_VertexListId(std::move(other.m_VertexListId))
 , m_VertexSizesId(std::move(other.m_VertexSizesId))
+, m_KdTree(std::move(other.m_KdTree))
+, m_VertexBins(std::move(other.m_VertexBins))
 {
 }
 
@@ -105,6 +111,8 @@ void VertexGeom::initializeWithZeros()
     return;
   }
   std::fill(vertices->getDataStore()->begin(), vertices->getDataStore()->end(), 0.0f);
+  deleteKdTree();
+  deleteVertexBins();
 }
 
 void VertexGeom::resizeVertexList(usize newNumVertices)
@@ -121,10 +129,14 @@ void VertexGeom::resizeVertexList(usize newNumVertices)
   {
     vertices->getDataStore()->reshapeTuples({newNumVertices});
   }
+  deleteKdTree();
+  deleteVertexBins();
 }
 
 void VertexGeom::setVertices(const SharedVertexList* vertices)
 {
+  deleteKdTree();
+  deleteVertexBins();
   if(vertices == nullptr)
   {
     m_VertexListId.reset();
@@ -186,6 +198,8 @@ void VertexGeom::setCoords(usize vertId, const Point3D<float32>& coords)
   {
     (*vertices)[offset + i] = coords[i];
   }
+  deleteKdTree();
+  deleteVertexBins();
 }
 
 usize VertexGeom::getNumberOfVertices() const
@@ -267,6 +281,56 @@ void VertexGeom::deleteElementCentroids()
 {
 }
 
+AbstractGeometry::StatusCode VertexGeom::findKdTree()
+{
+  const SharedVertexList* vertices = getVertices();
+  if(vertices == nullptr)
+  {
+    return -1;
+  }
+  if(m_KdTree != nullptr)
+  {
+    return 1;
+  }
+  m_KdTree = std::make_shared<const KdTreeIndex>(*vertices);
+  return 1;
+}
+
+const KdTreeIndex* VertexGeom::getKdTree() const
+{
+  return m_KdTree.get();
+}
+
+void VertexGeom::deleteKdTree()
+{
+  m_KdTree.reset();
+}
+
+AbstractGeometry::StatusCode VertexGeom::findVertexBins(const FloatVec3& spacing)
+{
+  const SharedVertexList* vertices = getVertices();
+  if(vertices == nullptr)
+  {
+    return -1;
+  }
+  if(m_VertexBins != nullptr && m_VertexBins->getSpacing() == spacing)
+  {
+    return 1;
+  }
+  m_VertexBins = std::make_shared<const UniformGridIndex>(*vertices, spacing);
+  return 1;
+}
+
+const UniformGridIndex* VertexGeom::getVertexBins() const
+{
+  return m_VertexBins.get();
+}
+
+void VertexGeom::deleteVertexBins()
+{
+  m_VertexBins.reset();
+}
+
 complex::Point3D<float64> VertexGeom::getParametricCenter() const
 {
   return {0.0, 0.0, 0.0};
@@ -7,6 +7,9 @@
 
 namespace complex
 {
+class KdTreeIndex;
+class UniformGridIndex;
+
 /**
  * @class VertexGeom
  * @brief
@@ -218,6 +221,50 @@ public:
    */
   void deleteElementCentroids() override;
 
+  /**
+   * @brief Builds a k-d tree over the vertex coordinates unless one is already cached.
+   * The index is shared with shallow copies of the geometry and is not written to file.
+   * Returns a negative value if the geometry has no vertices.
+   * @return StatusCode
+   */
+  StatusCode findKdTree();
+
+  /**
+   * @brief Returns the cached k-d tree or nullptr if findKdTree() has not been called.
+   * @return const KdTreeIndex*
+   */
+  const KdTreeIndex* getKdTree() const;
+
+  /**
+   * @brief Releases the cached k-d tree. setCoords() and the functions that replace or
+   * resize the vertex list call this; code that writes to the vertex array directly
+   * must call it afterwards.
+   */
+  void deleteKdTree();
+
+  /**
+   * @brief Bins the vertex coordinates into a uniform grid with the given bin spacing
+   * unless a grid with the same spacing is already cached. The index is shared with
+   * shallow copies of the geometry and is not written to file. Returns a negative value
+   * if the geometry has no vertices.
+   * @param spacing
+   * @return StatusCode
+   */
+  StatusCode findVertexBins(const FloatVec3& spacing);
+
+  /**
+   * @brief Returns the cached vertex bins or nullptr if findVertexBins() has not been called.
+   * @return const UniformGridIndex*
+   */
+  const UniformGridIndex* getVertexBins() const;
+
+  /**
+   * @brief Releases the cached vertex bins. setCoords() and the functions that replace or
+   * resize the vertex list call this; code that writes to the vertex array directly
+   * must call it afterwards.
+   */
+  void deleteVertexBins();
+
   /**
    * @brief
    * @return complex::Point3D<float64>
@@ -340,5 +387,7 @@ protected:
 private:
   std::optional<IdType> m_VertexListId;
   std::optional<IdType> m_VertexSizesId;
+  std::shared_ptr<const KdTreeIndex> m_KdTree;
+  std::shared_ptr<const UniformGridIndex> m_VertexBins;
 };
 } // namespace complex
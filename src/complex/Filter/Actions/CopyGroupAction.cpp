@@ -22,25 +22,30 @@ std::shared_ptr<DataObject> CopyGroupAction::copyData(DataStructure& dataStructu
 {
   auto* data = dataStructure.getData(targetPath);
 
+  // The copy still shares the id of the original, so it is renamed and emptied while it is
+  // detached and only then inserted, which gives it an id of its own
   auto copy = std::shared_ptr<DataObject>(data->deepCopy());
-  copy->rename(newPath().getTargetName());
-  dataStructure.insert(copy, newPath());
+  copy->rename(copyPath.getTargetName());
+  auto* groupCopy = dynamic_cast<BaseGroup*>(copy.get());
+  if(groupCopy != nullptr)
+  {
+    groupCopy->clear();
+  }
+  if(!dataStructure.insert(copy, copyPath.getParent()))
+  {
+    return nullptr;
+  }
 
-  if(auto* groupData = dynamic_cast<BaseGroup*>(data))
+  if(const auto* groupData = dynamic_cast<const BaseGroup*>(data))
   {
-    for(const auto& [id, ptr] : *groupData)
+    for(const auto& childName : groupData->getDataMap().getNames())
     {
-      if(ptr == nullptr)
-      {
-        continue;
-      }
-
-      std::string childName = ptr->getName();
       auto childPath = targetPath.createChildPath(childName);
       auto childCopyPath = copyPath.createChildPath(childName);
-
-      auto childData = copyData(dataStructure, childPath, childCopyPath);
-      dataStructure.insert(childData, childCopyPath);
+      if(copyData(dataStructure, childPath, childCopyPath) == nullptr)
+      {
+        return nullptr;
+      }
     }
   }
 
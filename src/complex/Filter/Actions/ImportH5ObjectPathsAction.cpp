@@ -15,6 +15,7 @@ using namespace complex;
 namespace
 {
 constexpr complex::int32 k_InsertFailureError = -2;
+constexpr complex::int32 k_MissingObjectError = -3;
 
 void sortImportPaths(std::vector<DataPath>& importPaths)
 {
@@ -49,28 +50,65 @@ Result<> ImportH5ObjectPathsAction::apply(DataStructure& dataStructure, Mode mod
 
   H5::FileReader fileReader(m_H5FilePath);
   H5::ErrorType errorCode;
-  const DREAM3D::FileData fileData = DREAM3D::ReadFile(fileReader, errorCode, preflighting);
+  // Only the selected objects and the groups containing them are read from the file
+  DataStructure importStructure = m_Paths.has_value() ? DREAM3D::ImportDataStructureFromFile(fileReader, *m_Paths, errorCode, preflighting)
+                                                      : DREAM3D::ImportDataStructureFromFile(fileReader, errorCode, preflighting);
   if(errorCode < 0)
   {
     return {nonstd::make_unexpected(std::vector<Error>{Error{errorCode, "Failed to import a DataStructure from the target HDF5 file."}})};
   }
 
   // Ensure there are no conflicting DataObject ID values
-  DataStructure importStructure = fileData.second;
   importStructure.resetIds(dataStructure.getNextId());
 
   auto importPaths = getImportPaths(importStructure, m_Paths);
+  std::vector<std::shared_ptr<DataObject>> importObjects;
+  importObjects.reserve(importPaths.size());
   for(const auto& targetPath : importPaths)
   {
     auto importObject = importStructure.getSharedData(targetPath);
-    auto importData = std::shared_ptr<DataObject>(importObject->deepCopy());
-    // Clear all children before inserting into the DataStructure
-    if(auto importGroup = std::dynamic_pointer_cast<BaseGroup>(importData); importGroup != nullptr)
+    if(importObject == nullptr)
+    {
+      return {nonstd::make_unexpected(std::vector<Error>{{k_MissingObjectError, fmt::format("Unable to find DataObject at '{}' in the target HDF5 file", targetPath.toString())}})};
+    }
+    importObjects.push_back(importObject);
+  }
+
+  // Detach the objects from the imported structure so they can be moved instead of copied. Deeper
+  // objects are detached first so that clearing a group only drops children that were not selected.
+  for(auto iter = importObjects.rbegin(); iter != importObjects.rend(); ++iter)
+  {
+    const auto& importObject = *iter;
+    for(const auto parentId : importObject->getParentIds())
+    {
+      if(auto* parentGroup = importStructure.getDataAs<BaseGroup>(parentId); parentGroup != nullptr)
+      {
+        parentGroup->remove(importObject->getName());
+      }
+    }
+    if(auto importGroup = std::dynamic_pointer_cast<BaseGroup>(importObject); importGroup != nullptr)
     {
       importGroup->clear();
     }
+  }
+
+  for(usize i = 0; i < importPaths.size(); i++)
+  {
+    const DataPath& targetPath = importPaths[i];
+    const auto& importObject = importObjects[i];
+
+    // An object with several parents is selected once per path
+    if(dataStructure.getData(importObject->getId()) == importObject.get())
+    {
+      auto* parentGroup = dataStructure.getDataAs<BaseGroup>(targetPath.getParent());
+      if(parentGroup == nullptr || !dataStructure.setAdditionalParent(importObject->getId(), parentGroup->getId()))
+      {
+        return {nonstd::make_unexpected(std::vector<Error>{{k_InsertFailureError, fmt::format("Unable to import DataObject at '{}'", targetPath.toString())}})};
+      }
+      continue;
+    }
 
-    if(!dataStructure.insert(importData, targetPath.getParent()))
+    if(!dataStructure.insert(importObject, targetPath.getParent()))
     {
       return {nonstd::make_unexpected(std::vector<Error>{{k_InsertFailureError, fmt::format("Unable to import DataObject at '{}'", targetPath.toString())}})};
     }
@@ -48,7 +48,12 @@ bool AbstractPipelineNode::isEnabled() const
 
 void AbstractPipelineNode::setDisabled(bool disabled)
 {
+  if(m_IsDisabled == disabled)
+  {
+    return;
+  }
   m_IsDisabled = disabled;
+  invalidatePreflight();
 }
 
 void AbstractPipelineNode::setEnabled(bool enabled)
@@ -94,6 +99,20 @@ bool AbstractPipelineNode::isPreflighted() const
   return m_IsPreflighted;
 }
 
+void AbstractPipelineNode::invalidatePreflight()
+{
+  m_IsPreflighted = false;
+  if(m_Parent == nullptr)
+  {
+    return;
+  }
+  auto iter = m_Parent->find(this);
+  if(iter != m_Parent->end())
+  {
+    m_Parent->invalidatePreflightFrom(iter - m_Parent->begin());
+  }
+}
+
 void AbstractPipelineNode::endExecution(DataStructure& dataStructure)
 {
   setDataStructure(dataStructure);
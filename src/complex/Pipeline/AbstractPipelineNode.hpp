@@ -291,6 +291,13 @@ protected:
    */
   void setPreflightStructure(const DataStructure& ds, bool success = true);
 
+  /**
+   * @brief Clears the preflighted flag and tells the parent pipeline that this
+   * node and every node after it need to be preflighted again. Called when
+   * anything that affects the node's preflight result changes.
+   */
+  void invalidatePreflight();
+
   /**
    * @brief Called when ending pipeline node execution.
    * Sets the DataStructure and clears the Executing flag.
@@ -7,10 +7,15 @@
 #include "complex/Pipeline/Messaging/NodeMovedMessage.hpp"
 #include "complex/Pipeline/Messaging/NodeRemovedMessage.hpp"
 #include "complex/Pipeline/Messaging/PipelineNodeMessage.hpp"
+#include "complex/Pipeline/PipelineCache.hpp"
 #include "complex/Pipeline/PipelineFilter.hpp"
+#include "complex/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
 
 #include <algorithm>
+#include <charconv>
+#include <chrono>
 #include <fstream>
+#include <map>
 #include <stdexcept>
 
 #include <nlohmann/json.hpp>
@@ -21,6 +26,23 @@ namespace
 {
 constexpr StringLiteral k_PipelineNameKey = "name";
 constexpr StringLiteral k_PipelineItemsKey = "pipeline";
+constexpr StringLiteral k_ArgsKey = "args";
+
+/**
+ * @brief Returns the warnings and errors of the result as warnings, for
+ * failures that do not stop the pipeline.
+ * @param result
+ * @return WarningCollection
+ */
+WarningCollection ConvertToWarnings(const Result<>& result)
+{
+  WarningCollection warnings = result.warnings();
+  for(const auto& error : result.errors())
+  {
+    warnings.push_back(Warning{error.code, error.message});
+  }
+  return warnings;
+}
 } // namespace
 
 Pipeline::Pipeline(const std::string& name, FilterList* filterList)
@@ -35,6 +57,10 @@ Pipeline::Pipeline(const Pipeline& other)
 , m_Name(other.m_Name)
 , m_Collection(other.m_Collection)
 , m_FilterList(other.m_FilterList)
+, m_Cache(other.m_Cache)
+, m_CheckpointPath(other.m_CheckpointPath)
+, m_CheckpointIndices(other.m_CheckpointIndices)
+, m_MemoryBudget(other.m_MemoryBudget)
 {
   resetCollectionParent();
 }
@@ -44,6 +70,10 @@ Pipeline::Pipeline(Pipeline&& other) noexcept
 , m_Name(std::move(other.m_Name))
 , m_Collection(std::move(other.m_Collection))
 , m_FilterList(std::move(other.m_FilterList))
+, m_Cache(std::move(other.m_Cache))
+, m_CheckpointPath(std::move(other.m_CheckpointPath))
+, m_CheckpointIndices(std::move(other.m_CheckpointIndices))
+, m_MemoryBudget(other.m_MemoryBudget)
 {
   resetCollectionParent();
 }
@@ -61,6 +91,10 @@ Pipeline& Pipeline::operator=(const Pipeline& rhs) noexcept
   m_Name = rhs.m_Name;
   m_Collection = rhs.m_Collection;
   m_FilterList = rhs.m_FilterList;
+  m_Cache = rhs.m_Cache;
+  m_CheckpointPath = rhs.m_CheckpointPath;
+  m_CheckpointIndices = rhs.m_CheckpointIndices;
+  m_MemoryBudget = rhs.m_MemoryBudget;
   resetCollectionParent();
   return *this;
 }
@@ -70,6 +104,10 @@ Pipeline& Pipeline::operator=(Pipeline&& rhs) noexcept
   m_Name = std::move(rhs.m_Name);
   m_Collection = std::move(rhs.m_Collection);
   m_FilterList = std::move(rhs.m_FilterList);
+  m_Cache = std::move(rhs.m_Cache);
+  m_CheckpointPath = std::move(rhs.m_CheckpointPath);
+  m_CheckpointIndices = std::move(rhs.m_CheckpointIndices);
+  m_MemoryBudget = rhs.m_MemoryBudget;
   resetCollectionParent();
   return *this;
 }
@@ -167,7 +205,98 @@ bool Pipeline::canPreflightFrom(index_type index) const
   {
     return false;
   }
-  return at(index - 1)->isPreflighted() && !hasErrorsBeforeIndex(index);
+  // Disabled nodes are skipped while preflighting and never store a result
+  const AbstractPipelineNode* previousNode = getPrecedingEnabledNode(index);
+  if(previousNode == nullptr)
+  {
+    return true;
+  }
+  return previousNode->isPreflighted() && !hasErrorsBeforeIndex(index);
+}
+
+Pipeline::index_type Pipeline::getFirstStaleIndex() const
+{
+  return std::min(m_FirstStaleIndex, size());
+}
+
+void Pipeline::invalidatePreflightFrom(index_type index)
+{
+  m_FirstStaleIndex = std::min(m_FirstStaleIndex, index);
+  invalidatePreflight();
+}
+
+bool Pipeline::preflightIncremental(const std::atomic_bool& shouldCancel, bool allowRenaming)
+{
+  const index_type startIndex = getFirstStaleIndex();
+  if(startIndex == size())
+  {
+    return !hasErrors();
+  }
+  if(!canPreflightFrom(startIndex))
+  {
+    return preflight(shouldCancel, allowRenaming);
+  }
+
+  const AbstractPipelineNode* previousNode = getPrecedingEnabledNode(startIndex);
+  DataStructure ds = previousNode != nullptr ? previousNode->getPreflightStructure() : DataStructure();
+  return preflightFrom(startIndex, ds, shouldCancel, allowRenaming);
+}
+
+Result<std::vector<NodeMemoryEstimate>> Pipeline::estimateMemoryUsage() const
+{
+  std::vector<NodeMemoryEstimate> estimates;
+  std::map<DataObject::IdType, uint64> arraysBefore;
+  uint64 bytesBefore = 0;
+  for(index_type index = 0; index < size(); index++)
+  {
+    const AbstractPipelineNode* node = m_Collection[index].get();
+    if(node->isDisabled())
+    {
+      continue;
+    }
+    if(!node->isPreflighted())
+    {
+      return MakeErrorResult<std::vector<NodeMemoryEstimate>>(-1, fmt::format("complex::Pipeline::estimateMemoryUsage: Node {} '{}' has not been preflighted successfully", index, node->getName()));
+    }
+
+    // DataObject ids carry over from one preflight DataStructure to the next
+    std::map<DataObject::IdType, uint64> arraysAfter = node->getPreflightStructure().getArrayMemoryUsage();
+    NodeMemoryEstimate estimate;
+    estimate.index = index;
+    estimate.name = node->getName();
+    estimate.bytesBefore = bytesBefore;
+    estimate.peakBytes = bytesBefore;
+    for(const auto& [id, bytes] : arraysAfter)
+    {
+      auto iter = arraysBefore.find(id);
+      uint64 previousBytes = iter != arraysBefore.end() ? iter->second : 0;
+      if(bytes > previousBytes)
+      {
+        estimate.peakBytes += bytes - previousBytes;
+      }
+      estimate.bytesAfter += bytes;
+    }
+    // Filters also know about the arrays they create and remove again before finishing
+    if(const auto* filterNode = dynamic_cast<const PipelineFilter*>(node); filterNode != nullptr)
+    {
+      estimate.peakBytes = std::max(estimate.peakBytes, filterNode->getPreflightPeakMemory());
+    }
+    estimates.push_back(std::move(estimate));
+
+    bytesBefore = estimates.back().bytesAfter;
+    arraysBefore = std::move(arraysAfter);
+  }
+  return {std::move(estimates)};
+}
+
+uint64 Pipeline::getMemoryBudget() const
+{
+  return m_MemoryBudget;
+}
+
+void Pipeline::setMemoryBudget(uint64 memoryBudget)
+{
+  m_MemoryBudget = memoryBudget;
 }
 
 bool Pipeline::preflightFrom(index_type index, DataStructure& ds, const std::atomic_bool& shouldCancel, bool allowRenaming)
@@ -188,6 +317,7 @@ bool Pipeline::preflightFrom(index_type index, DataStructure& ds, RenamedPaths&
   setHasErrors(false);
   size_t currentIndex = 0;
   bool returnValue = true;
+  index_type stopIndex = size();
   for(auto iter = begin() + index; iter != end(); iter++)
   {
     auto* node = iter->get();
@@ -203,6 +333,7 @@ bool Pipeline::preflightFrom(index_type index, DataStructure& ds, RenamedPaths&
     if(shouldCancel)
     {
       sendCancelledMessage();
+      stopIndex = iter - begin();
       break;
     }
     startObservingNode(iter->get());
@@ -221,10 +352,16 @@ bool Pipeline::preflightFrom(index_type index, DataStructure& ds, RenamedPaths&
     {
       setHasErrors(true);
       returnValue = false;
+      stopIndex = iter - begin();
       break;
     }
     currentIndex++;
   }
+  // Nodes before index keep their previous results
+  if(index <= m_FirstStaleIndex)
+  {
+    m_FirstStaleIndex = stopIndex;
+  }
   sendPipelineFaultMessage(m_FaultState);
   sendPipelineRunStateMessage(RunState::Idle);
   return returnValue;
@@ -233,7 +370,7 @@ bool Pipeline::preflightFrom(index_type index, DataStructure& ds, RenamedPaths&
 bool Pipeline::preflightFrom(index_type index, const std::atomic_bool& shouldCancel)
 {
   RenamedPaths renamedPaths;
-  return preflightFrom(index, renamedPaths);
+  return preflightFrom(index, renamedPaths, shouldCancel);
 }
 
 bool Pipeline::preflightFrom(index_type index, RenamedPaths& renamedPaths, const std::atomic_bool& shouldCancel)
@@ -247,9 +384,54 @@ bool Pipeline::preflightFrom(index_type index, RenamedPaths& renamedPaths, const
     return false;
   }
 
-  auto node = at(index - 1);
-  DataStructure ds = node->getPreflightStructure();
-  return preflightFrom(index, ds, shouldCancel);
+  const AbstractPipelineNode* previousNode = getPrecedingEnabledNode(index);
+  DataStructure ds = previousNode != nullptr ? previousNode->getPreflightStructure() : DataStructure();
+  return preflightFrom(index, ds, renamedPaths, shouldCancel);
+}
+
+std::shared_ptr<PipelineCache> Pipeline::getCache() const
+{
+  return m_Cache;
+}
+
+void Pipeline::setCache(std::shared_ptr<PipelineCache> cache)
+{
+  m_Cache = std::move(cache);
+}
+
+const std::filesystem::path& Pipeline::getCheckpointPath() const
+{
+  return m_CheckpointPath;
+}
+
+void Pipeline::setCheckpointPath(const std::filesystem::path& checkpointPath)
+{
+  m_CheckpointPath = checkpointPath;
+}
+
+const std::vector<Pipeline::index_type>& Pipeline::getCheckpointIndices() const
+{
+  return m_CheckpointIndices;
+}
+
+void Pipeline::setCheckpointIndices(const std::vector<index_type>& indices)
+{
+  m_CheckpointIndices = indices;
+}
+
+bool Pipeline::resumeFromCheckpoint(const std::atomic_bool& shouldCancel)
+{
+  if(!m_CheckpointPath.empty() && std::filesystem::exists(m_CheckpointPath))
+  {
+    Result<DREAM3D::CheckpointData> checkpointResult = DREAM3D::ReadCheckpoint(m_CheckpointPath);
+    // A checkpoint written by a different pipeline cannot be resumed
+    if(checkpointResult.valid() && checkpointResult.value().pipelineJson == toJson().dump() && checkpointResult.value().nextIndex < size())
+    {
+      DREAM3D::CheckpointData& checkpoint = checkpointResult.value();
+      return executeFrom(checkpoint.nextIndex, checkpoint.dataStructure, shouldCancel);
+    }
+  }
+  return execute(shouldCancel);
 }
 
 bool Pipeline::canExecuteFrom(index_type index) const
@@ -271,9 +453,43 @@ bool Pipeline::executeFrom(index_type index, DataStructure& ds, const std::atomi
   {
     return false;
   }
+  if(m_MemoryBudget > 0)
+  {
+    if(auto [budgetResult, faultIndex] = checkMemoryBudget(index, shouldCancel); budgetResult.invalid())
+    {
+      setHasErrors();
+      sendFilterFaultDetailMessage(static_cast<int32>(faultIndex), {}, budgetResult.errors());
+      sendPipelineFaultMessage(m_FaultState);
+      return false;
+    }
+  }
   bool returnValue = true;
+  bool storeFailed = false;
   // Send notification that the pipeline is executing
   sendPipelineRunStateMessage(RunState::Executing);
+
+  // Restore the longest unchanged prefix instead of executing it
+  const bool useCache = m_Cache != nullptr && index == 0 && ds.getSize() == 0;
+  std::vector<uint64> cacheKeys;
+  if(useCache)
+  {
+    cacheKeys = getCacheKeys();
+    for(index_type cachedCount = cacheKeys.size(); cachedCount > 0; cachedCount--)
+    {
+      if(at(cachedCount - 1)->isDisabled() || !m_Cache->contains(cacheKeys[cachedCount - 1]))
+      {
+        continue;
+      }
+      Result<DataStructure> snapshotResult = m_Cache->load(cacheKeys[cachedCount - 1]);
+      if(snapshotResult.valid())
+      {
+        ds = std::move(snapshotResult.value());
+        index = cachedCount;
+        break;
+      }
+    }
+  }
+
   size_t currentIndex = 0;
   // Send notifications that all the filters in the pipeline are queued up
   for(auto iter = begin() + index; iter != end(); iter++)
@@ -295,7 +511,9 @@ bool Pipeline::executeFrom(index_type index, DataStructure& ds, const std::atomi
       continue;
     }
 
+    auto startTime = std::chrono::steady_clock::now();
     bool success = filter->execute(ds, shouldCancel);
+    auto executionTime = std::chrono::steady_clock::now() - startTime;
     // Check if the filter was cancelled, and send out signal if it was.
     if(shouldCancel)
     {
@@ -310,6 +528,36 @@ bool Pipeline::executeFrom(index_type index, DataStructure& ds, const std::atomi
       returnValue = false;
       break;
     }
+
+    // The cache is only an optimization, so a snapshot that cannot be written is reported as a warning
+    index_type filterIndex = iter - begin();
+    if(useCache && filterIndex < cacheKeys.size() && executionTime >= m_Cache->getMinimumExecutionTime())
+    {
+      if(Result<> storeResult = m_Cache->store(cacheKeys[filterIndex], ds); storeResult.invalid())
+      {
+        storeFailed = true;
+        sendFilterFaultDetailMessage(static_cast<int32>(filterIndex), ConvertToWarnings(storeResult), {});
+      }
+    }
+
+    // A failed checkpoint leaves the previous one in place and does not stop the pipeline
+    if(!m_CheckpointPath.empty() && filterIndex + 1 < size() &&
+       (m_CheckpointIndices.empty() || std::find(m_CheckpointIndices.cbegin(), m_CheckpointIndices.cend(), filterIndex) != m_CheckpointIndices.cend()))
+    {
+      DREAM3D::WriteCheckpoint(m_CheckpointPath, ds, *this, filterIndex + 1);
+    }
+  }
+
+  // Set after the loop so the next filter's own warning state does not clear it
+  if(storeFailed)
+  {
+    setHasWarnings();
+  }
+
+  if(returnValue && !shouldCancel && !m_CheckpointPath.empty())
+  {
+    std::error_code errorCode;
+    std::filesystem::remove(m_CheckpointPath, errorCode);
   }
 
   setDataStructure(ds);
@@ -360,6 +608,71 @@ bool Pipeline::hasErrorsBeforeIndex(index_type index) const
   return false;
 }
 
+std::vector<uint64> Pipeline::getCacheKeys() const
+{
+  std::vector<uint64> cacheKeys;
+  cacheKeys.reserve(size());
+  uint64 previousKey = 0;
+  for(const auto& node : m_Collection)
+  {
+    if(node->isDisabled())
+    {
+      cacheKeys.push_back(previousKey);
+      continue;
+    }
+    const auto* filterNode = dynamic_cast<const PipelineFilter*>(node.get());
+    if(filterNode == nullptr || !PipelineCache::IsCacheable(*filterNode))
+    {
+      break;
+    }
+    previousKey = PipelineCache::HashFilter(previousKey, *filterNode);
+    cacheKeys.push_back(previousKey);
+  }
+  return cacheKeys;
+}
+
+std::pair<Result<>, Pipeline::index_type> Pipeline::checkMemoryBudget(index_type index, const std::atomic_bool& shouldCancel)
+{
+  // Only the nodes' own preflight state matters, not errors left over from an earlier execution
+  preflightIncremental(shouldCancel);
+  Result<std::vector<NodeMemoryEstimate>> estimatesResult = estimateMemoryUsage();
+  if(estimatesResult.invalid())
+  {
+    index_type faultIndex = index;
+    for(index_type i = 0; i < size(); i++)
+    {
+      if(m_Collection[i]->isEnabled() && !m_Collection[i]->isPreflighted())
+      {
+        faultIndex = i;
+        break;
+      }
+    }
+    return {ConvertResult(std::move(estimatesResult)), faultIndex};
+  }
+  for(const auto& estimate : estimatesResult.value())
+  {
+    if(estimate.index >= index && estimate.peakBytes > m_MemoryBudget)
+    {
+      return {MakeErrorResult(-2, fmt::format("complex::Pipeline::checkMemoryBudget: Node {} '{}' has a projected peak memory use of {} bytes, which is over the memory budget of {} bytes",
+                                              estimate.index, estimate.name, estimate.peakBytes, m_MemoryBudget)),
+              estimate.index};
+    }
+  }
+  return {Result<>{}, index};
+}
+
+const AbstractPipelineNode* Pipeline::getPrecedingEnabledNode(index_type index) const
+{
+  for(index_type i = std::min(index, size()); i > 0; i--)
+  {
+    if(m_Collection[i - 1]->isEnabled())
+    {
+      return m_Collection[i - 1].get();
+    }
+  }
+  return nullptr;
+}
+
 usize Pipeline::size() const
 {
   return m_Collection.size();
@@ -437,6 +750,7 @@ bool Pipeline::insertAt(iterator pos, std::shared_ptr<AbstractPipelineNode> node
   AbstractPipelineNode* ptr = node.get();
   m_Collection.insert(pos, std::move(node));
   ptr->setParentPipeline(this);
+  invalidatePreflightFrom(index);
   notify(std::make_shared<NodeAddedMessage>(this, ptr, index));
   return true;
 }
@@ -458,6 +772,7 @@ bool Pipeline::remove(iterator iter)
   auto node = iter->get();
   node->setParentPipeline(nullptr);
   m_Collection.erase(iter);
+  invalidatePreflightFrom(index);
   notify(std::make_shared<NodeRemovedMessage>(this, index));
   return true;
 }
@@ -473,6 +788,7 @@ bool Pipeline::remove(const_iterator iter)
   auto node = iter->get();
   node->setParentPipeline(nullptr);
   m_Collection.erase(iter);
+  invalidatePreflightFrom(index);
   notify(std::make_shared<NodeRemovedMessage>(this, index));
   return true;
 }
@@ -510,6 +826,7 @@ bool Pipeline::move(index_type fromIndex, index_type toIndex)
     std::rotate(toIter, fromIter, fromIter + 1);
   }
 
+  invalidatePreflightFrom(std::min(fromIndex, toIndex));
   notify(std::make_shared<NodeMovedMessage>(this, fromIndex, toIndex));
   return true;
 }
@@ -755,6 +1072,43 @@ Result<Pipeline> Pipeline::FromFile(const std::filesystem::path& path, FilterLis
   return FromJson(pipelineJson, filterList);
 }
 
+Result<nlohmann::json> Pipeline::ApplyArgumentOverrides(nlohmann::json pipelineJson, const nlohmann::json& overrides)
+{
+  if(!pipelineJson.contains(k_PipelineItemsKey.view()) || !pipelineJson[k_PipelineItemsKey].is_array())
+  {
+    return MakeErrorResult<nlohmann::json>(-1, fmt::format("Pipeline JSON did not contain key '{}'", k_PipelineItemsKey.view()));
+  }
+  if(!overrides.is_object())
+  {
+    return MakeErrorResult<nlohmann::json>(-2, "Argument overrides must be a JSON object");
+  }
+
+  auto& items = pipelineJson[k_PipelineItemsKey];
+  for(const auto& [indexString, args] : overrides.items())
+  {
+    usize index = 0;
+    const char* end = indexString.data() + indexString.size();
+    auto [ptr, errorCode] = std::from_chars(indexString.data(), end, index);
+    if(indexString.empty() || errorCode != std::errc() || ptr != end)
+    {
+      return MakeErrorResult<nlohmann::json>(-3, fmt::format("Argument override key '{}' is not a filter index", indexString));
+    }
+    if(index >= items.size())
+    {
+      return MakeErrorResult<nlohmann::json>(-4, fmt::format("No filter at index {} to override the arguments of", index));
+    }
+    if(!args.is_object())
+    {
+      return MakeErrorResult<nlohmann::json>(-5, fmt::format("Argument overrides of the filter at index {} must be a JSON object", index));
+    }
+    for(const auto& [name, value] : args.items())
+    {
+      items[index][k_ArgsKey.view()][name] = value;
+    }
+  }
+  return {std::move(pipelineJson)};
+}
+
 void Pipeline::onNotify(AbstractPipelineNode* node, const std::shared_ptr<AbstractPipelineMessage>& msg)
 {
   notify(std::make_shared<PipelineNodeMessage>(node, msg));
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <filesystem>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "complex/Common/Result.hpp"
@@ -12,6 +15,21 @@ namespace complex
 {
 class FilterHandle;
 class FilterList;
+class PipelineCache;
+
+/**
+ * @brief The projected memory use of one enabled pipeline node, measured as
+ * the bytes held by the DataArrays of the DataStructures preflight produces
+ * before and after the node.
+ */
+struct COMPLEX_EXPORT NodeMemoryEstimate
+{
+  uint64 index = 0;
+  std::string name;
+  uint64 bytesBefore = 0; // Held when the node starts
+  uint64 peakBytes = 0;   // bytesBefore plus every array the node creates or grows
+  uint64 bytesAfter = 0;  // Held once the node's removed arrays are freed
+};
 
 /**
  * @class Pipeline
@@ -62,6 +80,18 @@ public:
    */
   static Result<Pipeline> FromFile(const std::filesystem::path& path, FilterList* filterList);
 
+  /**
+   * @brief Returns a copy of the pipeline json with filter arguments replaced.
+   * The overrides are a json object of the form {"0": {"input_file": "scan_1.ang"}}
+   * mapping the index of a filter to the arguments to replace, written in the
+   * same format as the pipeline json. Returns an error if an index is not a
+   * whole number or there is no filter at that index.
+   * @param pipelineJson
+   * @param overrides
+   * @return Result<nlohmann::json>
+   */
+  static Result<nlohmann::json> ApplyArgumentOverrides(nlohmann::json pipelineJson, const nlohmann::json& overrides);
+
   /**
    * @brief Constructs a pipeline with the specified name. If no name is
    * provided, a default name of "Unnamed Pipeline" will be used.
@@ -217,6 +247,61 @@ public:
    */
   bool canPreflightFrom(index_type index) const;
 
+  /**
+   * @brief Returns the index of the first node whose preflight result is out
+   * of date. Nodes are marked out of date when their arguments change, when
+   * they are enabled or disabled, or when nodes are inserted, removed, or
+   * moved in front of them. Returns size() if every node is up to date.
+   * @return index_type
+   */
+  index_type getFirstStaleIndex() const;
+
+  /**
+   * @brief Marks the node at the target index and every node after it as
+   * needing to be preflighted again.
+   * @param index
+   */
+  void invalidatePreflightFrom(index_type index);
+
+  /**
+   * @brief Preflights only the nodes from the first out of date node onwards,
+   * starting from the DataStructure stored by the closest enabled node before
+   * it. Falls back to a full preflight if that node has no usable preflight
+   * data. Returns true if the pipeline segment completes without errors.
+   * Returns false otherwise.
+   * @param shouldCancel
+   * @param allowRenaming
+   * @return bool
+   */
+  bool preflightIncremental(const std::atomic_bool& shouldCancel = false, bool allowRenaming = false);
+
+  /**
+   * @brief Returns the projected memory use of each enabled node, in pipeline
+   * order, from the DataStructures stored by the last preflight. A node's
+   * peak assumes the arrays it removes are still held while it creates its
+   * outputs, and includes arrays a filter removes again before finishing.
+   * Returns an error if an enabled node has not been preflighted successfully.
+   * @return Result<std::vector<NodeMemoryEstimate>>
+   */
+  Result<std::vector<NodeMemoryEstimate>> estimateMemoryUsage() const;
+
+  /**
+   * @brief Returns the number of bytes the projected peak memory use may not
+   * exceed for the pipeline to execute. 0 means there is no budget.
+   * @return uint64
+   */
+  uint64 getMemoryBudget() const;
+
+  /**
+   * @brief Sets the number of bytes the projected peak memory use may not
+   * exceed for the pipeline to execute. With a budget set, executing first
+   * brings the preflight up to date and fails without running any node if a
+   * remaining node's peak is over the budget. The error naming that node is
+   * sent as a filter fault detail message. Pass 0 to remove the budget.
+   * @param memoryBudget
+   */
+  void setMemoryBudget(uint64 memoryBudget);
+
   /**
    * @brief Checks if the pipeline can be executed at the target index.
    *
@@ -239,6 +324,65 @@ public:
    */
   bool executeFrom(index_type index, DataStructure& ds, const std::atomic_bool& shouldCancel = false);
 
+  /**
+   * @brief Returns the cache used to skip unchanged filters when executing.
+   * Returns nullptr if caching is disabled.
+   * @return std::shared_ptr<PipelineCache>
+   */
+  std::shared_ptr<PipelineCache> getCache() const;
+
+  /**
+   * @brief Sets the cache used to skip unchanged filters when executing. When
+   * the pipeline is executed from the start with an empty DataStructure, the
+   * longest prefix with a stored result is restored from the cache instead of
+   * being executed, and the results of the filters that do run are added to
+   * it. Pass nullptr to disable caching.
+   * @param cache
+   */
+  void setCache(std::shared_ptr<PipelineCache> cache);
+
+  /**
+   * @brief Returns the path checkpoints are written to while executing.
+   * Returns an empty path if checkpoints are disabled.
+   * @return const std::filesystem::path&
+   */
+  const std::filesystem::path& getCheckpointPath() const;
+
+  /**
+   * @brief Sets the path checkpoints are written to while executing. Each
+   * checkpoint replaces the previous one, and the file is removed once the
+   * pipeline finishes without errors. Pass an empty path to disable
+   * checkpoints.
+   * @param checkpointPath
+   */
+  void setCheckpointPath(const std::filesystem::path& checkpointPath);
+
+  /**
+   * @brief Returns the indices of the nodes a checkpoint is written after.
+   * An empty list means a checkpoint is written after every node.
+   * @return const std::vector<index_type>&
+   */
+  const std::vector<index_type>& getCheckpointIndices() const;
+
+  /**
+   * @brief Sets the indices of the nodes a checkpoint is written after. Pass
+   * an empty list to write a checkpoint after every node. Long running nodes
+   * are the ones worth selecting.
+   * @param indices
+   */
+  void setCheckpointIndices(const std::vector<index_type>& indices);
+
+  /**
+   * @brief Executes the pipeline, resuming from the checkpoint at the
+   * checkpoint path if there is one that was written by this pipeline. The
+   * pipeline is executed from the start otherwise.
+   * Returns true if the pipeline segment completes without errors. Returns
+   * false otherwise.
+   * @param shouldCancel
+   * @return bool
+   */
+  bool resumeFromCheckpoint(const std::atomic_bool& shouldCancel = false);
+
   /**
    * @brief Executes the pipeline segment from the target position using the
    * previous node's DataStructure. Starts with an empty DataStructure if
@@ -598,10 +742,43 @@ private:
    */
   bool hasErrorsBeforeIndex(index_type index) const;
 
+  /**
+   * @brief Returns the closest enabled node before the specified index.
+   * Returns nullptr if there is none.
+   * @param index
+   * @return const AbstractPipelineNode*
+   */
+  const AbstractPipelineNode* getPrecedingEnabledNode(index_type index) const;
+
+  /**
+   * @brief Returns the cache key of each node from the start of the pipeline
+   * up to the first node that is not a cacheable filter, see
+   * PipelineCache::IsCacheable(). Disabled nodes share the key of the enabled
+   * node before them.
+   * @return std::vector<uint64>
+   */
+  std::vector<uint64> getCacheKeys() const;
+
+  /**
+   * @brief Checks that the projected peak memory use of every enabled node
+   * from the target index onwards fits in the memory budget. Brings the
+   * preflight up to date first. Returns an error naming the first node that
+   * is over the budget or could not be preflighted, along with that node's index.
+   * @param index
+   * @param shouldCancel
+   * @return std::pair<Result<>, index_type>
+   */
+  std::pair<Result<>, index_type> checkMemoryBudget(index_type index, const std::atomic_bool& shouldCancel);
+
   ////////////
   // Variables
   std::string m_Name;
   collection_type m_Collection;
   FilterList* m_FilterList = nullptr;
+  index_type m_FirstStaleIndex = 0;
+  std::shared_ptr<PipelineCache> m_Cache;
+  std::filesystem::path m_CheckpointPath;
+  std::vector<index_type> m_CheckpointIndices;
+  uint64 m_MemoryBudget = 0;
 };
 } // namespace complex
@@ -0,0 +1,375 @@
+#include "PipelineCache.hpp"
+
+#include "complex/Common/StringLiteral.hpp"
+#include "complex/Parameters/BoolParameter.hpp"
+#include "complex/Parameters/Dream3dImportParameter.hpp"
+#include "complex/Parameters/FileSystemPathParameter.hpp"
+#include "complex/Parameters/GeneratedFileListParameter.hpp"
+#include "complex/Parameters/ImportCSVDataParameter.hpp"
+#include "complex/Parameters/ImportHDF5DatasetParameter.hpp"
+#include "complex/Pipeline/PipelineFilter.hpp"
+#include "complex/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+using namespace complex;
+
+namespace
+{
+constexpr StringLiteral k_SnapshotExtension = ".dream3d";
+// Bump when the snapshot format or the way keys are built changes
+constexpr uint64 k_CacheFormatVersion = 2;
+constexpr uint64 k_FnvOffsetBasis = 14695981039346656037ull;
+constexpr uint64 k_FnvPrime = 1099511628211ull;
+
+/**
+ * @brief 64 bit FNV-1a hash of the bytes appended to the running hash.
+ * @param hash
+ * @param bytes
+ * @return uint64
+ */
+uint64 HashBytes(uint64 hash, std::string_view bytes)
+{
+  for(char byte : bytes)
+  {
+    hash ^= static_cast<uint8>(byte);
+    hash *= k_FnvPrime;
+  }
+  return hash;
+}
+
+template <typename T>
+uint64 HashValue(uint64 hash, T value)
+{
+  return HashBytes(hash, std::string_view(reinterpret_cast<const char*>(&value), sizeof(T)));
+}
+
+/**
+ * @brief Appends the size and modification time of the file to the running
+ * hash. For a directory, those of every file directly inside it are appended.
+ * @param hash
+ * @param path
+ * @return uint64
+ */
+uint64 HashFileState(uint64 hash, const fs::path& path)
+{
+  std::error_code errorCode;
+  if(fs::is_regular_file(path, errorCode))
+  {
+    hash = HashBytes(hash, path.string());
+    hash = HashValue(hash, static_cast<uint64>(fs::file_size(path, errorCode)));
+    return HashValue(hash, static_cast<int64>(fs::last_write_time(path, errorCode).time_since_epoch().count()));
+  }
+  if(fs::is_directory(path, errorCode))
+  {
+    std::vector<fs::path> files;
+    for(const auto& entry : fs::directory_iterator(path, errorCode))
+    {
+      if(entry.is_regular_file(errorCode))
+      {
+        files.push_back(entry.path());
+      }
+    }
+    std::sort(files.begin(), files.end());
+    for(const auto& file : files)
+    {
+      hash = HashFileState(hash, file);
+    }
+  }
+  return hash;
+}
+
+/**
+ * @brief Returns the paths of the files or directories an argument refers to.
+ * @param value
+ * @return std::vector<fs::path>
+ */
+std::vector<fs::path> GetArgumentPaths(const std::any& value)
+{
+  if(const auto* path = std::any_cast<fs::path>(&value); path != nullptr)
+  {
+    return {*path};
+  }
+  if(const auto* importData = std::any_cast<Dream3dImportParameter::ValueType>(&value); importData != nullptr)
+  {
+    return {importData->FilePath};
+  }
+  if(const auto* fileList = std::any_cast<GeneratedFileListParameter::ValueType>(&value); fileList != nullptr)
+  {
+    std::vector<std::string> files = fileList->generate();
+    return {files.cbegin(), files.cend()};
+  }
+  if(const auto* csvData = std::any_cast<ImportCSVDataParameter::ValueType>(&value); csvData != nullptr)
+  {
+    return {csvData->inputFilePath};
+  }
+  if(const auto* hdf5Data = std::any_cast<ImportHDF5DatasetParameter::ValueType>(&value); hdf5Data != nullptr)
+  {
+    return {hdf5Data->inputFile};
+  }
+  return {};
+}
+
+/**
+ * @brief Returns true if the parameter key names a "use seed" switch, however
+ * the filter spells it ("use_seed", "UseSeed", "use seed").
+ * @param key
+ * @return bool
+ */
+bool IsUseSeedKey(std::string_view key)
+{
+  std::string normalized;
+  for(char character : key)
+  {
+    if(std::isalnum(static_cast<unsigned char>(character)) != 0)
+    {
+      normalized.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(character))));
+    }
+  }
+  return normalized == "useseed";
+}
+
+/**
+ * @brief Parses a snapshot file name back into its key.
+ * @param path
+ * @return std::optional<PipelineCache::KeyType>
+ */
+std::optional<PipelineCache::KeyType> ParseSnapshotKey(const fs::path& path)
+{
+  if(path.extension().string() != k_SnapshotExtension.view())
+  {
+    return {};
+  }
+  std::string stem = path.stem().string();
+  if(stem.size() != 16 || !std::all_of(stem.cbegin(), stem.cend(), [](char value) { return std::isxdigit(static_cast<unsigned char>(value)) != 0; }))
+  {
+    return {};
+  }
+  return std::stoull(stem, nullptr, 16);
+}
+} // namespace
+
+PipelineCache::PipelineCache(const fs::path& directory, uint64 sizeBudget)
+: m_Directory(directory)
+, m_SizeBudget(sizeBudget)
+{
+  std::error_code errorCode;
+  fs::create_directories(m_Directory, errorCode);
+
+  // Pick up the snapshots of earlier runs, oldest first
+  std::vector<std::pair<fs::file_time_type, KeyType>> existing;
+  for(const auto& entry : fs::directory_iterator(m_Directory, errorCode))
+  {
+    auto key = ParseSnapshotKey(entry.path());
+    if(!key.has_value() || !entry.is_regular_file(errorCode))
+    {
+      continue;
+    }
+    existing.emplace_back(entry.last_write_time(errorCode), *key);
+  }
+  std::sort(existing.begin(), existing.end());
+  for(const auto& [writeTime, key] : existing)
+  {
+    uint64 size = fs::file_size(getSnapshotPath(key), errorCode);
+    if(errorCode)
+    {
+      continue;
+    }
+    m_Entries[key] = Entry{size, ++m_UseCounter};
+    m_Size += size;
+  }
+  evict();
+}
+
+PipelineCache::~PipelineCache() noexcept = default;
+
+PipelineCache::KeyType PipelineCache::HashFilter(KeyType previousKey, const PipelineFilter& filter)
+{
+  uint64 hash = HashValue(k_FnvOffsetBasis, previousKey);
+  // Snapshots left by a build that computes different results must not be reused
+  hash = HashValue(hash, k_CacheFormatVersion);
+  hash = HashBytes(hash, COMPLEX_VERSION_STRING);
+  hash = HashBytes(hash, filter.toJson().dump());
+
+  // The contents of input files are not part of the arguments
+  for(const auto& [name, value] : filter.getArguments())
+  {
+    for(const auto& path : GetArgumentPaths(value))
+    {
+      hash = HashFileState(hash, path);
+    }
+  }
+  return hash;
+}
+
+bool PipelineCache::IsCacheable(const PipelineFilter& filter)
+{
+  const IFilter* iFilter = filter.getFilter();
+  if(iFilter == nullptr)
+  {
+    return false;
+  }
+  const Arguments arguments = filter.getArguments();
+  for(const auto& [key, parameter] : iFilter->parameters())
+  {
+    // Without a fixed seed the filter seeds itself from the clock, so its result is not a function of its arguments
+    if(const auto* boolParameter = dynamic_cast<const BoolParameter*>(parameter.get()); boolParameter != nullptr && IsUseSeedKey(key))
+    {
+      const std::any useSeed = arguments.contains(key) ? arguments.at(key) : boolParameter->defaultValue();
+      const auto* useSeedValue = std::any_cast<bool>(&useSeed);
+      if(useSeedValue == nullptr || !*useSeedValue)
+      {
+        return false;
+      }
+      continue;
+    }
+    const auto* pathParameter = dynamic_cast<const FileSystemPathParameter*>(parameter.get());
+    if(pathParameter == nullptr)
+    {
+      continue;
+    }
+    FileSystemPathParameter::PathType pathType = pathParameter->getPathType();
+    if(pathType == FileSystemPathParameter::PathType::OutputFile || pathType == FileSystemPathParameter::PathType::OutputDir)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+const fs::path& PipelineCache::getDirectory() const
+{
+  return m_Directory;
+}
+
+uint64 PipelineCache::getSizeBudget() const
+{
+  return m_SizeBudget;
+}
+
+void PipelineCache::setSizeBudget(uint64 sizeBudget)
+{
+  m_SizeBudget = sizeBudget;
+  evict();
+}
+
+uint64 PipelineCache::getSize() const
+{
+  return m_Size;
+}
+
+usize PipelineCache::getNumberOfSnapshots() const
+{
+  return m_Entries.size();
+}
+
+std::chrono::milliseconds PipelineCache::getMinimumExecutionTime() const
+{
+  return m_MinimumExecutionTime;
+}
+
+void PipelineCache::setMinimumExecutionTime(std::chrono::milliseconds minimumTime)
+{
+  m_MinimumExecutionTime = minimumTime;
+}
+
+bool PipelineCache::contains(KeyType key) const
+{
+  return m_Entries.count(key) > 0;
+}
+
+Result<DataStructure> PipelineCache::load(KeyType key)
+{
+  auto iter = m_Entries.find(key);
+  if(iter == m_Entries.end())
+  {
+    return MakeErrorResult<DataStructure>(-1, fmt::format("complex::PipelineCache::load: No snapshot is stored for key {:016x}", key));
+  }
+  iter->second.lastUse = ++m_UseCounter;
+
+  Result<DataStructure> snapshotResult = DREAM3D::ImportDataStructureFromFile(getSnapshotPath(key));
+  if(snapshotResult.invalid())
+  {
+    remove(key);
+  }
+  return snapshotResult;
+}
+
+Result<> PipelineCache::store(KeyType key, const DataStructure& dataStructure)
+{
+  if(auto iter = m_Entries.find(key); iter != m_Entries.end())
+  {
+    iter->second.lastUse = ++m_UseCounter;
+    return {};
+  }
+
+  // Write under a temporary name so an interrupted write never leaves a
+  // snapshot that looks complete
+  const fs::path snapshotPath = getSnapshotPath(key);
+  fs::path tempPath = snapshotPath;
+  tempPath += ".tmp";
+  Result<> writeResult = DREAM3D::WriteFile(tempPath, dataStructure);
+  std::error_code errorCode;
+  if(writeResult.invalid())
+  {
+    fs::remove(tempPath, errorCode);
+    return writeResult;
+  }
+  fs::rename(tempPath, snapshotPath, errorCode);
+  if(errorCode)
+  {
+    fs::remove(tempPath, errorCode);
+    return MakeErrorResult(-2, fmt::format("complex::PipelineCache::store: Unable to move the snapshot to '{}'", snapshotPath.string()));
+  }
+
+  uint64 size = fs::file_size(snapshotPath, errorCode);
+  m_Entries[key] = Entry{size, ++m_UseCounter};
+  m_Size += size;
+  evict();
+  return {};
+}
+
+void PipelineCache::clear()
+{
+  while(!m_Entries.empty())
+  {
+    remove(m_Entries.begin()->first);
+  }
+}
+
+fs::path PipelineCache::getSnapshotPath(KeyType key) const
+{
+  return m_Directory / fmt::format("{:016x}{}", key, k_SnapshotExtension.view());
+}
+
+void PipelineCache::remove(KeyType key)
+{
+  auto iter = m_Entries.find(key);
+  if(iter == m_Entries.end())
+  {
+    return;
+  }
+  m_Size -= iter->second.size;
+  m_Entries.erase(iter);
+
+  std::error_code errorCode;
+  fs::remove(getSnapshotPath(key), errorCode);
+}
+
+void PipelineCache::evict()
+{
+  while(m_Size > m_SizeBudget && !m_Entries.empty())
+  {
+    auto oldest = std::min_element(m_Entries.cbegin(), m_Entries.cend(), [](const auto& lhs, const auto& rhs) { return lhs.second.lastUse < rhs.second.lastUse; });
+    remove(oldest->first);
+  }
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "complex/Common/Result.hpp"
+#include "complex/Common/Types.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/complex_export.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+
+namespace complex
+{
+class PipelineFilter;
+
+/**
+ * @class PipelineCache
+ * @brief The PipelineCache class is a content addressed store of DataStructure
+ * snapshots taken while executing a Pipeline. Each snapshot is the result of
+ * running a prefix of the pipeline and is stored as a .dream3d file named
+ * after the key of the last filter in that prefix.
+ *
+ * A filter's key is built from the key of the filter before it, the cache
+ * format and library versions, the filter's arguments as written by toJson(),
+ * and the size and modification time of the files its arguments refer to.
+ * Because the key of the previous filter identifies the content of a filter's
+ * input, two prefixes with the same key produce the same DataStructure as long
+ * as their filters are deterministic. Filters that write files are not
+ * cacheable, since restoring their result would skip writing the files, and
+ * neither are filters seeded from the clock. Filters that finish faster than
+ * the minimum execution time are not stored.
+ *
+ * The total size of the stored snapshots is kept under a budget by removing
+ * the least recently used snapshots. Pointing the cache at a RAM backed
+ * directory keeps the snapshots in memory.
+ */
+class COMPLEX_EXPORT PipelineCache
+{
+public:
+  using KeyType = uint64;
+
+  /**
+   * @brief Filters that finish faster than this are rerun rather than stored,
+   * since writing and reading a snapshot takes tens of milliseconds.
+   */
+  static constexpr std::chrono::milliseconds k_DefaultMinimumExecutionTime = std::chrono::milliseconds(100);
+
+  /**
+   * @brief Constructs a PipelineCache that stores its snapshots in the target
+   * directory. Snapshots left in the directory by an earlier run are reused.
+   * @param directory
+   * @param sizeBudget Maximum number of bytes used by the stored snapshots
+   */
+  PipelineCache(const std::filesystem::path& directory, uint64 sizeBudget);
+
+  ~PipelineCache() noexcept;
+
+  PipelineCache(const PipelineCache&) = delete;
+  PipelineCache(PipelineCache&&) noexcept = default;
+  PipelineCache& operator=(const PipelineCache&) = delete;
+  PipelineCache& operator=(PipelineCache&&) noexcept = default;
+
+  /**
+   * @brief Returns the key of a filter given the key of the enabled filter
+   * before it. Use 0 as the previous key for the first filter.
+   * @param previousKey
+   * @param filter
+   * @return KeyType
+   */
+  static KeyType HashFilter(KeyType previousKey, const PipelineFilter& filter);
+
+  /**
+   * @brief Returns false if the filter has an output file or directory
+   * parameter, if it has a "use seed" parameter that is turned off, or if the
+   * filter could not be loaded. Filters without a fixed seed seed themselves
+   * from the clock, so their result cannot be restored from an earlier run.
+   * @param filter
+   * @return bool
+   */
+  static bool IsCacheable(const PipelineFilter& filter);
+
+  /**
+   * @brief Returns the directory the snapshots are stored in.
+   * @return const std::filesystem::path&
+   */
+  const std::filesystem::path& getDirectory() const;
+
+  /**
+   * @brief Returns the maximum number of bytes used by the stored snapshots.
+   * @return uint64
+   */
+  uint64 getSizeBudget() const;
+
+  /**
+   * @brief Sets the maximum number of bytes used by the stored snapshots and
+   * removes snapshots until the budget is met.
+   * @param sizeBudget
+   */
+  void setSizeBudget(uint64 sizeBudget);
+
+  /**
+   * @brief Returns the number of bytes used by the stored snapshots.
+   * @return uint64
+   */
+  uint64 getSize() const;
+
+  /**
+   * @brief Returns the number of stored snapshots.
+   * @return usize
+   */
+  usize getNumberOfSnapshots() const;
+
+  /**
+   * @brief Returns the minimum time a filter has to take to execute before
+   * its result is stored. Results that are cheap to recompute are not worth
+   * the time spent writing them.
+   * @return std::chrono::milliseconds
+   */
+  std::chrono::milliseconds getMinimumExecutionTime() const;
+
+  /**
+   * @brief Sets the minimum time a filter has to take to execute before its
+   * result is stored.
+   * @param minimumTime
+   */
+  void setMinimumExecutionTime(std::chrono::milliseconds minimumTime);
+
+  /**
+   * @brief Returns true if a snapshot is stored for the key.
+   * @param key
+   * @return bool
+   */
+  bool contains(KeyType key) const;
+
+  /**
+   * @brief Reads the snapshot stored for the key. Snapshots that cannot be
+   * read are removed from the cache.
+   * @param key
+   * @return Result<DataStructure>
+   */
+  Result<DataStructure> load(KeyType key);
+
+  /**
+   * @brief Writes a snapshot of the DataStructure for the key, then removes
+   * the least recently used snapshots until the size budget is met. Snapshots
+   * larger than the whole budget are not kept.
+   * @param key
+   * @param dataStructure
+   * @return Result<>
+   */
+  Result<> store(KeyType key, const DataStructure& dataStructure);
+
+  /**
+   * @brief Removes every stored snapshot.
+   */
+  void clear();
+
+private:
+  struct Entry
+  {
+    uint64 size = 0;
+    uint64 lastUse = 0;
+  };
+
+  /**
+   * @brief Returns the path of the snapshot file for the key.
+   * @param key
+   * @return std::filesystem::path
+   */
+  std::filesystem::path getSnapshotPath(KeyType key) const;
+
+  /**
+   * @brief Removes the snapshot stored for the key.
+   * @param key
+   */
+  void remove(KeyType key);
+
+  /**
+   * @brief Removes the least recently used snapshots until the size budget is met.
+   */
+  void evict();
+
+  std::filesystem::path m_Directory;
+  uint64 m_SizeBudget = 0;
+  uint64 m_Size = 0;
+  uint64 m_UseCounter = 0;
+  std::chrono::milliseconds m_MinimumExecutionTime = k_DefaultMinimumExecutionTime;
+  std::map<KeyType, Entry> m_Entries;
+};
+} // namespace complex
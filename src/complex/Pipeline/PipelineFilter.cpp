@@ -1,12 +1,15 @@
 #include "PipelineFilter.hpp"
 
 #include <algorithm>
+#include <map>
+#include <unordered_set>
 
 #include "complex/Core/Application.hpp"
 #include "complex/Filter/FilterList.hpp"
 #include "complex/Pipeline/Messaging/FilterPreflightMessage.hpp"
 #include "complex/Pipeline/Messaging/OutputRenamedMessage.hpp"
 #include "complex/Pipeline/Messaging/PipelineFilterMessage.hpp"
+#include "complex/Utilities/ExecutionContext.hpp"
 
 #include <nlohmann/json.hpp>
 
@@ -18,6 +21,36 @@ constexpr StringLiteral k_ArgsKey = "args";
 constexpr StringLiteral k_FilterKey = "filter";
 constexpr StringLiteral k_FilterNameKey = "name";
 constexpr StringLiteral k_FilterUuidKey = "uuid";
+
+/**
+ * @brief Returns the array bytes held at the start of a filter plus every byte
+ * an array gains at any of the later stages, where arrays are matched by id.
+ * @param before
+ * @param stages
+ * @return uint64
+ */
+uint64 PeakArrayMemory(const std::map<DataObject::IdType, uint64>& before, const std::vector<std::map<DataObject::IdType, uint64>>& stages)
+{
+  uint64 peak = 0;
+  std::map<DataObject::IdType, uint64> largest = before;
+  for(const auto& [id, bytes] : before)
+  {
+    peak += bytes;
+  }
+  for(const auto& stage : stages)
+  {
+    for(const auto& [id, bytes] : stage)
+    {
+      uint64& largestBytes = largest[id];
+      if(bytes > largestBytes)
+      {
+        peak += bytes - largestBytes;
+        largestBytes = bytes;
+      }
+    }
+  }
+  return peak;
+}
 } // namespace
 
 std::unique_ptr<PipelineFilter> PipelineFilter::Create(const FilterHandle& handle, const Arguments& args, FilterList* filterList)
@@ -73,6 +106,7 @@ Arguments PipelineFilter::getArguments() const
 void PipelineFilter::setArguments(const Arguments& args)
 {
   m_Arguments = args;
+  invalidatePreflight();
 }
 
 void PipelineFilter::setIndex(int32 index)
@@ -92,6 +126,7 @@ bool PipelineFilter::preflight(DataStructure& data, RenamedPaths& renamedPaths,
   sendFilterRunStateMessage(m_Index, RunState::Preflighting);
 
   std::vector<DataPath> oldCreatedPaths = m_CreatedPaths;
+  const std::map<DataObject::IdType, uint64> arrayMemoryBefore = data.getArrayMemoryUsage();
 
   IFilter::MessageHandler messageHandler{[this](const IFilter::Message& message) { this->notifyFilterMessage(message); }};
 
@@ -112,7 +147,16 @@ bool PipelineFilter::preflight(DataStructure& data, RenamedPaths& renamedPaths,
 
   m_Errors.clear();
 
-  Result<> actionsResult = result.outputActions.value().applyAll(data, IDataAction::Mode::Preflight);
+  // Deferred actions only run once the filter finishes, so the arrays they remove still count towards the peak
+  const OutputActions& outputActions = result.outputActions.value();
+  std::vector<std::map<DataObject::IdType, uint64>> arrayMemoryStages;
+  Result<> actionsResult = outputActions.applyRegular(data, IDataAction::Mode::Preflight);
+  if(actionsResult.valid())
+  {
+    arrayMemoryStages.push_back(data.getArrayMemoryUsage());
+    actionsResult = MergeResults(std::move(actionsResult), outputActions.applyDeferred(data, IDataAction::Mode::Preflight));
+    arrayMemoryStages.push_back(data.getArrayMemoryUsage());
+  }
 
   for(auto&& warning : actionsResult.warnings())
   {
@@ -147,6 +191,7 @@ bool PipelineFilter::preflight(DataStructure& data, RenamedPaths& renamedPaths,
 
   // Do not clear the created paths unless the preflight succeeded
   m_CreatedPaths = newCreatedPaths;
+  m_PreflightPeakMemory = PeakArrayMemory(arrayMemoryBefore, arrayMemoryStages);
 
   setPreflightStructure(data);
   sendFilterFaultMessage(m_Index, getFaultState());
@@ -177,7 +222,8 @@ bool PipelineFilter::execute(DataStructure& data, const std::atomic_bool& should
 
   IFilter::MessageHandler messageHandler{[this](const IFilter::Message& message) { this->notifyFilterMessage(message); }};
 
-  IFilter::ExecuteResult result = m_Filter->execute(data, getArguments(), this, messageHandler, shouldCancel);
+  IFilter::ExecuteResult result;
+  ExecutionContext::Global().executeFilter([&]() { result = m_Filter->execute(data, getArguments(), this, messageHandler, shouldCancel); });
   m_PreflightValues = std::move(result.outputValues);
 
   m_Warnings = result.result.warnings();
@@ -227,7 +273,8 @@ bool checkIfRename(const DataPath& path1, const DataPath& path2)
   usize numDifferences = 0;
   for(size_t i = 0; i < count; i++)
   {
-    if(path1[i] != path2[i])
+    // Path segments are interned, so equal names share the same string
+    if(&path1[i] != &path2[i])
     {
       numDifferences++;
     }
@@ -237,31 +284,28 @@ bool checkIfRename(const DataPath& path1, const DataPath& path2)
 }
 
 /**
- * @brief Finds and returns the overlap between two collections of DataPaths.
- * @param group1
- * @param group2
- * @return std::vector<DataPath>
- */
-std::vector<DataPath> getOverlap(const std::vector<DataPath>& group1, const std::vector<DataPath>& group2)
-{
-  std::vector<DataPath> overlap;
-  std::set_intersection(group1.begin(), group1.end(), group2.begin(), group2.end(), std::inserter(overlap, overlap.begin()));
-  return overlap;
-}
-
-/**
- * @brief Removes the overlap between two groups of DataPaths
+ * @brief Removes the DataPaths found in both groups from each of them.
  * @param group1
  * @param group2
  */
 void removeOverlap(std::vector<DataPath>& group1, std::vector<DataPath>& group2)
 {
-  auto overlap = getOverlap(group1, group2);
-  for(const auto& value : overlap)
+  std::unordered_set<DataPath> paths1(group1.begin(), group1.end());
+  std::unordered_set<DataPath> overlap;
+  for(const auto& path : group2)
   {
-    group1.erase(std::remove(group1.begin(), group1.end(), value), group1.end());
-    group2.erase(std::remove(group2.begin(), group2.end(), value), group2.end());
+    if(paths1.count(path) > 0)
+    {
+      overlap.insert(path);
+    }
+  }
+  if(overlap.empty())
+  {
+    return;
   }
+  auto isOverlap = [&overlap](const DataPath& path) { return overlap.count(path) > 0; };
+  group1.erase(std::remove_if(group1.begin(), group1.end(), isOverlap), group1.end());
+  group2.erase(std::remove_if(group2.begin(), group2.end(), isOverlap), group2.end());
 }
 
 /**
@@ -297,8 +341,8 @@ PipelineFilter::RenamedPaths findAllRenamePaths(const std::vector<DataPath>& old
  */
 PipelineFilter::RenamedPaths getConfirmedRenamePaths(const PipelineFilter::RenamedPaths& renamedPairs)
 {
-  std::vector<DataPath> rejectedFirstPaths;
-  std::vector<DataPath> rejectedSecondPaths;
+  std::unordered_set<DataPath> rejectedFirstPaths;
+  std::unordered_set<DataPath> rejectedSecondPaths;
 
   // Find rejected RenamedPaths
   auto size = renamedPairs.size();
@@ -313,11 +357,11 @@ PipelineFilter::RenamedPaths getConfirmedRenamePaths(const PipelineFilter::Renam
       // Check for repeated paths
       if(pair1.first == pair2.first)
       {
-        rejectedFirstPaths.push_back(pair1.first);
+        rejectedFirstPaths.insert(pair1.first);
       }
       if(pair1.second == pair2.second)
       {
-        rejectedSecondPaths.push_back(pair1.second);
+        rejectedSecondPaths.insert(pair1.second);
       }
     }
   }
@@ -325,11 +369,11 @@ PipelineFilter::RenamedPaths getConfirmedRenamePaths(const PipelineFilter::Renam
   PipelineFilter::RenamedPaths confirmed;
   for(const auto& renamedPair : renamedPairs)
   {
-    if(std::find(rejectedFirstPaths.begin(), rejectedFirstPaths.end(), renamedPair.first) != rejectedFirstPaths.end())
+    if(rejectedFirstPaths.count(renamedPair.first) > 0)
     {
       continue;
     }
-    if(std::find(rejectedSecondPaths.begin(), rejectedSecondPaths.end(), renamedPair.second) != rejectedSecondPaths.end())
+    if(rejectedSecondPaths.count(renamedPair.second) > 0)
     {
       continue;
     }
@@ -373,6 +417,11 @@ const std::vector<IFilter::PreflightValue>& PipelineFilter::getPreflightValues()
   return m_PreflightValues;
 }
 
+uint64 PipelineFilter::getPreflightPeakMemory() const
+{
+  return m_PreflightPeakMemory;
+}
+
 std::unique_ptr<AbstractPipelineNode> PipelineFilter::deepCopy() const
 {
   return std::make_unique<PipelineFilter>(m_Filter->clone(), m_Arguments);
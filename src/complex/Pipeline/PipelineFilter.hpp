@@ -156,6 +156,15 @@ public:
    */
   const std::vector<IFilter::PreflightValue>& getPreflightValues() const;
 
+  /**
+   * @brief Returns the projected number of bytes held by DataArrays while the
+   * filter executes, from the last successful preflight. This counts the
+   * filter's input, the arrays its actions create or grow, and the arrays
+   * its deferred actions remove only once it finishes.
+   * @return uint64
+   */
+  uint64 getPreflightPeakMemory() const;
+
   /**
    * @brief Creates and returns a unique pointer to a copy of the node.
    * @return std::unique_ptr<AbstractPipelineNode>
@@ -209,5 +218,6 @@ private:
   std::vector<complex::Error> m_Errors;
   std::vector<IFilter::PreflightValue> m_PreflightValues;
   std::vector<DataPath> m_CreatedPaths;
+  uint64 m_PreflightPeakMemory = 0;
 };
 } // namespace complex
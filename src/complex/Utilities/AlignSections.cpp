@@ -1,107 +1,133 @@
 #include "AlignSections.hpp"
 
+#include "complex/DataStructure/DataStore.hpp"
 #include "complex/DataStructure/Geometry/AbstractGeometryGrid.hpp"
+#include "complex/Utilities/FilterUtilities.hpp"
 #include "complex/Utilities/Math/MatrixMath.hpp"
 #include "complex/Utilities/ParallelDataAlgorithm.hpp"
-#include "complex/Utilities/ParallelTaskAlgorithm.hpp"
 #include "complex/Utilities/StringUtilities.hpp"
 
-#include <chrono>
+#include <algorithm>
+#include <cstring>
 
 using namespace complex;
 
 namespace
 {
-// -----------------------------------------------------------------------------
-template <typename T>
-class AlignSectionsTransferDataImpl
+/**
+ * @brief The shift applied to a single slice. Cell (x, y) of the slice takes the value of cell
+ * (x + xShift, y + yShift), or zero if that cell is outside of the slice.
+ */
+struct SliceShift
+{
+  usize slice = 0;
+  int64 xShift = 0;
+  int64 yShift = 0;
+  // Destination columns whose source column is inside of the slice
+  usize xBegin = 0;
+  usize xEnd = 0;
+};
+
+/**
+ * @brief A selected cell array and, if it is held in memory, its raw buffer.
+ */
+struct ShiftedArray
 {
-public:
-  AlignSectionsTransferDataImpl() = delete;
-  AlignSectionsTransferDataImpl(const AlignSectionsTransferDataImpl&) = default;     // Copy Constructor Default Implemented
-  AlignSectionsTransferDataImpl(AlignSectionsTransferDataImpl&&) noexcept = default; // Move Constructor Default Implemented
-
-  AlignSectionsTransferDataImpl(AlignSections* filter, SizeVec3 dims, std::vector<int64_t> xShifts, std::vector<int64_t> yShifts, complex::DataArray<T>& dataArray)
-  : m_Filter(filter)
-  , m_Dims(std::move(dims))
-  , m_Xshifts(std::move(xShifts))
-  , m_Yshifts(std::move(yShifts))
-  , m_DataArray(dataArray)
+  IDataArray* array = nullptr;
+  uint8* bytes = nullptr;
+  usize tupleBytes = 0;
+};
+
+struct FindBufferFunctor
+{
+  template <typename T>
+  ShiftedArray operator()(IDataArray& array) const
   {
+    ShiftedArray shiftedArray;
+    shiftedArray.array = &array;
+    auto* dataStore = dynamic_cast<DataStore<T>*>(dynamic_cast<DataArray<T>&>(array).getDataStore());
+    if(dataStore != nullptr)
+    {
+      shiftedArray.bytes = reinterpret_cast<uint8*>(dataStore->data());
+      shiftedArray.tupleBytes = array.getNumberOfComponents() * sizeof(T);
+    }
+    return shiftedArray;
   }
+};
 
-  ~AlignSectionsTransferDataImpl() = default;
+struct InitializeTupleFunctor
+{
+  template <typename T>
+  void operator()(IDataArray& array, usize tupleIndex) const
+  {
+    dynamic_cast<DataArray<T>&>(array).initializeTuple(tupleIndex, static_cast<T>(0));
+  }
+};
 
-  AlignSectionsTransferDataImpl& operator=(const AlignSectionsTransferDataImpl&) = delete; // Copy Assignment Not Implemented
-  AlignSectionsTransferDataImpl& operator=(AlignSectionsTransferDataImpl&&) = delete;      // Move Assignment Not Implemented
+// -----------------------------------------------------------------------------
+SliceShift CreateSliceShift(usize slice, int64 xShift, int64 yShift, const SizeVec3& dims)
+{
+  const int64 dimX = static_cast<int64>(dims[0]);
+  SliceShift sliceShift;
+  sliceShift.slice = slice;
+  sliceShift.xShift = xShift;
+  sliceShift.yShift = yShift;
+  sliceShift.xBegin = static_cast<usize>(std::clamp<int64>(-xShift, 0, dimX));
+  sliceShift.xEnd = static_cast<usize>(std::clamp<int64>(dimX - xShift, 0, dimX));
+  return sliceShift;
+}
 
-  void operator()() const
+/**
+ * @brief Shifts one slice of an array in place. Rows are visited in the direction of the y shift
+ * so that every source row is read before it is overwritten.
+ * @param shiftedArray
+ * @param sliceShift
+ * @param dims
+ */
+void ShiftSlice(const ShiftedArray& shiftedArray, const SliceShift& sliceShift, const SizeVec3& dims)
+{
+  const usize sliceStart = sliceShift.slice * dims[0] * dims[1];
+  const bool hasColumns = sliceShift.xBegin < sliceShift.xEnd;
+  for(usize row = 0; row < dims[1]; row++)
   {
-    T var = static_cast<T>(0);
-
-    auto start = std::chrono::steady_clock::now();
+    const usize yIndex = sliceShift.yShift >= 0 ? row : dims[1] - 1 - row;
+    const int64 sourceY = static_cast<int64>(yIndex) + sliceShift.yShift;
+    const bool hasSourceRow = hasColumns && sourceY >= 0 && sourceY < static_cast<int64>(dims[1]);
+    const usize rowStart = sliceStart + yIndex * dims[0];
+    const usize sourceRowStart = hasSourceRow ? sliceStart + static_cast<usize>(sourceY) * dims[0] : 0;
 
-    for(size_t i = 1; i < m_Dims[2]; i++)
+    if(shiftedArray.bytes != nullptr)
     {
-      auto now = std::chrono::steady_clock::now();
-      // Only send updates every 1 second
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+      const usize tupleBytes = shiftedArray.tupleBytes;
+      uint8* rowBytes = shiftedArray.bytes + rowStart * tupleBytes;
+      if(!hasSourceRow)
       {
-        std::string message = fmt::format("Processing {}: {}% completed", m_DataArray.getName(), static_cast<int32>(100 * (static_cast<float>(i) / static_cast<float>(m_Dims[2]))));
-        m_Filter->updateProgress(message);
-        start = std::chrono::steady_clock::now();
+        std::memset(rowBytes, 0, dims[0] * tupleBytes);
+        continue;
       }
-      if(m_Filter->getCancel())
+      const uint8* sourceBytes = shiftedArray.bytes + (sourceRowStart + sliceShift.xBegin + sliceShift.xShift) * tupleBytes;
+      // The source and destination overlap when the slice is only shifted along x
+      std::memmove(rowBytes + sliceShift.xBegin * tupleBytes, sourceBytes, (sliceShift.xEnd - sliceShift.xBegin) * tupleBytes);
+      std::memset(rowBytes, 0, sliceShift.xBegin * tupleBytes);
+      std::memset(rowBytes + sliceShift.xEnd * tupleBytes, 0, (dims[0] - sliceShift.xEnd) * tupleBytes);
+      continue;
+    }
+
+    // Arrays that are not held in memory are shifted a tuple at a time
+    for(usize column = 0; column < dims[0]; column++)
+    {
+      const usize xIndex = sliceShift.xShift >= 0 ? column : dims[0] - 1 - column;
+      if(hasSourceRow && xIndex >= sliceShift.xBegin && xIndex < sliceShift.xEnd)
       {
-        return;
+        shiftedArray.array->copyTuple(sourceRowStart + xIndex + sliceShift.xShift, rowStart + xIndex);
       }
-      size_t slice = (m_Dims[2] - 1) - i;
-      for(size_t yIndex = 0; yIndex < m_Dims[1]; yIndex++)
+      else
       {
-        for(size_t xIndex = 0; xIndex < m_Dims[0]; xIndex++)
-        {
-          int64_t xspot = 0;
-          int64_t yspot = 0;
-          if(m_Yshifts[i] >= 0)
-          {
-            yspot = static_cast<int64_t>(yIndex);
-          }
-          else if(m_Yshifts[i] < 0)
-          {
-            yspot = static_cast<int64_t>(m_Dims[1]) - 1 - static_cast<int64_t>(yIndex);
-          }
-          if(m_Xshifts[i] >= 0)
-          {
-            xspot = static_cast<int64_t>(xIndex);
-          }
-          else if(m_Xshifts[i] < 0)
-          {
-            xspot = static_cast<int64_t>(m_Dims[0]) - 1 - static_cast<int64_t>(xIndex);
-          }
-          int64_t newPosition = (slice * m_Dims[0] * m_Dims[1]) + (yspot * m_Dims[0]) + xspot;
-          int64_t currentPosition = (slice * m_Dims[0] * m_Dims[1]) + ((yspot + m_Yshifts[i]) * m_Dims[0]) + (xspot + m_Xshifts[i]);
-          if((yspot + m_Yshifts[i]) >= 0 && (yspot + m_Yshifts[i]) <= static_cast<int64_t>(m_Dims[1]) - 1 && (xspot + m_Xshifts[i]) >= 0 &&
-             (xspot + m_Xshifts[i]) <= static_cast<int64_t>(m_Dims[0]) - 1)
-          {
-            m_DataArray.copyTuple(static_cast<size_t>(currentPosition), static_cast<size_t>(newPosition));
-          }
-          if((yspot + m_Yshifts[i]) < 0 || (yspot + m_Yshifts[i]) > static_cast<int64_t>(m_Dims[1] - 1) || (xspot + m_Xshifts[i]) < 0 || (xspot + m_Xshifts[i]) > static_cast<int64_t>(m_Dims[0]) - 1)
-          {
-            m_DataArray.initializeTuple(newPosition, var);
-          }
-        }
+        ExecuteDataFunction(InitializeTupleFunctor{}, shiftedArray.array->getDataType(), *shiftedArray.array, rowStart + xIndex);
       }
     }
   }
-
-private:
-  AlignSections* m_Filter = nullptr;
-  SizeVec3 m_Dims;
-  std::vector<int64_t> m_Xshifts;
-  std::vector<int64_t> m_Yshifts;
-  complex::DataArray<T>& m_DataArray;
-};
-
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -137,75 +163,45 @@ Result<> AlignSections::execute(const SizeVec3& udims)
   // Find the voxel shifts that need to happen
   find_shifts(xshifts, yshifts);
 
-  // Now Adjust the actual DataArrays
-  std::vector<DataPath> selectedCellArrays = getSelectedDataPaths();
-
-  ParallelTaskAlgorithm taskRunner;
-
-  for(const auto& cellArrayPath : selectedCellArrays)
+  // Shift i is applied to slice (dims[2] - 1 - i). The mapping is shared by every array and
+  // slices that do not move are left alone.
+  std::vector<SliceShift> sliceShifts;
+  for(usize i = 1; i < udims[2]; i++)
   {
-    if(m_ShouldCancel)
+    if(xshifts[i] != 0 || yshifts[i] != 0)
     {
-      return {};
+      sliceShifts.push_back(CreateSliceShift(udims[2] - 1 - i, xshifts[i], yshifts[i], udims));
     }
-    m_MessageHandler(fmt::format("Updating DataArray '{}'", cellArrayPath.toString()));
-    const auto& oldCellArray = m_DataStructure.getDataRefAs<IDataArray>(cellArrayPath);
-
-    DataType type = oldCellArray.getDataType();
+  }
 
-    switch(type)
+  // Now Adjust the actual DataArrays
+  std::vector<DataPath> selectedCellArrays = getSelectedDataPaths();
+  std::vector<ShiftedArray> shiftedArrays;
+  for(const auto& cellArrayPath : selectedCellArrays)
+  {
+    auto& cellArray = m_DataStructure.getDataRefAs<IDataArray>(cellArrayPath);
+    shiftedArrays.push_back(ExecuteDataFunction(FindBufferFunctor{}, cellArray.getDataType(), cellArray));
+  }
+  if(sliceShifts.empty() || shiftedArrays.empty())
+  {
+    return {};
+  }
+  m_MessageHandler(fmt::format("Shifting {} slices of {} DataArrays", sliceShifts.size(), shiftedArrays.size()));
+
+  // Every (array, slice) pair is independent of the others
+  const usize numSliceShifts = sliceShifts.size();
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, shiftedArrays.size() * numSliceShifts);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize index = range.min(); index < range.max(); index++)
     {
-    case DataType::boolean: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<bool>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<bool>>(cellArrayPath)));
-      break;
-    }
-    case DataType::int8: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<int8>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<int8>>(cellArrayPath)));
-      break;
-    }
-    case DataType::int16: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<int16>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<int16>>(cellArrayPath)));
-      break;
-    }
-    case DataType::int32: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<int32>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<int32>>(cellArrayPath)));
-      break;
-    }
-    case DataType::int64: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<int64>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<int64>>(cellArrayPath)));
-      break;
-    }
-    case DataType::uint8: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<uint8>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<uint8>>(cellArrayPath)));
-      break;
-    }
-    case DataType::uint16: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<uint16>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<uint16>>(cellArrayPath)));
-      break;
-    }
-    case DataType::uint32: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<uint32>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<uint32>>(cellArrayPath)));
-      break;
-    }
-    case DataType::uint64: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<uint64>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<uint64>>(cellArrayPath)));
-      break;
-    }
-    case DataType::float32: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<float32>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<float32>>(cellArrayPath)));
-      break;
-    }
-    case DataType::float64: {
-      taskRunner.execute(AlignSectionsTransferDataImpl<float64>(this, udims, xshifts, yshifts, m_DataStructure.getDataRefAs<DataArray<float64>>(cellArrayPath)));
-      break;
-    }
-    default: {
-      throw std::runtime_error("Invalid DataType");
-    }
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      ShiftSlice(shiftedArrays[index / numSliceShifts], sliceShifts[index % numSliceShifts], udims);
     }
-  }
-  // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
-  taskRunner.wait();
+  });
 
   return {};
 }
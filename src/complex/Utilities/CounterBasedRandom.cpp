@@ -0,0 +1,77 @@
+#include "CounterBasedRandom.hpp"
+
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+
+using namespace complex;
+
+namespace
+{
+// Number of keys sorted by a single task before the sorted runs are merged
+constexpr usize k_RunSize = 16384;
+
+struct SortKey
+{
+  uint64 key = 0;
+  usize index = 0;
+};
+
+bool operator<(const SortKey& lhs, const SortKey& rhs)
+{
+  return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.index < rhs.index);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+std::vector<usize> CounterBasedRandom::RandomPermutation(const Philox4x32& generator, usize size, uint64 stream)
+{
+  std::vector<SortKey> keys(size);
+  const usize numRuns = (size + k_RunSize - 1) / k_RunSize;
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numRuns);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize run = range.min(); run < range.max(); run++)
+      {
+        const usize end = std::min(size, (run + 1) * k_RunSize);
+        for(usize i = run * k_RunSize; i < end; i++)
+        {
+          const Philox4x32::ResultType words = generator(i, stream);
+          keys[i] = {(static_cast<uint64>(words[0]) << 32) | words[1], i};
+        }
+        std::sort(keys.begin() + run * k_RunSize, keys.begin() + end);
+      }
+    });
+  }
+
+  // Keys are unique, so merging the sorted runs pairwise gives the same order as a serial sort
+  std::vector<SortKey> merged(size);
+  for(usize width = k_RunSize; width < size; width *= 2)
+  {
+    const usize numPairs = (size + 2 * width - 1) / (2 * width);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numPairs);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize pair = range.min(); pair < range.max(); pair++)
+      {
+        const usize begin = pair * 2 * width;
+        const usize middle = std::min(size, begin + width);
+        const usize end = std::min(size, begin + 2 * width);
+        std::merge(keys.begin() + begin, keys.begin() + middle, keys.begin() + middle, keys.begin() + end, merged.begin() + begin);
+      }
+    });
+    keys.swap(merged);
+  }
+
+  std::vector<usize> permutation(size);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, size);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      permutation[i] = keys[i].index;
+    }
+  });
+  return permutation;
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+#include "complex/complex_export.hpp"
+
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace complex
+{
+/**
+ * @class Philox4x32
+ * @brief Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3", SC11).
+ *
+ * Unlike a sequential engine the output is a pure function of the key (seed) and a 128 bit
+ * counter. The numbers that belong to an item can be drawn directly from the index of that
+ * item, so a parallel algorithm produces the same values for a given seed no matter how the
+ * work is split between threads. The counter is made up of a 64 bit index and a 64 bit
+ * stream that separates independent draws for the same index.
+ */
+class Philox4x32
+{
+public:
+  using ResultType = std::array<uint32, 4>;
+  using KeyType = std::array<uint32, 2>;
+
+  /**
+   * @brief Constructs a generator keyed with the given seed.
+   * @param seed
+   */
+  constexpr explicit Philox4x32(uint64 seed) noexcept
+  : m_Key{Low(seed), High(seed)}
+  {
+  }
+
+  /**
+   * @brief Constructs a generator with the given raw key.
+   * @param key
+   */
+  constexpr explicit Philox4x32(const KeyType& key) noexcept
+  : m_Key(key)
+  {
+  }
+
+  /**
+   * @brief Returns the four random words for the given counter.
+   * @param index
+   * @param stream
+   * @return ResultType
+   */
+  constexpr ResultType operator()(uint64 index, uint64 stream = 0) const noexcept
+  {
+    return generate({Low(index), High(index), Low(stream), High(stream)});
+  }
+
+  /**
+   * @brief Returns the four random words for the given raw counter.
+   * @param counter
+   * @return ResultType
+   */
+  constexpr ResultType generate(ResultType counter) const noexcept
+  {
+    KeyType key = m_Key;
+    for(int32 round = 0; round < k_Rounds; round++)
+    {
+      if(round > 0)
+      {
+        key[0] += k_Weyl0;
+        key[1] += k_Weyl1;
+      }
+      counter = Round(counter, key);
+    }
+    return counter;
+  }
+
+  /**
+   * @brief Returns the key derived from the seed.
+   * @return const KeyType&
+   */
+  constexpr const KeyType& getKey() const noexcept
+  {
+    return m_Key;
+  }
+
+  /**
+   * @brief Converts two random words into a float64 uniformly distributed in [0, 1) using 53 random bits.
+   * @param high
+   * @param low
+   * @return float64
+   */
+  static constexpr float64 ToUnitFloat64(uint32 high, uint32 low) noexcept
+  {
+    const uint64 bits = ((static_cast<uint64>(high) << 32) | low) >> 11;
+    return static_cast<float64>(bits) * 0x1.0p-53;
+  }
+
+  /**
+   * @brief Converts a random word into a float32 uniformly distributed in [0, 1) using 24 random bits.
+   * @param value
+   * @return float32
+   */
+  static constexpr float32 ToUnitFloat32(uint32 value) noexcept
+  {
+    return static_cast<float32>(value >> 8) * 0x1.0p-24f;
+  }
+
+  /**
+   * @brief Maps two random words onto [0, range) by scaling the 64 bit value with a
+   * 128 bit product (Lemire, 2019). Without Lemire's rejection step, which would need
+   * more random words, each result is drawn from either floor(2^64 / range) or
+   * ceil(2^64 / range) inputs and its probability is off from 1 / range by a relative
+   * error of at most range / 2^64.
+   * @param high
+   * @param low
+   * @param range
+   * @return uint64
+   */
+  static constexpr uint64 ToRange(uint32 high, uint32 low, uint64 range) noexcept
+  {
+    const uint64 value = (static_cast<uint64>(high) << 32) | low;
+    // 64 x 64 -> high 64 bits of the 128 bit product, computed from 32 bit halves
+    const uint64 valueLow = Low(value);
+    const uint64 valueHigh = High(value);
+    const uint64 rangeLow = Low(range);
+    const uint64 rangeHigh = High(range);
+    const uint64 lowLow = valueLow * rangeLow;
+    const uint64 highLow = valueHigh * rangeLow;
+    const uint64 lowHigh = valueLow * rangeHigh;
+    const uint64 highHigh = valueHigh * rangeHigh;
+    const uint64 cross = (lowLow >> 32) + Low(highLow) + lowHigh;
+    return highHigh + (highLow >> 32) + (cross >> 32);
+  }
+
+private:
+  static inline constexpr uint32 k_Multiplier0 = 0xD2511F53;
+  static inline constexpr uint32 k_Multiplier1 = 0xCD9E8D57;
+  static inline constexpr uint32 k_Weyl0 = 0x9E3779B9;
+  static inline constexpr uint32 k_Weyl1 = 0xBB67AE85;
+  static inline constexpr int32 k_Rounds = 10;
+
+  static constexpr uint32 Low(uint64 value) noexcept
+  {
+    return static_cast<uint32>(value);
+  }
+
+  static constexpr uint32 High(uint64 value) noexcept
+  {
+    return static_cast<uint32>(value >> 32);
+  }
+
+  static constexpr ResultType Round(const ResultType& counter, const KeyType& key) noexcept
+  {
+    const uint64 product0 = static_cast<uint64>(k_Multiplier0) * counter[0];
+    const uint64 product1 = static_cast<uint64>(k_Multiplier1) * counter[2];
+    return {High(product1) ^ counter[1] ^ key[0], Low(product1), High(product0) ^ counter[3] ^ key[1], Low(product0)};
+  }
+
+  KeyType m_Key;
+};
+
+/**
+ * @brief Building blocks for algorithms that draw their random numbers from a Philox4x32
+ * generator. Every value is drawn from the counter of the item it belongs to, so the results
+ * only depend on the seed and never on the number of threads.
+ */
+namespace CounterBasedRandom
+{
+/**
+ * @brief Maps the words of one counter onto a value uniformly distributed in [min, max] for
+ * integer types or in [min, max) for floating point types.
+ * @param words
+ * @param min
+ * @param max
+ * @return T
+ */
+template <typename T>
+constexpr T UniformValue(const Philox4x32::ResultType& words, T min, T max) noexcept
+{
+  static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "UniformValue requires a numeric type");
+  if constexpr(std::is_floating_point_v<T>)
+  {
+    const float64 unit = Philox4x32::ToUnitFloat64(words[0], words[1]);
+    return static_cast<T>(static_cast<float64>(min) + unit * (static_cast<float64>(max) - static_cast<float64>(min)));
+  }
+  else
+  {
+    using UnsignedT = std::make_unsigned_t<T>;
+    const uint64 span = static_cast<UnsignedT>(static_cast<UnsignedT>(max) - static_cast<UnsignedT>(min));
+    const uint64 value = (static_cast<uint64>(words[0]) << 32) | words[1];
+    // The whole 64 bit range is the only span whose size does not fit into a uint64
+    const uint64 offset = span == std::numeric_limits<uint64>::max() ? value : Philox4x32::ToRange(words[0], words[1], span + 1);
+    return static_cast<T>(static_cast<UnsignedT>(static_cast<UnsignedT>(min) + static_cast<UnsignedT>(offset)));
+  }
+}
+
+/**
+ * @brief Returns a random permutation of [0, size). Every index is given a random key drawn
+ * from its own counter and the indices are sorted by key in parallel, so the permutation only
+ * depends on the generator and the stream.
+ * @param generator
+ * @param size
+ * @param stream
+ * @return std::vector<usize>
+ */
+COMPLEX_EXPORT std::vector<usize> RandomPermutation(const Philox4x32& generator, usize size, uint64 stream = 0);
+} // namespace CounterBasedRandom
+} // namespace complex
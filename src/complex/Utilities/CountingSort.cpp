@@ -0,0 +1,132 @@
+#include "CountingSort.hpp"
+
+#include "complex/Utilities/ExecutionContext.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+
+using namespace complex;
+
+namespace
+{
+// Blocks smaller than this are not worth a separate task
+constexpr usize k_MinBlockSize = 16384;
+
+// The histograms of all blocks may always hold at least this many counters
+constexpr usize k_MinHistogramSize = usize(1) << 22;
+
+// Number of keys each task of the scan works on
+constexpr usize k_ScanChunkSize = 16384;
+} // namespace
+
+// -----------------------------------------------------------------------------
+usize CountingSort::ComputeNumberOfBlocks(usize size, usize numKeys)
+{
+  usize numBlocks = 4 * std::max<usize>(ExecutionContext::Global().getMaxConcurrency(), 1);
+  numBlocks = std::min(numBlocks, size / k_MinBlockSize);
+  // Every block holds a counter per key, so keep their total in proportion to the input
+  numBlocks = std::min(numBlocks, std::max(size, k_MinHistogramSize) / std::max<usize>(numKeys, 1));
+  return std::max<usize>(numBlocks, 1);
+}
+
+// -----------------------------------------------------------------------------
+void CountingSort::GroupByKey(nonstd::span<const usize> keys, usize numKeys, std::vector<usize>& offsets, std::vector<usize>& indices)
+{
+  const usize size = keys.size();
+  const usize numBlocks = ComputeNumberOfBlocks(size, numKeys);
+  const usize blockSize = (size + numBlocks - 1) / numBlocks;
+
+  // Count: every block counts its keys into its own histogram
+  std::vector<usize> counts(numBlocks * numKeys, 0);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize block = range.min(); block < range.max(); block++)
+      {
+        usize* histogram = counts.data() + block * numKeys;
+        const usize end = std::min(size, (block + 1) * blockSize);
+        for(usize index = block * blockSize; index < end; index++)
+        {
+          if(keys[index] < numKeys)
+          {
+            histogram[keys[index]]++;
+          }
+        }
+      }
+    });
+  }
+
+  // Scan: total the keys of each chunk of keys, scan the chunk totals serially and then turn
+  // every histogram entry into the output position of that block's first index with that key
+  const usize numChunks = (numKeys + k_ScanChunkSize - 1) / k_ScanChunkSize;
+  std::vector<usize> chunkOffsets(numChunks + 1, 0);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        usize total = 0;
+        const usize end = std::min(numKeys, (chunk + 1) * k_ScanChunkSize);
+        for(usize key = chunk * k_ScanChunkSize; key < end; key++)
+        {
+          for(usize block = 0; block < numBlocks; block++)
+          {
+            total += counts[block * numKeys + key];
+          }
+        }
+        chunkOffsets[chunk + 1] = total;
+      }
+    });
+  }
+  for(usize chunk = 0; chunk < numChunks; chunk++)
+  {
+    chunkOffsets[chunk + 1] += chunkOffsets[chunk];
+  }
+
+  offsets.resize(numKeys + 1);
+  offsets[numKeys] = chunkOffsets[numChunks];
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        usize position = chunkOffsets[chunk];
+        const usize end = std::min(numKeys, (chunk + 1) * k_ScanChunkSize);
+        for(usize key = chunk * k_ScanChunkSize; key < end; key++)
+        {
+          offsets[key] = position;
+          for(usize block = 0; block < numBlocks; block++)
+          {
+            const usize count = counts[block * numKeys + key];
+            counts[block * numKeys + key] = position;
+            position += count;
+          }
+        }
+      }
+    });
+  }
+
+  // Scatter: every block writes its indices starting at its positions
+  indices.resize(offsets[numKeys]);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize block = range.min(); block < range.max(); block++)
+      {
+        usize* positions = counts.data() + block * numKeys;
+        const usize end = std::min(size, (block + 1) * blockSize);
+        for(usize index = block * blockSize; index < end; index++)
+        {
+          if(keys[index] < numKeys)
+          {
+            indices[positions[keys[index]]++] = index;
+          }
+        }
+      }
+    });
+  }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+#include "complex/complex_export.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <vector>
+
+namespace complex
+{
+/**
+ * @brief Parallel counting sort that groups element indices by an integer key into a compressed
+ * row (CSR) layout: the indices with key k are stored contiguously at [offsets[k], offsets[k + 1]).
+ *
+ * The elements are split into contiguous blocks. Every block counts its keys into a private
+ * histogram in parallel, an exclusive scan over the histograms (key major, then block order) gives
+ * each block the first output position of each of its keys, and the blocks then scatter their
+ * indices to those positions in parallel. The indices of a key therefore stay in ascending order
+ * and the result is identical to a serial counting sort.
+ */
+namespace CountingSort
+{
+/**
+ * @brief Returns the number of blocks used to sort the given number of elements. Fewer blocks are
+ * used when the private histograms of every block together would hold too many counters.
+ * @param size
+ * @param numKeys
+ * @return usize
+ */
+COMPLEX_EXPORT usize ComputeNumberOfBlocks(usize size, usize numKeys);
+
+/**
+ * @brief Groups the indices [0, keys.size()) by their key. Indices whose key is not less than
+ * numKeys are skipped, which lets callers leave out masked or invalid elements.
+ * @param keys
+ * @param numKeys
+ * @param offsets Resized to numKeys + 1 entries
+ * @param indices Resized to the number of grouped indices
+ */
+COMPLEX_EXPORT void GroupByKey(nonstd::span<const usize> keys, usize numKeys, std::vector<usize>& offsets, std::vector<usize>& indices);
+} // namespace CountingSort
+} // namespace complex
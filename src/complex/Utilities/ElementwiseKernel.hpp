@@ -0,0 +1,116 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <stdexcept>
+
+namespace complex
+{
+/**
+ * @brief Element wise arithmetic over whole arrays.
+ *
+ * The elements are split into contiguous ranges that are processed in parallel. When every array
+ * is held in memory the inner loop runs directly over the raw buffers with no virtual calls, so the
+ * compiler can vectorize it for the instruction set the library is built for. Arrays with other
+ * data stores fall back to element wise access through the store.
+ *
+ * The operation is called once per element with the element values and must not depend on the
+ * position of the element, so it can be applied in any order.
+ */
+namespace ElementwiseKernel
+{
+namespace detail
+{
+template <typename T>
+T* GetBuffer(DataArray<T>& array)
+{
+  auto* dataStore = dynamic_cast<DataStore<T>*>(array.getDataStore());
+  return dataStore != nullptr ? dataStore->data() : nullptr;
+}
+
+template <typename T>
+const T* GetBuffer(const DataArray<T>& array)
+{
+  const auto* dataStore = dynamic_cast<const DataStore<T>*>(array.getDataStore());
+  return dataStore != nullptr ? dataStore->data() : nullptr;
+}
+} // namespace detail
+
+/**
+ * @brief Replaces every element of the array with op(element).
+ * @param array
+ * @param op T op(T value)
+ */
+template <typename T, typename OpT>
+void Transform(DataArray<T>& array, OpT op)
+{
+  T* buffer = detail::GetBuffer(array);
+  auto& dataStore = array.getDataStoreRef();
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, array.getSize());
+  dataAlg.execute([buffer, &dataStore, op](const ComplexRange& range) {
+    const usize end = range.max();
+    if(buffer != nullptr)
+    {
+      for(usize i = range.min(); i < end; i++)
+      {
+        buffer[i] = op(buffer[i]);
+      }
+      return;
+    }
+    for(usize i = range.min(); i < end; i++)
+    {
+      dataStore[i] = op(dataStore[i]);
+    }
+  });
+}
+
+/**
+ * @brief Sets every element of the output array to op(first element, second element). All three
+ * arrays must have the same number of elements. The output array may be one of the inputs.
+ * Throws a runtime_error if the element counts differ.
+ * @param first
+ * @param second
+ * @param output
+ * @param op OutT op(FirstT first, SecondT second)
+ */
+template <typename FirstT, typename SecondT, typename OutT, typename OpT>
+void Transform(const DataArray<FirstT>& first, const DataArray<SecondT>& second, DataArray<OutT>& output, OpT op)
+{
+  const usize size = output.getSize();
+  if(first.getSize() != size || second.getSize() != size)
+  {
+    throw std::runtime_error("ElementwiseKernel::Transform: The arrays must have the same number of elements");
+  }
+
+  const FirstT* firstBuffer = detail::GetBuffer(first);
+  const SecondT* secondBuffer = detail::GetBuffer(second);
+  OutT* outputBuffer = detail::GetBuffer(output);
+  const auto& firstStore = first.getDataStoreRef();
+  const auto& secondStore = second.getDataStoreRef();
+  auto& outputStore = output.getDataStoreRef();
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, size);
+  dataAlg.execute([&, op](const ComplexRange& range) {
+    const usize end = range.max();
+    if(firstBuffer != nullptr && secondBuffer != nullptr && outputBuffer != nullptr)
+    {
+      for(usize i = range.min(); i < end; i++)
+      {
+        outputBuffer[i] = op(firstBuffer[i], secondBuffer[i]);
+      }
+      return;
+    }
+    for(usize i = range.min(); i < end; i++)
+    {
+      outputStore[i] = op(firstStore[i], secondStore[i]);
+    }
+  });
+}
+} // namespace ElementwiseKernel
+} // namespace complex
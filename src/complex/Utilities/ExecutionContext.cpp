@@ -0,0 +1,230 @@
+#include "ExecutionContext.hpp"
+
+#include <algorithm>
+
+#ifdef COMPLEX_ENABLE_MULTICORE
+#include <tbb/info.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_observer.h>
+#endif
+
+using namespace complex;
+
+#ifdef COMPLEX_ENABLE_MULTICORE
+namespace
+{
+// The context arena the current thread is working in, if any
+thread_local const void* t_CurrentArena = nullptr;
+
+/**
+ * @brief Marks the worker threads that join an arena so that parallel work
+ * they start stays in that arena.
+ */
+class ArenaObserver : public tbb::task_scheduler_observer
+{
+public:
+  ArenaObserver(tbb::task_arena& arena, const void* owner)
+  : tbb::task_scheduler_observer(arena)
+  , m_Owner(owner)
+  {
+  }
+
+  void on_scheduler_entry(bool isWorker) override
+  {
+    if(isWorker)
+    {
+      t_CurrentArena = m_Owner;
+    }
+  }
+
+  void on_scheduler_exit(bool isWorker) override
+  {
+    if(isWorker)
+    {
+      t_CurrentArena = nullptr;
+    }
+  }
+
+private:
+  const void* m_Owner = nullptr;
+};
+} // namespace
+
+struct ExecutionContext::Arena
+{
+  explicit Arena(const tbb::task_arena::constraints& constraints)
+  : arena(constraints)
+  , observer(arena, this)
+  {
+    observer.observe(true);
+  }
+
+  ~Arena()
+  {
+    observer.observe(false);
+  }
+
+  void execute(const std::function<void()>& func)
+  {
+    arena.execute([this, &func]() {
+      // The function may run on a worker if every slot for outside threads is taken
+      const void* previousArena = t_CurrentArena;
+      t_CurrentArena = this;
+      try
+      {
+        func();
+      } catch(...)
+      {
+        t_CurrentArena = previousArena;
+        throw;
+      }
+      t_CurrentArena = previousArena;
+    });
+  }
+
+  tbb::task_arena arena;
+  ArenaObserver observer;
+};
+#else
+struct ExecutionContext::Arena
+{
+};
+#endif
+
+ExecutionContext& ExecutionContext::Global()
+{
+  // Intentionally leaked so parallel work during static destruction still has a context
+  static auto* context = new ExecutionContext();
+  return *context;
+}
+
+std::vector<int32> ExecutionContext::GetNumaNodes()
+{
+#ifdef COMPLEX_ENABLE_MULTICORE
+  std::vector<tbb::numa_node_id> numaNodes = tbb::info::numa_nodes();
+  return std::vector<int32>(numaNodes.cbegin(), numaNodes.cend());
+#else
+  return {-1};
+#endif
+}
+
+ExecutionContext::ExecutionContext() = default;
+
+ExecutionContext::~ExecutionContext() noexcept = default;
+
+usize ExecutionContext::getThreadCount() const
+{
+  std::lock_guard lock(m_Mutex);
+  return m_ThreadCount;
+}
+
+void ExecutionContext::setThreadCount(usize threadCount)
+{
+  std::lock_guard lock(m_Mutex);
+  m_ThreadCount = threadCount;
+  m_Arena.reset();
+#ifdef COMPLEX_ENABLE_MULTICORE
+  // Only one limit may be active at a time
+  m_ThreadLimit.reset();
+  if(threadCount > 0)
+  {
+    m_ThreadLimit = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, threadCount);
+  }
+#endif
+}
+
+int32 ExecutionContext::getNumaNode() const
+{
+  std::lock_guard lock(m_Mutex);
+  return m_NumaNode;
+}
+
+void ExecutionContext::setNumaNode(int32 numaNode)
+{
+  std::lock_guard lock(m_Mutex);
+  m_NumaNode = numaNode;
+  m_Arena.reset();
+}
+
+usize ExecutionContext::getFilterThreadLimit() const
+{
+  std::lock_guard lock(m_Mutex);
+  return m_FilterThreadLimit;
+}
+
+void ExecutionContext::setFilterThreadLimit(usize threadLimit)
+{
+  std::lock_guard lock(m_Mutex);
+  m_FilterThreadLimit = threadLimit;
+}
+
+usize ExecutionContext::getMaxConcurrency() const
+{
+#ifdef COMPLEX_ENABLE_MULTICORE
+  if(t_CurrentArena != nullptr)
+  {
+    return static_cast<usize>(tbb::this_task_arena::max_concurrency());
+  }
+  return static_cast<usize>(getArena()->arena.max_concurrency());
+#else
+  return 1;
+#endif
+}
+
+void ExecutionContext::execute(const std::function<void()>& func)
+{
+#ifdef COMPLEX_ENABLE_MULTICORE
+  if(t_CurrentArena != nullptr)
+  {
+    func();
+    return;
+  }
+  getArena()->execute(func);
+#else
+  func();
+#endif
+}
+
+void ExecutionContext::executeFilter(const std::function<void()>& func)
+{
+#ifdef COMPLEX_ENABLE_MULTICORE
+  std::shared_ptr<Arena> filterArena;
+  {
+    std::lock_guard lock(m_Mutex);
+    if(m_FilterThreadLimit > 0 && t_CurrentArena == nullptr)
+    {
+      filterArena = createArena(m_ThreadCount > 0 ? std::min(m_FilterThreadLimit, m_ThreadCount) : m_FilterThreadLimit);
+    }
+  }
+  if(filterArena == nullptr)
+  {
+    func();
+    return;
+  }
+  filterArena->execute(func);
+#else
+  func();
+#endif
+}
+
+std::shared_ptr<ExecutionContext::Arena> ExecutionContext::getArena() const
+{
+  std::lock_guard lock(m_Mutex);
+  if(m_Arena == nullptr)
+  {
+    m_Arena = createArena(m_ThreadCount);
+  }
+  return m_Arena;
+}
+
+std::shared_ptr<ExecutionContext::Arena> ExecutionContext::createArena(usize maxConcurrency) const
+{
+#ifdef COMPLEX_ENABLE_MULTICORE
+  tbb::task_arena::constraints constraints;
+  constraints.numa_id = m_NumaNode >= 0 ? m_NumaNode : tbb::task_arena::automatic;
+  constraints.max_concurrency = maxConcurrency > 0 ? static_cast<int>(maxConcurrency) : tbb::task_arena::automatic;
+  return std::make_shared<Arena>(constraints);
+#else
+  return std::make_shared<Arena>();
+#endif
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+#include "complex/complex_export.hpp"
+
+#ifdef COMPLEX_ENABLE_MULTICORE
+#include <tbb/global_control.h>
+#endif
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace complex
+{
+/**
+ * @class ExecutionContext
+ * @brief The ExecutionContext class controls the threads used by the parallel
+ * helpers of the process. ParallelDataAlgorithm, ParallelData2DAlgorithm,
+ * ParallelData3DAlgorithm, ParallelTaskAlgorithm and the HDF5 IO engine run
+ * their work inside the context's TBB arena instead of TBB's default one.
+ *
+ * The thread count limits the TBB worker threads of the whole process, so
+ * pipelines running side by side share them instead of each starting a thread
+ * per core. The arena can be bound to a NUMA node, and each filter can be
+ * limited to fewer threads than the whole context so that filters running at
+ * the same time split the threads between them.
+ *
+ * Settings should only be changed while no parallel work is running. Without
+ * COMPLEX_ENABLE_MULTICORE the settings are ignored and all work runs on the
+ * calling thread.
+ */
+class COMPLEX_EXPORT ExecutionContext
+{
+public:
+  /**
+   * @brief Returns the process wide ExecutionContext used by the parallel
+   * helpers. Also available through Application::getExecutionContext().
+   * @return ExecutionContext&
+   */
+  static ExecutionContext& Global();
+
+  /**
+   * @brief Returns the ids of the NUMA nodes TBB can bind an arena to. Returns
+   * a single -1 if TBB was built without topology support.
+   * @return std::vector<int32>
+   */
+  static std::vector<int32> GetNumaNodes();
+
+  ExecutionContext();
+  ~ExecutionContext() noexcept;
+
+  ExecutionContext(const ExecutionContext&) = delete;
+  ExecutionContext(ExecutionContext&&) = delete;
+  ExecutionContext& operator=(const ExecutionContext&) = delete;
+  ExecutionContext& operator=(ExecutionContext&&) = delete;
+
+  /**
+   * @brief Returns the maximum number of threads parallel work may use. 0 means
+   * TBB's default of one thread per core.
+   * @return usize
+   */
+  usize getThreadCount() const;
+
+  /**
+   * @brief Sets the maximum number of threads parallel work may use, across
+   * every arena of the process. Pass 0 for TBB's default.
+   * @param threadCount
+   */
+  void setThreadCount(usize threadCount);
+
+  /**
+   * @brief Returns the NUMA node the arenas are bound to. -1 means they are
+   * not bound.
+   * @return int32
+   */
+  int32 getNumaNode() const;
+
+  /**
+   * @brief Binds the arenas to the NUMA node with the given id, see
+   * GetNumaNodes(). Pass -1 to remove the binding.
+   * @param numaNode
+   */
+  void setNumaNode(int32 numaNode);
+
+  /**
+   * @brief Returns the maximum number of threads a single filter may use. 0
+   * means filters may use every thread of the context.
+   * @return usize
+   */
+  usize getFilterThreadLimit() const;
+
+  /**
+   * @brief Sets the maximum number of threads a single filter may use. Each
+   * filter executed through executeFilter() then gets its own arena of that
+   * size. Pass 0 to let filters use every thread of the context.
+   * @param threadLimit
+   */
+  void setFilterThreadLimit(usize threadLimit);
+
+  /**
+   * @brief Returns the number of threads parallel work started from the
+   * calling thread can use. Use this instead of the hardware concurrency when
+   * splitting work into chunks.
+   * @return usize
+   */
+  usize getMaxConcurrency() const;
+
+  /**
+   * @brief Runs the function inside the context's arena so that the parallel
+   * work it starts is limited by the context. Runs the function directly if
+   * the calling thread is already inside one of the context's arenas.
+   * @param func
+   */
+  void execute(const std::function<void()>& func);
+
+  /**
+   * @brief Runs a filter's execution. With a filter thread limit the function
+   * runs in a new arena of that size, otherwise it runs directly.
+   * @param func
+   */
+  void executeFilter(const std::function<void()>& func);
+
+private:
+  struct Arena;
+
+  /**
+   * @brief Returns the context's arena, creating it on first use.
+   * @return std::shared_ptr<Arena>
+   */
+  std::shared_ptr<Arena> getArena() const;
+
+  /**
+   * @brief Creates an arena with the context's NUMA binding. 0 means the
+   * default concurrency. The caller must hold m_Mutex.
+   * @param maxConcurrency
+   * @return std::shared_ptr<Arena>
+   */
+  std::shared_ptr<Arena> createArena(usize maxConcurrency) const;
+
+  mutable std::mutex m_Mutex;
+  usize m_ThreadCount = 0;
+  int32 m_NumaNode = -1;
+  usize m_FilterThreadLimit = 0;
+  mutable std::shared_ptr<Arena> m_Arena;
+#ifdef COMPLEX_ENABLE_MULTICORE
+  std::unique_ptr<tbb::global_control> m_ThreadLimit;
+#endif
+};
+} // namespace complex
@@ -0,0 +1,302 @@
+#include "KdTreeIndex.hpp"
+
+#include "complex/Utilities/ExecutionContext.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/Utilities/ParallelTaskAlgorithm.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+using namespace complex;
+
+namespace
+{
+// Ranges smaller than this are never handed to a separate task
+constexpr usize k_MinParallelRange = 8192;
+
+float32 DistanceSquared(const std::array<float32, 3>& lhs, const std::array<float32, 3>& rhs)
+{
+  const float32 dx = lhs[0] - rhs[0];
+  const float32 dy = lhs[1] - rhs[1];
+  const float32 dz = lhs[2] - rhs[2];
+  return dx * dx + dy * dy + dz * dz;
+}
+
+struct NearestVisitor
+{
+  float32 bestDistance = std::numeric_limits<float32>::max();
+  std::optional<usize> bestIndex;
+
+  float32 radiusSquared() const
+  {
+    return bestDistance;
+  }
+
+  void visit(usize index, float32 distance)
+  {
+    if(!bestIndex.has_value() || distance < bestDistance || (distance == bestDistance && index < *bestIndex))
+    {
+      bestDistance = distance;
+      bestIndex = index;
+    }
+  }
+};
+
+struct KNearestVisitor
+{
+  using ValueType = std::pair<float32, usize>;
+
+  explicit KNearestVisitor(usize count)
+  : maxCount(count)
+  {
+  }
+
+  usize maxCount = 0;
+  std::priority_queue<ValueType> heap;
+
+  float32 radiusSquared() const
+  {
+    return heap.size() < maxCount ? std::numeric_limits<float32>::max() : heap.top().first;
+  }
+
+  void visit(usize index, float32 distance)
+  {
+    ValueType value{distance, index};
+    if(heap.size() < maxCount)
+    {
+      heap.push(value);
+    }
+    else if(value < heap.top())
+    {
+      heap.pop();
+      heap.push(value);
+    }
+  }
+};
+
+struct RadiusVisitor
+{
+  float32 radius2 = 0.0f;
+  std::vector<usize>& indices;
+
+  float32 radiusSquared() const
+  {
+    return radius2;
+  }
+
+  void visit(usize index, float32 /*distance*/)
+  {
+    indices.push_back(index);
+  }
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+KdTreeIndex::KdTreeIndex(const Float32Array& coords, usize leafSize)
+: m_LeafSize(std::max<usize>(leafSize, 1))
+{
+  if(coords.getNumberOfComponents() != 3)
+  {
+    throw std::runtime_error(fmt::format("KdTreeIndex requires a 3 component coordinate array but '{}' has {} components", coords.getName(), coords.getNumberOfComponents()));
+  }
+
+  const usize numPoints = coords.getNumberOfTuples();
+  m_Entries.resize(numPoints);
+  m_SplitAxes.resize(numPoints, 0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute([this, &coords](const ComplexRange& range) {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      Entry& entry = m_Entries[i];
+      entry.coords = {coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]};
+      entry.index = i;
+    }
+  });
+
+  // Split the first few levels serially so the remaining subtrees are independent
+  // and large enough to keep every thread busy.
+  usize maxDepth = 0;
+  const usize targetSubtrees = 4 * std::max<usize>(ExecutionContext::Global().getMaxConcurrency(), 1);
+  for(usize count = 1; count < targetSubtrees; count *= 2)
+  {
+    maxDepth++;
+  }
+
+  std::vector<std::pair<usize, usize>> subtrees;
+  splitTopLevels(0, numPoints, 0, maxDepth, subtrees);
+
+  ParallelTaskAlgorithm taskRunner;
+  for(const auto& subtree : subtrees)
+  {
+    const usize begin = subtree.first;
+    const usize end = subtree.second;
+    taskRunner.execute([this, begin, end]() { buildRange(begin, end); });
+  }
+  taskRunner.wait();
+}
+
+// -----------------------------------------------------------------------------
+usize KdTreeIndex::getNumberOfPoints() const
+{
+  return m_Entries.size();
+}
+
+// -----------------------------------------------------------------------------
+bool KdTreeIndex::empty() const
+{
+  return m_Entries.empty();
+}
+
+// -----------------------------------------------------------------------------
+usize KdTreeIndex::getLeafSize() const
+{
+  return m_LeafSize;
+}
+
+// -----------------------------------------------------------------------------
+std::optional<usize> KdTreeIndex::findNearest(const Point3Df& point, float32* distanceSquared) const
+{
+  NearestVisitor visitor;
+  searchRange(0, m_Entries.size(), {point.getX(), point.getY(), point.getZ()}, visitor);
+  if(distanceSquared != nullptr && visitor.bestIndex.has_value())
+  {
+    *distanceSquared = visitor.bestDistance;
+  }
+  return visitor.bestIndex;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<usize> KdTreeIndex::findKNearest(const Point3Df& point, usize count) const
+{
+  if(count == 0)
+  {
+    return {};
+  }
+
+  KNearestVisitor visitor(count);
+  searchRange(0, m_Entries.size(), {point.getX(), point.getY(), point.getZ()}, visitor);
+
+  std::vector<usize> indices(visitor.heap.size());
+  for(auto iter = indices.rbegin(); iter != indices.rend(); ++iter)
+  {
+    *iter = visitor.heap.top().second;
+    visitor.heap.pop();
+  }
+  return indices;
+}
+
+// -----------------------------------------------------------------------------
+void KdTreeIndex::findInRadius(const Point3Df& point, float32 radius, std::vector<usize>& indices) const
+{
+  if(radius < 0.0f)
+  {
+    return;
+  }
+  RadiusVisitor visitor{radius * radius, indices};
+  searchRange(0, m_Entries.size(), {point.getX(), point.getY(), point.getZ()}, visitor);
+}
+
+// -----------------------------------------------------------------------------
+usize KdTreeIndex::splitRange(usize begin, usize end)
+{
+  std::array<float32, 3> minCoords = m_Entries[begin].coords;
+  std::array<float32, 3> maxCoords = m_Entries[begin].coords;
+  for(usize i = begin + 1; i < end; i++)
+  {
+    const auto& coords = m_Entries[i].coords;
+    for(usize dim = 0; dim < 3; dim++)
+    {
+      minCoords[dim] = std::min(minCoords[dim], coords[dim]);
+      maxCoords[dim] = std::max(maxCoords[dim], coords[dim]);
+    }
+  }
+
+  uint8 axis = 0;
+  for(uint8 dim = 1; dim < 3; dim++)
+  {
+    if(maxCoords[dim] - minCoords[dim] > maxCoords[axis] - minCoords[axis])
+    {
+      axis = dim;
+    }
+  }
+
+  const usize mid = begin + (end - begin) / 2;
+  std::nth_element(m_Entries.begin() + begin, m_Entries.begin() + mid, m_Entries.begin() + end,
+                   [axis](const Entry& lhs, const Entry& rhs) { return lhs.coords[axis] < rhs.coords[axis]; });
+  m_SplitAxes[mid] = axis;
+  return mid;
+}
+
+// -----------------------------------------------------------------------------
+void KdTreeIndex::buildRange(usize begin, usize end)
+{
+  if(end - begin <= m_LeafSize)
+  {
+    return;
+  }
+  const usize mid = splitRange(begin, end);
+  buildRange(begin, mid);
+  buildRange(mid + 1, end);
+}
+
+// -----------------------------------------------------------------------------
+void KdTreeIndex::splitTopLevels(usize begin, usize end, usize depth, usize maxDepth, std::vector<std::pair<usize, usize>>& subtrees)
+{
+  if(depth >= maxDepth || end - begin <= std::max(m_LeafSize, k_MinParallelRange))
+  {
+    subtrees.emplace_back(begin, end);
+    return;
+  }
+  const usize mid = splitRange(begin, end);
+  splitTopLevels(begin, mid, depth + 1, maxDepth, subtrees);
+  splitTopLevels(mid + 1, end, depth + 1, maxDepth, subtrees);
+}
+
+// -----------------------------------------------------------------------------
+template <typename VisitorT>
+void KdTreeIndex::searchRange(usize begin, usize end, const std::array<float32, 3>& target, VisitorT& visitor) const
+{
+  if(end - begin <= m_LeafSize)
+  {
+    for(usize i = begin; i < end; i++)
+    {
+      const float32 distance = DistanceSquared(m_Entries[i].coords, target);
+      if(distance <= visitor.radiusSquared())
+      {
+        visitor.visit(m_Entries[i].index, distance);
+      }
+    }
+    return;
+  }
+
+  const usize mid = begin + (end - begin) / 2;
+  const Entry& splitEntry = m_Entries[mid];
+  const float32 distance = DistanceSquared(splitEntry.coords, target);
+  if(distance <= visitor.radiusSquared())
+  {
+    visitor.visit(splitEntry.index, distance);
+  }
+
+  const uint8 axis = m_SplitAxes[mid];
+  const float32 offset = target[axis] - splitEntry.coords[axis];
+  if(offset < 0.0f)
+  {
+    searchRange(begin, mid, target, visitor);
+    if(offset * offset <= visitor.radiusSquared())
+    {
+      searchRange(mid + 1, end, target, visitor);
+    }
+  }
+  else
+  {
+    searchRange(mid + 1, end, target, visitor);
+    if(offset * offset <= visitor.radiusSquared())
+    {
+      searchRange(begin, mid, target, visitor);
+    }
+  }
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "complex/Common/Point3D.hpp"
+#include "complex/Common/Types.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/complex_export.hpp"
+
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace complex
+{
+/**
+ * @class KdTreeIndex
+ * @brief The KdTreeIndex class is a static, balanced 3D k-d tree used for nearest
+ * neighbor and radius queries over a point set such as the vertex list of a VertexGeom.
+ *
+ * The tree is stored implicitly. Points are copied and permuted so that every subtree
+ * occupies a contiguous range and the splitting point of a range sits at its midpoint.
+ * This means no node structure needs to be allocated and independent subtrees can be
+ * built concurrently. All query methods are const and safe to call from multiple threads.
+ * Query results are reported as indices into the original point list.
+ */
+class COMPLEX_EXPORT KdTreeIndex
+{
+public:
+  static inline constexpr usize k_DefaultLeafSize = 16;
+
+  /**
+   * @brief Constructs an empty index.
+   */
+  KdTreeIndex() = default;
+
+  /**
+   * @brief Builds the index from a 3 component coordinate array.
+   * @param coords
+   * @param leafSize Ranges at or below this size are scanned linearly instead of split further.
+   */
+  KdTreeIndex(const Float32Array& coords, usize leafSize = k_DefaultLeafSize);
+
+  KdTreeIndex(const KdTreeIndex&) = default;
+  KdTreeIndex(KdTreeIndex&&) noexcept = default;
+  KdTreeIndex& operator=(const KdTreeIndex&) = default;
+  KdTreeIndex& operator=(KdTreeIndex&&) noexcept = default;
+  ~KdTreeIndex() noexcept = default;
+
+  /**
+   * @brief Returns the number of indexed points.
+   * @return usize
+   */
+  usize getNumberOfPoints() const;
+
+  /**
+   * @brief Returns true if the index contains no points.
+   * @return bool
+   */
+  bool empty() const;
+
+  /**
+   * @brief Returns the index of the point closest to the target. Returns an empty
+   * optional if the index is empty. If provided, distanceSquared is set to the
+   * squared distance between the target and the found point.
+   * @param point
+   * @param distanceSquared
+   * @return std::optional<usize>
+   */
+  std::optional<usize> findNearest(const Point3Df& point, float32* distanceSquared = nullptr) const;
+
+  /**
+   * @brief Returns the indices of up to count points closest to the target ordered
+   * from nearest to farthest.
+   * @param point
+   * @param count
+   * @return std::vector<usize>
+   */
+  std::vector<usize> findKNearest(const Point3Df& point, usize count) const;
+
+  /**
+   * @brief Appends the indices of all points within radius of the target to the
+   * provided vector. The appended indices are not sorted.
+   * @param point
+   * @param radius
+   * @param indices
+   */
+  void findInRadius(const Point3Df& point, float32 radius, std::vector<usize>& indices) const;
+
+  /**
+   * @brief Returns the leaf size used when building the index.
+   * @return usize
+   */
+  usize getLeafSize() const;
+
+private:
+  struct Entry
+  {
+    std::array<float32, 3> coords;
+    usize index;
+  };
+
+  /**
+   * @brief Partitions the range [begin, end) around its midpoint along the axis of
+   * largest extent and records that axis. Returns the midpoint.
+   * @param begin
+   * @param end
+   * @return usize
+   */
+  usize splitRange(usize begin, usize end);
+
+  /**
+   * @brief Recursively builds the subtree for the half open range [begin, end).
+   * @param begin
+   * @param end
+   */
+  void buildRange(usize begin, usize end);
+
+  /**
+   * @brief Splits the top levels of the tree serially until there are enough
+   * independent subtrees to build them concurrently.
+   * @param begin
+   * @param end
+   * @param depth
+   * @param maxDepth
+   * @param subtrees
+   */
+  void splitTopLevels(usize begin, usize end, usize depth, usize maxDepth, std::vector<std::pair<usize, usize>>& subtrees);
+
+  template <typename VisitorT>
+  void searchRange(usize begin, usize end, const std::array<float32, 3>& target, VisitorT& visitor) const;
+
+  std::vector<Entry> m_Entries;
+  std::vector<uint8> m_SplitAxes;
+  usize m_LeafSize = k_DefaultLeafSize;
+};
+} // namespace complex
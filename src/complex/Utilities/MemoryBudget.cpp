@@ -0,0 +1,45 @@
+#include "MemoryBudget.hpp"
+
+using namespace complex;
+
+MemoryBudget::MemoryBudget(uint64 budget)
+: m_Budget(budget)
+{
+}
+
+MemoryBudget::~MemoryBudget() noexcept = default;
+
+uint64 MemoryBudget::getBudget() const
+{
+  return m_Budget;
+}
+
+uint64 MemoryBudget::getUsed() const
+{
+  std::lock_guard lock(m_Mutex);
+  return m_Used;
+}
+
+void MemoryBudget::acquire(uint64 bytes)
+{
+  if(m_Budget == 0)
+  {
+    return;
+  }
+  std::unique_lock lock(m_Mutex);
+  m_Released.wait(lock, [this, bytes] { return m_Used == 0 || m_Used + bytes <= m_Budget; });
+  m_Used += bytes;
+}
+
+void MemoryBudget::release(uint64 bytes)
+{
+  if(m_Budget == 0)
+  {
+    return;
+  }
+  {
+    std::lock_guard lock(m_Mutex);
+    m_Used -= bytes;
+  }
+  m_Released.notify_all();
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+#include "complex/complex_export.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace complex
+{
+/**
+ * @class MemoryBudget
+ * @brief The MemoryBudget class hands out bytes of a memory budget shared by
+ * work running on several threads, such as the jobs of a batch. acquire()
+ * blocks until the requested bytes fit in what is left of the budget.
+ *
+ * A request larger than the whole budget is granted once nothing else holds
+ * any bytes, so every request is eventually granted. A budget of 0 means no
+ * budget, and every request is granted right away.
+ */
+class COMPLEX_EXPORT MemoryBudget
+{
+public:
+  /**
+   * @brief Constructs a MemoryBudget of the given number of bytes.
+   * @param budget 0 means no budget
+   */
+  explicit MemoryBudget(uint64 budget);
+
+  ~MemoryBudget() noexcept;
+
+  MemoryBudget(const MemoryBudget&) = delete;
+  MemoryBudget(MemoryBudget&&) noexcept = delete;
+  MemoryBudget& operator=(const MemoryBudget&) = delete;
+  MemoryBudget& operator=(MemoryBudget&&) noexcept = delete;
+
+  /**
+   * @brief Returns the number of bytes in the budget.
+   * @return uint64
+   */
+  uint64 getBudget() const;
+
+  /**
+   * @brief Returns the number of bytes currently held.
+   * @return uint64
+   */
+  uint64 getUsed() const;
+
+  /**
+   * @brief Blocks until the bytes fit in the budget, then holds them until
+   * release() is called with the same number of bytes.
+   * @param bytes
+   */
+  void acquire(uint64 bytes);
+
+  /**
+   * @brief Returns bytes taken by acquire() to the budget and wakes the
+   * threads waiting for them.
+   * @param bytes
+   */
+  void release(uint64 bytes);
+
+private:
+  uint64 m_Budget = 0;
+  uint64 m_Used = 0;
+  mutable std::mutex m_Mutex;
+  std::condition_variable m_Released;
+};
+} // namespace complex
@@ -0,0 +1,261 @@
+#include "NeighborFill.hpp"
+
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/Utilities/TupleCopier.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+using namespace complex;
+
+namespace
+{
+constexpr usize k_NoCell = std::numeric_limits<usize>::max();
+
+struct CellFill
+{
+  usize cell = 0;
+  usize source = 0;
+};
+
+/**
+ * @brief Returns the face neighbor the cell takes its values from, or k_NoCell if none of its
+ * neighbors belong to a feature.
+ * @param featureIds
+ * @param dims
+ * @param cell
+ * @return usize
+ */
+usize VoteForSource(const AbstractDataStore<int32>& featureIds, const SizeVec3& dims, usize cell)
+{
+  const usize sliceSize = dims[0] * dims[1];
+  const usize x = cell % dims[0];
+  const usize y = (cell / dims[0]) % dims[1];
+  const usize z = cell / sliceSize;
+  const std::array<bool, 6> isInside = {z > 0, y > 0, x > 0, x < dims[0] - 1, y < dims[1] - 1, z < dims[2] - 1};
+  const std::array<usize, 6> neighbors = {cell - sliceSize, cell - dims[0], cell - 1, cell + 1, cell + dims[0], cell + sliceSize};
+
+  // Running count of each distinct neighboring feature
+  std::array<int32, 6> features = {};
+  std::array<int32, 6> counts = {};
+  usize numFeatures = 0;
+  int32 most = 0;
+  usize source = k_NoCell;
+  for(usize l = 0; l < 6; l++)
+  {
+    if(!isInside[l])
+    {
+      continue;
+    }
+    const int32 feature = featureIds[neighbors[l]];
+    if(feature < 0)
+    {
+      continue;
+    }
+    usize index = 0;
+    while(index < numFeatures && features[index] != feature)
+    {
+      index++;
+    }
+    if(index == numFeatures)
+    {
+      features[numFeatures] = feature;
+      counts[numFeatures] = 0;
+      numFeatures++;
+    }
+    counts[index]++;
+    if(counts[index] > most)
+    {
+      most = counts[index];
+      source = neighbors[l];
+    }
+  }
+  return source;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+usize NeighborFill::FillBadCells(Int32Array& featureIds, const SizeVec3& dims, const std::vector<IDataArray*>& cellArrays)
+{
+  AbstractDataStore<int32>& featureIdsStore = featureIds.getDataStoreRef();
+  const usize sliceSize = dims[0] * dims[1];
+  const usize numSlices = dims[2];
+  if(sliceSize * numSlices == 0)
+  {
+    return 0;
+  }
+
+  // The first pass visits every unassigned cell
+  std::vector<std::vector<usize>> frontiers(numSlices);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numSlices);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize z = range.min(); z < range.max(); z++)
+      {
+        for(usize cell = z * sliceSize; cell < (z + 1) * sliceSize; cell++)
+        {
+          if(featureIdsStore[cell] < 0)
+          {
+            frontiers[z].push_back(cell);
+          }
+        }
+      }
+    });
+  }
+
+  std::vector<std::vector<CellFill>> sliceFills(numSlices);
+  std::vector<CellFill> fills;
+  while(true)
+  {
+    // The votes only read the feature ids so every slice can vote at once
+    {
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, numSlices);
+      dataAlg.execute([&](const ComplexRange& range) {
+        for(usize z = range.min(); z < range.max(); z++)
+        {
+          sliceFills[z].clear();
+          for(usize cell : frontiers[z])
+          {
+            const usize source = VoteForSource(featureIdsStore, dims, cell);
+            if(source != k_NoCell)
+            {
+              sliceFills[z].push_back({cell, source});
+            }
+          }
+        }
+      });
+    }
+
+    usize numFilled = 0;
+    for(const auto& slice : sliceFills)
+    {
+      numFilled += slice.size();
+    }
+    if(numFilled == 0)
+    {
+      break;
+    }
+
+    // Sources were assigned before this pass and destinations were not, so the writes never overlap the reads
+    {
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, numSlices);
+      dataAlg.execute([&](const ComplexRange& range) {
+        for(usize z = range.min(); z < range.max(); z++)
+        {
+          for(const CellFill& fill : sliceFills[z])
+          {
+            featureIdsStore[fill.cell] = featureIdsStore[fill.source];
+          }
+        }
+      });
+    }
+
+    // Any cell still unassigned had no assigned neighbor, so only neighbors of the cells assigned in this pass can change
+    {
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, numSlices);
+      dataAlg.execute([&](const ComplexRange& range) {
+        for(usize z = range.min(); z < range.max(); z++)
+        {
+          std::vector<usize>& frontier = frontiers[z];
+          frontier.clear();
+          auto addCandidate = [&](usize cell) {
+            if(featureIdsStore[cell] < 0)
+            {
+              frontier.push_back(cell);
+            }
+          };
+          if(z > 0)
+          {
+            for(const CellFill& fill : sliceFills[z - 1])
+            {
+              addCandidate(fill.cell + sliceSize);
+            }
+          }
+          for(const CellFill& fill : sliceFills[z])
+          {
+            const usize x = fill.cell % dims[0];
+            const usize y = (fill.cell / dims[0]) % dims[1];
+            if(y > 0)
+            {
+              addCandidate(fill.cell - dims[0]);
+            }
+            if(x > 0)
+            {
+              addCandidate(fill.cell - 1);
+            }
+            if(x < dims[0] - 1)
+            {
+              addCandidate(fill.cell + 1);
+            }
+            if(y < dims[1] - 1)
+            {
+              addCandidate(fill.cell + dims[0]);
+            }
+          }
+          if(z < numSlices - 1)
+          {
+            for(const CellFill& fill : sliceFills[z + 1])
+            {
+              addCandidate(fill.cell - sliceSize);
+            }
+          }
+          std::sort(frontier.begin(), frontier.end());
+          frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+        }
+      });
+    }
+
+    for(const auto& slice : sliceFills)
+    {
+      fills.insert(fills.end(), slice.begin(), slice.end());
+    }
+  }
+
+  if(fills.empty())
+  {
+    return 0;
+  }
+
+  // Follow every chain of assignments back to the cell that was assigned to begin with
+  std::sort(fills.begin(), fills.end(), [](const CellFill& lhs, const CellFill& rhs) { return lhs.cell < rhs.cell; });
+  std::vector<usize> cells(fills.size());
+  std::vector<usize> sources(fills.size());
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, fills.size());
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize i = range.min(); i < range.max(); i++)
+      {
+        usize source = fills[i].source;
+        auto iter = std::lower_bound(fills.cbegin(), fills.cend(), source, [](const CellFill& fill, usize cell) { return fill.cell < cell; });
+        while(iter != fills.cend() && iter->cell == source)
+        {
+          source = iter->source;
+          iter = std::lower_bound(fills.cbegin(), fills.cend(), source, [](const CellFill& fill, usize cell) { return fill.cell < cell; });
+        }
+        cells[i] = fills[i].cell;
+        sources[i] = source;
+      }
+    });
+  }
+
+  TupleCopier tupleCopier;
+  for(IDataArray* cellArray : cellArrays)
+  {
+    // The feature ids were already assigned pass by pass
+    if(cellArray != nullptr && cellArray != &featureIds)
+    {
+      tupleCopier.addArrays(*cellArray, *cellArray);
+    }
+  }
+  tupleCopier.copy(nonstd::span<const usize>(sources.data(), sources.size()), nonstd::span<const usize>(cells.data(), cells.size()));
+
+  return fills.size();
+}
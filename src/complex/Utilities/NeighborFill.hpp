@@ -0,0 +1,40 @@
+#pragma once
+
+#include "complex/Common/Array.hpp"
+#include "complex/Common/Types.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/IDataArray.hpp"
+#include "complex/complex_export.hpp"
+
+#include <vector>
+
+namespace complex
+{
+/**
+ * @brief Iterative filling of unassigned cells (negative feature id) of an image geometry from their
+ * face neighbors.
+ *
+ * Every pass gives each unassigned cell that touches an assigned cell the feature that is most common
+ * among its six face neighbors. A tie goes to the feature that reached the highest count first when
+ * visiting the neighbors in -z, -y, -x, +x, +y, +z order, and the cell takes its values from the
+ * neighbor at which that count was reached. Passes repeat until no more cells can be assigned.
+ *
+ * Only the cells next to a cell that was assigned in the previous pass are revisited, and the votes of
+ * a pass are computed in parallel over z slices. The feature ids are updated after each pass while all
+ * other cell arrays are copied once at the end, each cell directly from the originally assigned cell
+ * its values propagated from.
+ */
+namespace NeighborFill
+{
+/**
+ * @brief Assigns the unassigned cells and copies the tuples of every cell array for them. The feature
+ * ids array may also be one of the cell arrays. Cells that are not connected to any assigned cell are
+ * left unassigned.
+ * @param featureIds
+ * @param dims Dimensions of the image geometry
+ * @param cellArrays Arrays with one tuple per cell
+ * @return usize The number of cells that were assigned
+ */
+COMPLEX_EXPORT usize FillBadCells(Int32Array& featureIds, const SizeVec3& dims, const std::vector<IDataArray*>& cellArrays);
+} // namespace NeighborFill
+} // namespace complex
@@ -37,6 +37,7 @@
 #include <array>
 
 #include "complex/Common/ComplexRange2D.hpp"
+#include "complex/Utilities/ExecutionContext.hpp"
 #include "complex/complex_export.hpp"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
@@ -121,8 +122,10 @@ public:
     doParallel = m_RunParallel;
     if(doParallel)
     {
-      tbb::blocked_range2d<size_t, size_t> tbbRange(m_Range.minRow(), m_Range.maxRow(), m_Range.minCol(), m_Range.maxCol());
-      tbb::parallel_for(tbbRange, body, m_Partitioner);
+      ExecutionContext::Global().execute([&]() {
+        tbb::blocked_range2d<size_t, size_t> tbbRange(m_Range.minRow(), m_Range.maxRow(), m_Range.minCol(), m_Range.maxCol());
+        tbb::parallel_for(tbbRange, body, m_Partitioner);
+      });
     }
 #endif
 
@@ -35,6 +35,7 @@
 #pragma once
 
 #include "complex/Common/ComplexRange3D.hpp"
+#include "complex/Utilities/ExecutionContext.hpp"
 #include "complex/complex_export.hpp"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
@@ -125,8 +126,10 @@ public:
     doParallel = m_RunParallel;
     if(doParallel)
     {
-      tbb::blocked_range3d<size_t, size_t, size_t> tbbRange(m_Range[0], m_Range[1], m_Grain, m_Range[2], m_Range[3], m_Range[3], m_Range[4], m_Range[5], m_Range[5]);
-      tbb::parallel_for(tbbRange, body, m_Partitioner);
+      ExecutionContext::Global().execute([&]() {
+        tbb::blocked_range3d<size_t, size_t, size_t> tbbRange(m_Range[0], m_Range[1], m_Grain, m_Range[2], m_Range[3], m_Range[3], m_Range[4], m_Range[5], m_Range[5]);
+        tbb::parallel_for(tbbRange, body, m_Partitioner);
+      });
     }
 #endif
 
@@ -35,6 +35,7 @@
 #pragma once
 
 #include "complex/Common/ComplexRange.hpp"
+#include "complex/Utilities/ExecutionContext.hpp"
 #include "complex/complex_export.hpp"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
@@ -114,8 +115,10 @@ public:
     doParallel = m_RunParallel;
     if(doParallel)
     {
-      tbb::blocked_range<size_t> tbbRange(m_Range[0], m_Range[1]);
-      tbb::parallel_for(tbbRange, body, m_Partitioner);
+      ExecutionContext::Global().execute([&]() {
+        tbb::blocked_range<size_t> tbbRange(m_Range[0], m_Range[1]);
+        tbb::parallel_for(tbbRange, body, m_Partitioner);
+      });
     }
 #endif
 
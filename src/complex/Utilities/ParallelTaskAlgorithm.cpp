@@ -35,7 +35,6 @@
 #include "ParallelTaskAlgorithm.hpp"
 
 #include <algorithm>
-#include <thread>
 
 using namespace complex;
 
@@ -44,7 +43,7 @@ using namespace complex;
 // -----------------------------------------------------------------------------
 ParallelTaskAlgorithm::ParallelTaskAlgorithm()
 : m_Parallelization(true)
-, m_MaxThreads(std::thread::hardware_concurrency())
+, m_MaxThreads(static_cast<uint32_t>(ExecutionContext::Global().getMaxConcurrency()))
 #ifdef COMPLEX_ENABLE_MULTICORE
 , m_TaskGroup(new tbb::task_group)
 #endif
@@ -57,7 +56,7 @@ ParallelTaskAlgorithm::ParallelTaskAlgorithm()
 ParallelTaskAlgorithm::~ParallelTaskAlgorithm()
 {
 #ifdef COMPLEX_ENABLE_MULTICORE
-  m_TaskGroup->wait();
+  ExecutionContext::Global().execute([this]() { m_TaskGroup->wait(); });
 #endif
 }
 
@@ -82,11 +81,7 @@ void ParallelTaskAlgorithm::setParallelizationEnabled(bool doParallel)
 // -----------------------------------------------------------------------------
 uint32_t ParallelTaskAlgorithm::getMaxThreads() const
 {
-#ifdef COMPLEX_ENABLE_MULTICORE
   return m_MaxThreads;
-#else
-  return std::thread::hardware_concurrency();
-#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -94,7 +89,7 @@ uint32_t ParallelTaskAlgorithm::getMaxThreads() const
 // -----------------------------------------------------------------------------
 void ParallelTaskAlgorithm::setMaxThreads(uint32_t threads)
 {
-  m_MaxThreads = std::min(threads, std::thread::hardware_concurrency());
+  m_MaxThreads = std::min(threads, static_cast<uint32_t>(ExecutionContext::Global().getMaxConcurrency()));
 }
 
 // -----------------------------------------------------------------------------
@@ -104,7 +99,7 @@ void ParallelTaskAlgorithm::wait()
 {
 #ifdef COMPLEX_ENABLE_MULTICORE
   // This will spill over if the number of files to process does not divide evenly by the number of threads.
-  m_TaskGroup->wait();
+  ExecutionContext::Global().execute([this]() { m_TaskGroup->wait(); });
   m_CurThreads = 0;
 #endif
 }
@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include "complex/Utilities/ExecutionContext.hpp"
 #include "complex/complex_export.hpp"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
@@ -75,15 +76,16 @@ public:
   void setParallelizationEnabled(bool doParallel);
 
   /**
-   * @brief Return maximum threads to use for parallelization.  If Parallel Algorithms
-   * is not enabled, the maximum hardware concurrency is returned instead.
+   * @brief Return maximum threads to use for parallelization.  Defaults to the
+   * concurrency of the global ExecutionContext, which is 1 if Parallel Algorithms
+   * is not enabled.
    * @return
    */
   uint32_t getMaxThreads() const;
 
   /**
    * @brief Sets the maximum number of threads to use.  This amount is automatically
-   * reduced to the max hardware concurrency.
+   * reduced to the concurrency of the global ExecutionContext.
    * @param threads
    */
   void setMaxThreads(uint32_t threads);
@@ -102,7 +104,7 @@ public:
     doParallel = m_Parallelization;
     if(doParallel)
     {
-      m_TaskGroup->run(body);
+      ExecutionContext::Global().execute([&]() { m_TaskGroup->run(body); });
       m_CurThreads++;
       if(m_CurThreads >= m_MaxThreads)
       {
@@ -32,6 +32,7 @@ constexpr StringLiteral k_FileVersionTag = "FileVersion";
 constexpr StringLiteral k_PipelineJsonTag = "Pipeline";
 constexpr StringLiteral k_PipelineNameTag = "Current Pipeline";
 constexpr StringLiteral k_PipelineVersionTag = "Pipeline Version";
+constexpr StringLiteral k_CheckpointNextIndexTag = "Checkpoint Next Index";
 constexpr StringLiteral k_CurrentFileVersion = "8.0";
 
 constexpr int32_t k_CurrentPipelineVersion = 3;
@@ -93,9 +94,10 @@ complex::DREAM3D::PipelineVersionType complex::DREAM3D::GetPipelineVersion(const
   return pipelineVersionAttribute.readAsValue<PipelineVersionType>();
 }
 
-DataStructure ImportDataStructureV8(const H5::FileReader& fileReader, H5::ErrorType& errorCode, bool preflight)
+DataStructure ImportDataStructureV8(const H5::FileReader& fileReader, H5::ErrorType& errorCode, bool preflight, const std::optional<std::vector<DataPath>>& importPaths = {})
 {
   H5::DataStructureReader dataStructureReader;
+  dataStructureReader.setImportPaths(importPaths);
   auto dataStructure = dataStructureReader.readH5Group(fileReader, errorCode, preflight);
   if(errorCode < 0)
   {
@@ -580,6 +582,18 @@ complex::DataStructure complex::DREAM3D::ImportDataStructureFromFile(const H5::F
   return DataStructure();
 }
 
+complex::DataStructure complex::DREAM3D::ImportDataStructureFromFile(const H5::FileReader& fileReader, const std::vector<DataPath>& dataPaths, H5::ErrorType& errorCode, bool preflight)
+{
+  errorCode = 0;
+
+  const auto fileVersion = GetFileVersion(fileReader);
+  if(fileVersion == k_CurrentFileVersion)
+  {
+    return ImportDataStructureV8(fileReader, errorCode, preflight, dataPaths);
+  }
+  return ImportDataStructureFromFile(fileReader, errorCode, preflight);
+}
+
 Result<complex::DataStructure> complex::DREAM3D::ImportDataStructureFromFile(const std::filesystem::path& filePath)
 {
   H5::FileReader fileReader(filePath);
@@ -740,7 +754,7 @@ Result<> complex::DREAM3D::WriteFile(const std::filesystem::path& path, const Da
 
   H5::FileWriter fileWriter = std::move(fileWriterResult.value());
 
-  H5::ErrorType error = WriteFile(fileWriter, Pipeline(), dataStructure);
+  H5::ErrorType error = WriteFile(fileWriter, pipeline, dataStructure);
   if(error < 0)
   {
     return MakeErrorResult(-2, fmt::format("complex::DREAM3D::WriteFile: Unable to write DREAM3D file with HDF5 error {}", error));
@@ -748,3 +762,75 @@ Result<> complex::DREAM3D::WriteFile(const std::filesystem::path& path, const Da
 
   return {};
 }
+
+Result<> complex::DREAM3D::WriteCheckpoint(const std::filesystem::path& path, const DataStructure& dataStructure, const Pipeline& pipeline, usize nextIndex)
+{
+  std::filesystem::path tempPath = path;
+  tempPath += ".tmp";
+  {
+    Result<H5::FileWriter> fileWriterResult = H5::FileWriter::CreateFile(tempPath);
+    if(fileWriterResult.invalid())
+    {
+      return ConvertResult(std::move(fileWriterResult));
+    }
+    H5::FileWriter fileWriter = std::move(fileWriterResult.value());
+
+    H5::ErrorType error = WriteFile(fileWriter, pipeline, dataStructure);
+    if(error >= 0)
+    {
+      auto nextIndexAttribute = fileWriter.createAttribute(k_CheckpointNextIndexTag);
+      error = nextIndexAttribute.writeValue<uint64>(nextIndex);
+    }
+    if(error < 0)
+    {
+      return MakeErrorResult(-2, fmt::format("complex::DREAM3D::WriteCheckpoint: Unable to write checkpoint with HDF5 error {}", error));
+    }
+  }
+
+  std::error_code errorCode;
+  std::filesystem::rename(tempPath, path, errorCode);
+  if(errorCode)
+  {
+    std::filesystem::remove(tempPath, errorCode);
+    return MakeErrorResult(-3, fmt::format("complex::DREAM3D::WriteCheckpoint: Unable to move checkpoint to '{}'", path.string()));
+  }
+  return {};
+}
+
+Result<complex::DREAM3D::CheckpointData> complex::DREAM3D::ReadCheckpoint(const std::filesystem::path& path)
+{
+  if(!std::filesystem::exists(path))
+  {
+    return MakeErrorResult<CheckpointData>(-1, fmt::format("complex::DREAM3D::ReadCheckpoint: File does not exist. '{}'", path.string()));
+  }
+  H5::FileReader fileReader(path);
+  if(!fileReader.isValid())
+  {
+    return MakeErrorResult<CheckpointData>(-1, fmt::format("complex::DREAM3D::ReadCheckpoint: Unable to open '{}' for reading", path.string()));
+  }
+
+  auto nextIndexAttribute = fileReader.getAttribute(k_CheckpointNextIndexTag);
+  if(!nextIndexAttribute.isValid())
+  {
+    return MakeErrorResult<CheckpointData>(-2, fmt::format("complex::DREAM3D::ReadCheckpoint: '{}' is not a checkpoint", path.string()));
+  }
+
+  CheckpointData checkpoint;
+  checkpoint.nextIndex = nextIndexAttribute.readAsValue<uint64>();
+
+  auto pipelineGroupReader = fileReader.openGroup(k_PipelineJsonTag);
+  auto pipelineDatasetReader = pipelineGroupReader.openDataset(k_PipelineJsonTag);
+  if(!pipelineDatasetReader.isValid())
+  {
+    return MakeErrorResult<CheckpointData>(-3, fmt::format("complex::DREAM3D::ReadCheckpoint: '{}' does not contain a pipeline", path.string()));
+  }
+  checkpoint.pipelineJson = pipelineDatasetReader.readAsString();
+
+  H5::ErrorType error = 0;
+  checkpoint.dataStructure = ImportDataStructureFromFile(fileReader, error);
+  if(error < 0)
+  {
+    return MakeErrorResult<CheckpointData>(-4, fmt::format("complex::DREAM3D::ReadCheckpoint: Unable to read the DataStructure from '{}'", path.string()));
+  }
+  return {std::move(checkpoint)};
+}
@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "complex/Pipeline/Pipeline.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5.hpp"
@@ -25,6 +26,18 @@ using FileData = std::pair<complex::Pipeline, complex::DataStructure>;
 using FileVersionType = std::string;
 using PipelineVersionType = int32;
 
+/**
+ * @brief The contents of a checkpoint written while executing a pipeline.
+ * pipelineJson is the serialized pipeline that was executing and nextIndex is
+ * the index of the first node that had not been executed yet.
+ */
+struct CheckpointData
+{
+  std::string pipelineJson;
+  DataStructure dataStructure;
+  usize nextIndex = 0;
+};
+
 /**
  * @brief Returns the DREAM3D file version.
  * @param fileReader
@@ -102,6 +115,20 @@ COMPLEX_EXPORT Result<> WriteFile(const std::filesystem::path& path, const DataS
  */
 COMPLEX_EXPORT complex::DataStructure ImportDataStructureFromFile(const H5::FileReader& fileReader, H5::ErrorType& errorCode, bool preflight = false);
 
+/**
+ * @brief Imports and returns the DataObjects at the given paths from the target
+ * .dream3d file along with the groups containing them. Nothing else is read from
+ * a current file. Legacy files are imported in full.
+ * If an error occurs while reading the file, the provided error code is updated
+ * accordingly.
+ * @param fileReader
+ * @param dataPaths
+ * @param errorCode
+ * @param preflight = false
+ * @return complex::DataStructure
+ */
+COMPLEX_EXPORT complex::DataStructure ImportDataStructureFromFile(const H5::FileReader& fileReader, const std::vector<DataPath>& dataPaths, H5::ErrorType& errorCode, bool preflight = false);
+
 /**
  * @brief Imports and returns the DataStructure from the target .dream3d file.
  * This method imports both current and legacy DataStructures.
@@ -129,5 +156,28 @@ COMPLEX_EXPORT complex::Pipeline ImportPipelineFromFile(const H5::FileReader& fi
  * @return complex::Pipeline
  */
 COMPLEX_EXPORT Result<complex::Pipeline> ImportPipelineFromFile(const std::filesystem::path& filePath);
+
+/**
+ * @brief Writes a checkpoint of a partially executed pipeline. The checkpoint
+ * is a regular .dream3d file with an extra attribute holding the index of the
+ * next node to execute, so it can be opened like any other .dream3d file.
+ *
+ * The file is written under a temporary name and then renamed over the target
+ * path, so the previous checkpoint stays intact if writing fails.
+ * @param path
+ * @param dataStructure
+ * @param pipeline
+ * @param nextIndex
+ * @return Result<>
+ */
+COMPLEX_EXPORT Result<> WriteCheckpoint(const std::filesystem::path& path, const DataStructure& dataStructure, const Pipeline& pipeline, usize nextIndex);
+
+/**
+ * @brief Reads a checkpoint written by WriteCheckpoint(). Returns an error if
+ * the file is not a checkpoint.
+ * @param path
+ * @return Result<CheckpointData>
+ */
+COMPLEX_EXPORT Result<CheckpointData> ReadCheckpoint(const std::filesystem::path& path);
 } // namespace DREAM3D
 } // namespace complex
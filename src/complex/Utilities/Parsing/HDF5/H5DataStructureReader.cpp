@@ -4,6 +4,7 @@
 #include "complex/DataStructure/DataMap.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5GroupReader.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5IDataFactory.hpp"
+#include "complex/Utilities/Parsing/HDF5/H5IOEngine.hpp"
 
 using namespace complex;
 
@@ -34,12 +35,30 @@ complex::DataStructure H5::DataStructureReader::readH5Group(const H5::GroupReade
 
   m_CurrentStructure = DataStructure();
   m_CurrentStructure.setNextId(idAttribute.readAsValue<DataObject::IdType>());
+
+  // Array data found during the walk is read afterwards by the IOEngine so the
+  // allocation of each array overlaps the reads of the ones before it
+  H5::IOEngine ioEngine;
+  m_IOEngine = &ioEngine;
   errorCode = m_CurrentStructure.getRootGroup().readH5Group(*this, rootGroupReader, {}, preflight);
+  m_IOEngine = nullptr;
+
+  H5::ErrorType transferError = ioEngine.run();
+  if(errorCode >= 0)
+  {
+    errorCode = transferError;
+  }
   return std::move(m_CurrentStructure);
 }
 
 H5::ErrorType H5::DataStructureReader::readObjectFromGroup(const H5::GroupReader& parentGroup, const std::string& objectName, const std::optional<DataObject::IdType>& parentId, bool preflight)
 {
+  // Skip objects outside of the requested paths without opening them
+  if(!isImportedPath(parentId, objectName))
+  {
+    return 0;
+  }
+
   H5::IDataFactory* factory = nullptr;
 
   // Get H5::IDataFactory and check DataObject ID
@@ -109,6 +128,58 @@ H5::ErrorType H5::DataStructureReader::readObjectFromGroup(const H5::GroupReader
   return 0;
 }
 
+void H5::DataStructureReader::setImportPaths(const std::optional<std::vector<DataPath>>& importPaths)
+{
+  m_ImportPaths = importPaths;
+}
+
+bool H5::DataStructureReader::isImportedPath(const std::optional<DataObject::IdType>& parentId, const std::string& objectName) const
+{
+  if(!m_ImportPaths.has_value())
+  {
+    return true;
+  }
+
+  std::vector<DataPath> objectPaths;
+  if(!parentId.has_value())
+  {
+    objectPaths.push_back(DataPath({objectName}));
+  }
+  else if(const auto* parent = m_CurrentStructure.getData(parentId.value()); parent != nullptr)
+  {
+    for(const auto& parentPath : parent->getDataPaths())
+    {
+      objectPaths.push_back(parentPath.createChildPath(objectName));
+    }
+  }
+
+  for(const auto& importPath : *m_ImportPaths)
+  {
+    for(const auto& objectPath : objectPaths)
+    {
+      if(importPath.getLength() < objectPath.getLength())
+      {
+        continue;
+      }
+      bool isPrefix = true;
+      for(usize i = 0; i < objectPath.getLength() && isPrefix; i++)
+      {
+        isPrefix = (importPath[i] == objectPath[i]);
+      }
+      if(isPrefix)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+H5::IOEngine* H5::DataStructureReader::getIOEngine() const
+{
+  return m_IOEngine;
+}
+
 DataStructure& H5::DataStructureReader::getDataStructure()
 {
   return m_CurrentStructure;
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "complex/DataStructure/DataObject.hpp"
+#include "complex/DataStructure/DataPath.hpp"
 #include "complex/DataStructure/DataStructure.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5DataFactoryManager.hpp"
 
@@ -14,6 +16,7 @@ namespace H5
 {
 class GroupReader;
 class IDataFactory;
+class IOEngine;
 
 /**
  * @class DataStructureReader
@@ -59,6 +62,23 @@ public:
    */
   H5::ErrorType readObjectFromGroup(const H5::GroupReader& parentGroup, const std::string& objectName, const std::optional<DataObject::IdType>& parentId = {}, bool preflight = false);
 
+  /**
+   * @brief Restricts the objects read by readH5Group to the given DataPaths and the
+   * groups containing them. The children of a given path are only read if their
+   * own paths are also given. An empty optional reads every object.
+   * @param importPaths
+   */
+  void setImportPaths(const std::optional<std::vector<DataPath>>& importPaths);
+
+  /**
+   * @brief Returns the IOEngine that data transfers can be queued on while
+   * readH5Group walks the file. The queued jobs run before readH5Group returns.
+   * Returns nullptr outside of readH5Group, in which case objects must be read
+   * immediately.
+   * @return H5::IOEngine*
+   */
+  H5::IOEngine* getIOEngine() const;
+
   /**
    * @brief Returns a reference to the current DataStructure. Returns an empty
    * DataStructure when not importing from HDF5 file.
@@ -87,9 +107,20 @@ protected:
    */
   H5::IDataFactory* getDataFactory(const std::string& typeName) const;
 
+  /**
+   * @brief Returns true if the named object under the given parent is one of the
+   * import paths or contains one of them.
+   * @param parentId
+   * @param objectName
+   * @return bool
+   */
+  bool isImportedPath(const std::optional<DataObject::IdType>& parentId, const std::string& objectName) const;
+
 private:
   H5::DataFactoryManager* m_FactoryManager = nullptr;
   DataStructure m_CurrentStructure;
+  std::optional<std::vector<DataPath>> m_ImportPaths;
+  H5::IOEngine* m_IOEngine = nullptr;
 };
 } // namespace H5
 } // namespace complex
@@ -0,0 +1,97 @@
+#include "H5IOEngine.hpp"
+
+#include "complex/Utilities/ExecutionContext.hpp"
+
+#ifdef COMPLEX_ENABLE_MULTICORE
+#include <tbb/parallel_pipeline.h>
+#endif
+
+#include <algorithm>
+
+using namespace complex;
+
+H5::IOEngine::IOEngine(usize maxJobsInFlight)
+: m_MaxJobsInFlight(std::max<usize>(maxJobsInFlight, 1))
+{
+}
+
+H5::IOEngine::~IOEngine() noexcept = default;
+
+void H5::IOEngine::submit(Job job)
+{
+  m_Jobs.push_back(std::move(job));
+}
+
+usize H5::IOEngine::getNumberOfJobs() const
+{
+  return m_Jobs.size();
+}
+
+void H5::IOEngine::clear()
+{
+  m_Jobs.clear();
+}
+
+H5::ErrorType H5::IOEngine::run()
+{
+  std::vector<Job> jobs = std::move(m_Jobs);
+  m_Jobs.clear();
+
+  H5::ErrorType error = 0;
+  auto transfer = [&error](Job& job) {
+    if(error >= 0 && job.transfer)
+    {
+      error = job.transfer();
+    }
+  };
+
+#ifdef COMPLEX_ENABLE_MULTICORE
+  usize nextJob = 0;
+  ExecutionContext::Global().execute([&]() {
+    tbb::parallel_pipeline(m_MaxJobsInFlight,
+                           tbb::make_filter<void, Job*>(tbb::filter_mode::serial_in_order,
+                                                        [&](tbb::flow_control& control) -> Job* {
+                                                          if(nextJob == jobs.size())
+                                                          {
+                                                            control.stop();
+                                                            return nullptr;
+                                                          }
+                                                          return &jobs[nextJob++];
+                                                        }) &
+                               tbb::make_filter<Job*, Job*>(tbb::filter_mode::parallel,
+                                                            [](Job* job) {
+                                                              if(job->prepare)
+                                                              {
+                                                                job->prepare();
+                                                              }
+                                                              return job;
+                                                            }) &
+                               tbb::make_filter<Job*, Job*>(tbb::filter_mode::serial_in_order,
+                                                            [&transfer](Job* job) {
+                                                              transfer(*job);
+                                                              return job;
+                                                            }) &
+                               tbb::make_filter<Job*, void>(tbb::filter_mode::parallel, [](Job* job) {
+                                 if(job->finish)
+                                 {
+                                   job->finish();
+                                 }
+                               }));
+  });
+#else
+  for(auto& job : jobs)
+  {
+    if(job.prepare)
+    {
+      job.prepare();
+    }
+    transfer(job);
+    if(job.finish)
+    {
+      job.finish();
+    }
+  }
+#endif
+
+  return error;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+#include "complex/Utilities/Parsing/HDF5/H5.hpp"
+#include "complex/complex_export.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace complex
+{
+namespace H5
+{
+/**
+ * @class IOEngine
+ * @brief The IOEngine class overlaps the HDF5 transfers of many datasets with
+ * the CPU work that has to happen before or after each transfer.
+ *
+ * Every job is split into three steps. prepare() and finish() run on the thread
+ * pool and must not call into HDF5. transfer() is the only step allowed to call
+ * into HDF5; transfers run one at a time in the order the jobs were submitted,
+ * because the HDF5 library is not thread safe. While one job transfers, the
+ * following jobs are prepared and the previous ones are finished, so the disk
+ * and the cores stay busy at the same time.
+ */
+class COMPLEX_EXPORT IOEngine
+{
+public:
+  struct Job
+  {
+    std::function<void()> prepare;
+    std::function<H5::ErrorType()> transfer;
+    std::function<void()> finish;
+  };
+
+  /**
+   * @brief Constructs an IOEngine that keeps at most maxJobsInFlight jobs
+   * between their prepare() and finish() steps.
+   * @param maxJobsInFlight
+   */
+  IOEngine(usize maxJobsInFlight = 4);
+
+  ~IOEngine() noexcept;
+
+  IOEngine(const IOEngine&) = delete;
+  IOEngine(IOEngine&&) noexcept = default;
+  IOEngine& operator=(const IOEngine&) = delete;
+  IOEngine& operator=(IOEngine&&) noexcept = default;
+
+  /**
+   * @brief Queues a job. Any of its steps may be empty.
+   * @param job
+   */
+  void submit(Job job);
+
+  /**
+   * @brief Returns the number of queued jobs.
+   * @return usize
+   */
+  usize getNumberOfJobs() const;
+
+  /**
+   * @brief Runs every queued job and empties the queue. Once a transfer fails
+   * the transfers of the remaining jobs are skipped and the first error is
+   * returned. Returns 0 otherwise.
+   * @return H5::ErrorType
+   */
+  H5::ErrorType run();
+
+  /**
+   * @brief Drops every queued job without running it.
+   */
+  void clear();
+
+private:
+  std::vector<Job> m_Jobs;
+  usize m_MaxJobsInFlight = 4;
+};
+} // namespace H5
+} // namespace complex
@@ -1,6 +1,8 @@
 #include "SegmentFeatures.hpp"
 
 #include "complex/DataStructure/Geometry/AbstractGeometryGrid.hpp"
+#include "complex/Utilities/CounterBasedRandom.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
 
 using namespace complex;
 
@@ -137,54 +139,31 @@ bool SegmentFeatures::determineGrouping(int64 referencePoint, int64 neighborPoin
 }
 
 // -----------------------------------------------------------------------------
-SegmentFeatures::SeedGenerator SegmentFeatures::initializeVoxelSeedGenerator(Int64Distribution& distribution, const int64 rangeMin, const int64 rangeMax) const
+void SegmentFeatures::randomizeFeatureIds(complex::Int32Array* featureIds, uint64 totalPoints, uint64 totalFeatures, uint64 seed) const
 {
-  auto seed = static_cast<SeedGenerator::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  SeedGenerator generator;
-  generator.seed(seed);
-  distribution = std::uniform_int_distribution<int64>(rangeMin, rangeMax);
-
-  return generator;
-}
-
-// -----------------------------------------------------------------------------
-void SegmentFeatures::randomizeFeatureIds(complex::Int32Array* featureIds, uint64 totalPoints, uint64 totalFeatures, Int64Distribution& distribution) const
-{
-  // notifyStatusMessage("Randomizing Feature Ids");
-  // Generate an even distribution of numbers between the min and max range
-  const int64 rangeMin = 1;
-  const int64 rangeMax = totalFeatures - 1;
-  auto generator = initializeVoxelSeedGenerator(distribution, rangeMin, rangeMax);
-
-  DataStructure tmpStructure;
-  auto rndNumbers = Int64Array::CreateWithStore<DataStore<int64>>(tmpStructure, std::string("_INTERNAL_USE_ONLY_NewFeatureIds"), std::vector<usize>{totalFeatures}, std::vector<usize>{1});
-  auto rndStore = rndNumbers->getDataStore();
-
-  for(int64 i = 0; i < totalFeatures; ++i)
+  m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Randomizing Feature Ids using seed {}", seed)});
+  if(totalFeatures < 2)
   {
-    rndStore->setValue(i, i);
+    return;
   }
 
-  int64 r = 0;
-  int64 temp = 0;
-
-  //--- Shuffle elements by randomly exchanging each with one other.
-  for(int64 i = 1; i < totalFeatures; i++)
+  // Shuffle the ids 1 to totalFeatures - 1 while feature 0 keeps its id
+  const Philox4x32 generator(seed);
+  const std::vector<usize> permutation = CounterBasedRandom::RandomPermutation(generator, totalFeatures - 1);
+  std::vector<int32> newFeatureIds(totalFeatures, 0);
+  for(usize i = 0; i < permutation.size(); i++)
   {
-    r = distribution(generator); // Random remaining position.
-    if(r >= totalFeatures)
-    {
-      continue;
-    }
-    temp = rndStore->getValue(i);
-    rndStore->setValue(i, rndStore->getValue(r));
-    rndStore->setValue(r, temp);
+    newFeatureIds[i + 1] = static_cast<int32>(permutation[i] + 1);
   }
 
-  // Now adjust all the Grain Id values for each Voxel
-  auto featureIdsStore = featureIds->getDataStore();
-  for(int64 i = 0; i < totalPoints; ++i)
-  {
-    featureIdsStore->setValue(i, rndStore->getValue(featureIdsStore->getValue(i)));
-  }
+  // Now adjust all the Feature Id values for each Voxel
+  auto& featureIdsStore = featureIds->getDataStoreRef();
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalPoints);
+  dataAlg.execute([&featureIdsStore, &newFeatureIds](const ComplexRange& range) {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      featureIdsStore[i] = newFeatureIds[featureIdsStore[i]];
+    }
+  });
 }
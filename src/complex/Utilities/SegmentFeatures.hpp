@@ -8,7 +8,6 @@
 #include "complex/Filter/Arguments.hpp"
 #include "complex/Filter/IFilter.hpp"
 
-#include <random>
 #include <vector>
 
 namespace complex
@@ -20,9 +19,6 @@ class COMPLEX_EXPORT SegmentFeatures
 {
 
 public:
-  using SeedGenerator = std::mt19937_64;
-  using Int64Distribution = std::uniform_int_distribution<int64>;
-
   SegmentFeatures(DataStructure& data, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler);
 
   virtual ~SegmentFeatures();
@@ -61,22 +57,15 @@ public:
   virtual bool determineGrouping(int64_t referencePoint, int64_t neighborPoint, int32_t gnum) const;
 
   /**
-   * @brief
+   * @brief Randomly renumbers the features 1 to totalFeatures - 1. Feature 0 keeps its id. The
+   * new ids are drawn from a counter-based generator and applied in parallel, so the result only
+   * depends on the seed.
    * @param featureIds
    * @param totalPoints
    * @param totalFeatures
-   * @param distribution
-   */
-  virtual void randomizeFeatureIds(Int32Array* featureIds, uint64 totalPoints, uint64 totalFeatures, Int64Distribution& distribution) const;
-
-  /**
-   * @brief
-   * @param distribution
-   * @param rangeMin
-   * @param rangeMax
-   * @return
+   * @param seed
    */
-  virtual SeedGenerator initializeVoxelSeedGenerator(Int64Distribution& distribution, const int64 rangeMin, const int64 rangeMax) const;
+  virtual void randomizeFeatureIds(Int32Array* featureIds, uint64 totalPoints, uint64 totalFeatures, uint64 seed) const;
 
   /* from http://www.newty.de/fpt/functor.html */
   /**
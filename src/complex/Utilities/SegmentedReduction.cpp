@@ -0,0 +1,190 @@
+#include "SegmentedReduction.hpp"
+
+#include "complex/Utilities/ExecutionContext.hpp"
+
+#include <algorithm>
+
+using namespace complex;
+
+namespace
+{
+// Slabs smaller than this are not worth a separate task
+constexpr usize k_MinSlabSize = 16384;
+
+/**
+ * @brief Returns true if the cell is part of a feature and is not rejected by the mask.
+ * @param featureId
+ * @param numFeatures
+ * @param mask
+ * @param cellIndex
+ * @return bool
+ */
+inline bool IsGroupedCell(int32 featureId, usize numFeatures, const MaskCompare* mask, usize cellIndex)
+{
+  return featureId >= 0 && static_cast<usize>(featureId) < numFeatures && (mask == nullptr || mask->isTrue(cellIndex));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+usize SegmentedReduction::FindNumberOfFeatures(const Int32Array& featureIds)
+{
+  const usize numCells = featureIds.getNumberOfTuples();
+  const usize numSlabs = ComputeNumberOfSlabs(numCells, 1);
+  const usize slabSize = (numCells + numSlabs - 1) / numSlabs;
+
+  std::vector<int32> slabMaxima(numSlabs, -1);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numSlabs);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize slab = range.min(); slab < range.max(); slab++)
+    {
+      int32 maximum = -1;
+      const usize end = std::min(numCells, (slab + 1) * slabSize);
+      for(usize cellIndex = slab * slabSize; cellIndex < end; cellIndex++)
+      {
+        maximum = std::max(maximum, featureIds[cellIndex]);
+      }
+      slabMaxima[slab] = maximum;
+    }
+  });
+
+  return static_cast<usize>(*std::max_element(slabMaxima.cbegin(), slabMaxima.cend()) + 1);
+}
+
+// -----------------------------------------------------------------------------
+usize SegmentedReduction::ComputeNumberOfSlabs(usize numCells, usize numFeatures)
+{
+  usize numSlabs = 4 * std::max<usize>(ExecutionContext::Global().getMaxConcurrency(), 1);
+  numSlabs = std::min(numSlabs, numCells / k_MinSlabSize);
+  // Every slab holds an accumulator per feature, so keep their total below the number of cells
+  numSlabs = std::min(numSlabs, numCells / std::max<usize>(numFeatures, 1));
+  return std::max<usize>(numSlabs, 1);
+}
+
+// -----------------------------------------------------------------------------
+std::vector<usize> SegmentedReduction::CountCells(const Int32Array& featureIds, usize numFeatures, const MaskCompare* mask)
+{
+  return Reduce<usize>(
+      featureIds, numFeatures, 0, [](usize& count, usize) { count++; }, [](usize& total, usize count) { total += count; }, mask);
+}
+
+// -----------------------------------------------------------------------------
+std::vector<SegmentedReduction::CellBounds> SegmentedReduction::FindCellBounds(const Int32Array& featureIds, usize numFeatures)
+{
+  return Reduce<CellBounds>(
+      featureIds, numFeatures, CellBounds{},
+      [](CellBounds& bounds, usize cellIndex) {
+        if(bounds.empty())
+        {
+          bounds.first = cellIndex;
+        }
+        bounds.last = cellIndex;
+      },
+      [](CellBounds& total, const CellBounds& bounds) {
+        if(bounds.empty())
+        {
+          return;
+        }
+        if(total.empty())
+        {
+          total.first = bounds.first;
+        }
+        total.last = bounds.last;
+      });
+}
+
+// -----------------------------------------------------------------------------
+SegmentedReduction::FeatureGrouping::FeatureGrouping(const Int32Array& featureIds, usize numFeatures, const MaskCompare* mask)
+{
+  const usize numCells = featureIds.getNumberOfTuples();
+  const usize numSlabs = ComputeNumberOfSlabs(numCells, numFeatures);
+  const usize slabSize = (numCells + numSlabs - 1) / numSlabs;
+
+  // Count the cells of every feature within each slab
+  std::vector<std::vector<usize>> slabCounts(numSlabs);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numSlabs);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize slab = range.min(); slab < range.max(); slab++)
+      {
+        std::vector<usize> counts(numFeatures, 0);
+        const usize end = std::min(numCells, (slab + 1) * slabSize);
+        for(usize cellIndex = slab * slabSize; cellIndex < end; cellIndex++)
+        {
+          const int32 featureId = featureIds[cellIndex];
+          if(IsGroupedCell(featureId, numFeatures, mask, cellIndex))
+          {
+            counts[featureId]++;
+          }
+        }
+        slabCounts[slab] = std::move(counts);
+      }
+    });
+  }
+
+  // Turn the counts into the position where each slab starts writing the cells of a feature.
+  // Earlier slabs come first so every feature stays sorted by cell index.
+  m_Offsets.assign(numFeatures + 1, 0);
+  usize position = 0;
+  for(usize featureId = 0; featureId < numFeatures; featureId++)
+  {
+    m_Offsets[featureId] = position;
+    for(usize slab = 0; slab < numSlabs; slab++)
+    {
+      const usize count = slabCounts[slab][featureId];
+      slabCounts[slab][featureId] = position;
+      position += count;
+    }
+  }
+  m_Offsets[numFeatures] = position;
+
+  m_CellIds.resize(position);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numSlabs);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize slab = range.min(); slab < range.max(); slab++)
+    {
+      std::vector<usize>& cursors = slabCounts[slab];
+      const usize end = std::min(numCells, (slab + 1) * slabSize);
+      for(usize cellIndex = slab * slabSize; cellIndex < end; cellIndex++)
+      {
+        const int32 featureId = featureIds[cellIndex];
+        if(IsGroupedCell(featureId, numFeatures, mask, cellIndex))
+        {
+          m_CellIds[cursors[featureId]++] = cellIndex;
+        }
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+usize SegmentedReduction::FeatureGrouping::getNumberOfFeatures() const
+{
+  return m_Offsets.size() - 1;
+}
+
+// -----------------------------------------------------------------------------
+usize SegmentedReduction::FeatureGrouping::getNumberOfCells() const
+{
+  return m_CellIds.size();
+}
+
+// -----------------------------------------------------------------------------
+nonstd::span<const usize> SegmentedReduction::FeatureGrouping::getCells(usize featureId) const
+{
+  if(featureId >= getNumberOfFeatures())
+  {
+    return {};
+  }
+  const usize begin = m_Offsets[featureId];
+  const usize end = m_Offsets[featureId + 1];
+  return {m_CellIds.data() + begin, end - begin};
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<usize>& SegmentedReduction::FeatureGrouping::getOffsets() const
+{
+  return m_Offsets;
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/Utilities/DataArrayUtilities.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/complex_export.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace complex
+{
+/**
+ * @brief Reductions of cell level data into per feature values ("segmented" by the feature id of each cell).
+ *
+ * The cells are split into contiguous slabs that are reduced in parallel into private per feature
+ * accumulators. The slab results are then merged in slab order, so a reduction sees the cells of a
+ * feature in ascending cell order exactly like a serial loop would. This keeps order dependent
+ * reductions such as "first value" or "last value wins" identical to their serial counterparts.
+ *
+ * Cells whose feature id is negative or not less than the number of features are skipped, as are
+ * cells rejected by the optional mask.
+ */
+namespace SegmentedReduction
+{
+/**
+ * @brief Returns the largest feature id plus one, or zero if there are no non negative feature ids.
+ * @param featureIds
+ * @return usize
+ */
+COMPLEX_EXPORT usize FindNumberOfFeatures(const Int32Array& featureIds);
+
+/**
+ * @brief Returns the number of slabs used to reduce the given number of cells. Fewer slabs are used
+ * when the private accumulators of every slab together would outnumber the cells.
+ * @param numCells
+ * @param numFeatures
+ * @return usize
+ */
+COMPLEX_EXPORT usize ComputeNumberOfSlabs(usize numCells, usize numFeatures);
+
+/**
+ * @brief Reduces every cell into the accumulator of its feature.
+ *
+ * accumulate(AccumulatorT& featureAccumulator, usize cellIndex) is called for each cell with the
+ * accumulator of the cell's feature. merge(AccumulatorT& total, const AccumulatorT& slabTotal) folds
+ * the accumulator of a later slab into the total of the earlier cells. Both functions must be safe to
+ * call from several threads at once as long as they only touch the accumulators they are given.
+ * @param featureIds
+ * @param numFeatures
+ * @param identity Initial value of every accumulator
+ * @param accumulate
+ * @param merge
+ * @param mask Optional mask; cells for which the mask is false are skipped
+ * @return std::vector<AccumulatorT> One accumulator per feature
+ */
+template <typename AccumulatorT, typename AccumulateFuncT, typename MergeFuncT>
+std::vector<AccumulatorT> Reduce(const Int32Array& featureIds, usize numFeatures, const AccumulatorT& identity, AccumulateFuncT&& accumulate, MergeFuncT&& merge,
+                                 const MaskCompare* mask = nullptr)
+{
+  const usize numCells = featureIds.getNumberOfTuples();
+  const usize numSlabs = ComputeNumberOfSlabs(numCells, numFeatures);
+  const usize slabSize = (numCells + numSlabs - 1) / numSlabs;
+
+  std::vector<std::vector<AccumulatorT>> slabAccumulators(numSlabs);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numSlabs);
+  dataAlg.execute([&](const ComplexRange& range) {
+    for(usize slab = range.min(); slab < range.max(); slab++)
+    {
+      std::vector<AccumulatorT> accumulators(numFeatures, identity);
+      const usize end = std::min(numCells, (slab + 1) * slabSize);
+      for(usize cellIndex = slab * slabSize; cellIndex < end; cellIndex++)
+      {
+        const int32 featureId = featureIds[cellIndex];
+        if(featureId < 0 || static_cast<usize>(featureId) >= numFeatures || (mask != nullptr && !mask->isTrue(cellIndex)))
+        {
+          continue;
+        }
+        accumulate(accumulators[featureId], cellIndex);
+      }
+      slabAccumulators[slab] = std::move(accumulators);
+    }
+  });
+
+  std::vector<AccumulatorT> totals = std::move(slabAccumulators[0]);
+  for(usize slab = 1; slab < numSlabs; slab++)
+  {
+    const std::vector<AccumulatorT>& accumulators = slabAccumulators[slab];
+    for(usize featureId = 0; featureId < numFeatures; featureId++)
+    {
+      merge(totals[featureId], accumulators[featureId]);
+    }
+  }
+  return totals;
+}
+
+/**
+ * @brief Returns the number of cells that belong to each feature.
+ * @param featureIds
+ * @param numFeatures
+ * @param mask Optional mask; cells for which the mask is false are not counted
+ * @return std::vector<usize>
+ */
+COMPLEX_EXPORT std::vector<usize> CountCells(const Int32Array& featureIds, usize numFeatures, const MaskCompare* mask = nullptr);
+
+/**
+ * @brief The first and last cell of a feature. Both are k_NoCell for features without cells.
+ */
+struct COMPLEX_EXPORT CellBounds
+{
+  static inline constexpr usize k_NoCell = std::numeric_limits<usize>::max();
+
+  usize first = k_NoCell;
+  usize last = k_NoCell;
+
+  bool empty() const
+  {
+    return first == k_NoCell;
+  }
+};
+
+/**
+ * @brief Returns the first and last cell of each feature.
+ * @param featureIds
+ * @param numFeatures
+ * @return std::vector<CellBounds>
+ */
+COMPLEX_EXPORT std::vector<CellBounds> FindCellBounds(const Int32Array& featureIds, usize numFeatures);
+
+/**
+ * @class FeatureGrouping
+ * @brief Groups the cell indices by feature id with a parallel counting sort. The cells of each
+ * feature are stored contiguously (CSR layout) in ascending cell order. This is the sort-by-key
+ * counterpart of Reduce for reductions that need every value of a feature at once, such as the
+ * median, the mode or a histogram.
+ */
+class COMPLEX_EXPORT FeatureGrouping
+{
+public:
+  /**
+   * @brief Groups the cells of the given feature ids.
+   * @param featureIds
+   * @param numFeatures
+   * @param mask Optional mask; cells for which the mask is false are left out
+   */
+  FeatureGrouping(const Int32Array& featureIds, usize numFeatures, const MaskCompare* mask = nullptr);
+
+  FeatureGrouping(const FeatureGrouping&) = default;
+  FeatureGrouping(FeatureGrouping&&) noexcept = default;
+  FeatureGrouping& operator=(const FeatureGrouping&) = default;
+  FeatureGrouping& operator=(FeatureGrouping&&) noexcept = default;
+  ~FeatureGrouping() noexcept = default;
+
+  /**
+   * @brief Returns the number of features.
+   * @return usize
+   */
+  usize getNumberOfFeatures() const;
+
+  /**
+   * @brief Returns the number of grouped cells.
+   * @return usize
+   */
+  usize getNumberOfCells() const;
+
+  /**
+   * @brief Returns the cell indices of the given feature in ascending order.
+   * @param featureId
+   * @return nonstd::span<const usize>
+   */
+  nonstd::span<const usize> getCells(usize featureId) const;
+
+  /**
+   * @brief Returns the feature offsets. The cells of feature i are stored at positions
+   * [offsets[i], offsets[i + 1]) of the sorted cell list.
+   * @return const std::vector<usize>&
+   */
+  const std::vector<usize>& getOffsets() const;
+
+private:
+  std::vector<usize> m_Offsets;
+  std::vector<usize> m_CellIds;
+};
+} // namespace SegmentedReduction
+} // namespace complex
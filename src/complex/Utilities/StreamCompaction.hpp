@@ -0,0 +1,89 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace complex
+{
+/**
+ * @brief Parallel stream compaction: selecting the elements of a sequence that pass a test while
+ * keeping their order.
+ *
+ * The sequence is split into fixed size blocks. The selected elements of every block are counted in
+ * parallel, an exclusive scan of the block counts gives the position of each block's first selected
+ * element in the output, and the blocks then write their selected indices to those positions in
+ * parallel. The result is identical to a serial loop over the sequence.
+ *
+ * The returned indices can be handed to TupleCopier::gather() to compact the tuples of any number of
+ * arrays attached to the removed elements.
+ */
+namespace StreamCompaction
+{
+inline constexpr usize k_BlockSize = 16384;
+
+/**
+ * @brief Returns the indices in [0, size) for which the predicate is true, in ascending order.
+ *
+ * The predicate is called twice for every index, possibly from several threads at once, so it must
+ * not modify any shared state and must return the same answer both times.
+ * @param size
+ * @param predicate bool predicate(usize index)
+ * @return std::vector<IndexT>
+ */
+template <typename IndexT = usize, typename PredicateT>
+std::vector<IndexT> SelectIndices(usize size, PredicateT&& predicate)
+{
+  const usize numBlocks = (size + k_BlockSize - 1) / k_BlockSize;
+  std::vector<usize> blockOffsets(numBlocks + 1, 0);
+
+  // Flag: count the selected elements of every block
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize block = range.min(); block < range.max(); block++)
+      {
+        const usize end = std::min(size, (block + 1) * k_BlockSize);
+        usize count = 0;
+        for(usize index = block * k_BlockSize; index < end; index++)
+        {
+          count += predicate(index) ? 1 : 0;
+        }
+        blockOffsets[block + 1] = count;
+      }
+    });
+  }
+
+  // Scan: there are few enough blocks to do this serially
+  for(usize block = 0; block < numBlocks; block++)
+  {
+    blockOffsets[block + 1] += blockOffsets[block];
+  }
+
+  // Scatter: every block writes its selected indices starting at its offset
+  std::vector<IndexT> selected(blockOffsets[numBlocks]);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize block = range.min(); block < range.max(); block++)
+      {
+        const usize end = std::min(size, (block + 1) * k_BlockSize);
+        usize position = blockOffsets[block];
+        for(usize index = block * k_BlockSize; index < end; index++)
+        {
+          if(predicate(index))
+          {
+            selected[position++] = static_cast<IndexT>(index);
+          }
+        }
+      }
+    });
+  }
+  return selected;
+}
+} // namespace StreamCompaction
+} // namespace complex
@@ -0,0 +1,104 @@
+#include "TupleCopier.hpp"
+
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/Utilities/FilterUtilities.hpp"
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+#include <tuple>
+
+using namespace complex;
+
+namespace
+{
+struct FindBuffersFunctor
+{
+  /**
+   * @brief Returns the raw buffers of both arrays and the size of one element, or null
+   * buffers if either array is not held in memory.
+   */
+  template <typename T>
+  std::tuple<const uint8*, uint8*, usize> operator()(const IDataArray& source, IDataArray& destination) const
+  {
+    const auto* sourceStore = dynamic_cast<const DataStore<T>*>(dynamic_cast<const DataArray<T>&>(source).getDataStore());
+    auto* destinationStore = dynamic_cast<DataStore<T>*>(dynamic_cast<DataArray<T>&>(destination).getDataStore());
+    if(sourceStore == nullptr || destinationStore == nullptr)
+    {
+      return {nullptr, nullptr, sizeof(T)};
+    }
+    return {reinterpret_cast<const uint8*>(sourceStore->data()), reinterpret_cast<uint8*>(destinationStore->data()), sizeof(T)};
+  }
+};
+
+struct CopyTupleElementsFunctor
+{
+  template <typename T>
+  void operator()(const IDataArray& source, IDataArray& destination, usize sourceTuple, usize destinationTuple) const
+  {
+    const auto& sourceArray = dynamic_cast<const DataArray<T>&>(source);
+    auto& destinationArray = dynamic_cast<DataArray<T>&>(destination);
+    const usize numComponents = sourceArray.getNumberOfComponents();
+    for(usize comp = 0; comp < numComponents; comp++)
+    {
+      destinationArray[destinationTuple * numComponents + comp] = sourceArray[sourceTuple * numComponents + comp];
+    }
+  }
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+void TupleCopier::addArrays(const IDataArray& source, IDataArray& destination)
+{
+  if(source.getDataType() != destination.getDataType())
+  {
+    throw std::runtime_error(fmt::format("TupleCopier cannot copy tuples from '{}' into '{}' because the arrays have different types", source.getName(), destination.getName()));
+  }
+  if(source.getNumberOfComponents() != destination.getNumberOfComponents())
+  {
+    throw std::runtime_error(fmt::format("TupleCopier cannot copy tuples from '{}' ({} components) into '{}' ({} components)", source.getName(), source.getNumberOfComponents(), destination.getName(),
+                                         destination.getNumberOfComponents()));
+  }
+
+  ArrayPair arrays;
+  arrays.source = &source;
+  arrays.destination = &destination;
+  auto [sourceBytes, destinationBytes, elementBytes] = ExecuteDataFunction(FindBuffersFunctor{}, source.getDataType(), source, destination);
+  if(sourceBytes != nullptr && destinationBytes != nullptr)
+  {
+    arrays.sourceBytes = sourceBytes;
+    arrays.destinationBytes = destinationBytes;
+    arrays.tupleBytes = source.getNumberOfComponents() * elementBytes;
+  }
+  m_Arrays.push_back(arrays);
+}
+
+// -----------------------------------------------------------------------------
+usize TupleCopier::getNumberOfArrays() const
+{
+  return m_Arrays.size();
+}
+
+// -----------------------------------------------------------------------------
+void TupleCopier::copyTuples(usize sourceTuple, usize destinationTuple, usize count) const
+{
+  for(const ArrayPair& arrays : m_Arrays)
+  {
+    if(arrays.sourceBytes != nullptr)
+    {
+      std::memmove(arrays.destinationBytes + destinationTuple * arrays.tupleBytes, arrays.sourceBytes + sourceTuple * arrays.tupleBytes, count * arrays.tupleBytes);
+      continue;
+    }
+    for(usize i = 0; i < count; i++)
+    {
+      copyTupleElements(arrays, sourceTuple + i, destinationTuple + i);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+void TupleCopier::copyTupleElements(const ArrayPair& arrays, usize sourceTuple, usize destinationTuple)
+{
+  ExecuteDataFunction(CopyTupleElementsFunctor{}, arrays.source->getDataType(), *arrays.source, *arrays.destination, sourceTuple, destinationTuple);
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "complex/Common/Types.hpp"
+#include "complex/DataStructure/IDataArray.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/complex_export.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace complex
+{
+/**
+ * @class TupleCopier
+ * @brief Copies whole tuples between pairs of arrays through an index array. Any number of
+ * array pairs of any type are copied in a single parallel pass over the index array.
+ *
+ * gather() fills destination tuple i with source tuple indices[i], scatter() copies source
+ * tuple i into destination tuple indices[i] and copy() copies between two index arrays.
+ * copyTuples() copies a run of consecutive tuples, such as a row of an image.
+ * Arrays that are held in memory are copied a tuple at a time with memcpy; other data
+ * stores fall back to element wise copies.
+ */
+class COMPLEX_EXPORT TupleCopier
+{
+public:
+  TupleCopier() = default;
+  ~TupleCopier() noexcept = default;
+
+  TupleCopier(const TupleCopier&) = default;
+  TupleCopier(TupleCopier&&) noexcept = default;
+  TupleCopier& operator=(const TupleCopier&) = default;
+  TupleCopier& operator=(TupleCopier&&) noexcept = default;
+
+  /**
+   * @brief Adds a pair of arrays to copy between. Both arrays must already have their final
+   * number of tuples. Throws a runtime_error if the arrays differ in type or number of components.
+   * @param source
+   * @param destination
+   */
+  void addArrays(const IDataArray& source, IDataArray& destination);
+
+  /**
+   * @brief Returns the number of array pairs.
+   * @return usize
+   */
+  usize getNumberOfArrays() const;
+
+  /**
+   * @brief Copies source tuple sourceIndices[i] into destination tuple destinationTupleOffset + i
+   * for every array pair.
+   * @param sourceIndices
+   * @param destinationTupleOffset
+   */
+  template <typename IndexT>
+  void gather(nonstd::span<const IndexT> sourceIndices, usize destinationTupleOffset = 0) const
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, sourceIndices.size());
+    dataAlg.execute([this, sourceIndices, destinationTupleOffset](const ComplexRange& range) {
+      for(const ArrayPair& arrays : m_Arrays)
+      {
+        for(usize i = range.min(); i < range.max(); i++)
+        {
+          copyTuple(arrays, static_cast<usize>(sourceIndices[i]), destinationTupleOffset + i);
+        }
+      }
+    });
+  }
+
+  /**
+   * @brief Copies source tuple i into destination tuple destinationIndices[i] for every array
+   * pair. Source tuples whose destination index equals skipIndex are not copied. Every
+   * destination tuple may only be written once.
+   * @param destinationIndices
+   * @param skipIndex
+   */
+  template <typename IndexT>
+  void scatter(nonstd::span<const IndexT> destinationIndices, IndexT skipIndex) const
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, destinationIndices.size());
+    dataAlg.execute([this, destinationIndices, skipIndex](const ComplexRange& range) {
+      for(const ArrayPair& arrays : m_Arrays)
+      {
+        for(usize i = range.min(); i < range.max(); i++)
+        {
+          if(destinationIndices[i] != skipIndex)
+          {
+            copyTuple(arrays, i, static_cast<usize>(destinationIndices[i]));
+          }
+        }
+      }
+    });
+  }
+
+  /**
+   * @brief Copies source tuple sourceIndices[i] into destination tuple destinationIndices[i] for
+   * every array pair. Every destination tuple may only be written once. A source and destination
+   * may be the same array as long as no destination tuple is also used as a source tuple.
+   * @param sourceIndices
+   * @param destinationIndices Must be the same size as sourceIndices
+   */
+  template <typename IndexT>
+  void copy(nonstd::span<const IndexT> sourceIndices, nonstd::span<const IndexT> destinationIndices) const
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, std::min(sourceIndices.size(), destinationIndices.size()));
+    dataAlg.execute([this, sourceIndices, destinationIndices](const ComplexRange& range) {
+      for(const ArrayPair& arrays : m_Arrays)
+      {
+        for(usize i = range.min(); i < range.max(); i++)
+        {
+          copyTuple(arrays, static_cast<usize>(sourceIndices[i]), static_cast<usize>(destinationIndices[i]));
+        }
+      }
+    });
+  }
+
+  /**
+   * @brief Copies the consecutive source tuples [sourceTuple, sourceTuple + count) into the
+   * destination tuples starting at destinationTuple for every array pair. Each array held in
+   * memory is copied with a single memmove, so the two runs may overlap. Unlike the other copies
+   * this runs on the calling thread, so algorithms can split their own ranges across threads and
+   * call it per range.
+   * @param sourceTuple
+   * @param destinationTuple
+   * @param count
+   */
+  void copyTuples(usize sourceTuple, usize destinationTuple, usize count) const;
+
+private:
+  struct ArrayPair
+  {
+    const IDataArray* source = nullptr;
+    IDataArray* destination = nullptr;
+    // Raw buffers, only set when both arrays are held in memory
+    const uint8* sourceBytes = nullptr;
+    uint8* destinationBytes = nullptr;
+    usize tupleBytes = 0;
+  };
+
+  /**
+   * @brief Copies a single tuple of an array pair.
+   * @param arrays
+   * @param sourceTuple
+   * @param destinationTuple
+   */
+  static void copyTuple(const ArrayPair& arrays, usize sourceTuple, usize destinationTuple)
+  {
+    if(arrays.sourceBytes != nullptr)
+    {
+      std::memcpy(arrays.destinationBytes + destinationTuple * arrays.tupleBytes, arrays.sourceBytes + sourceTuple * arrays.tupleBytes, arrays.tupleBytes);
+      return;
+    }
+    copyTupleElements(arrays, sourceTuple, destinationTuple);
+  }
+
+  /**
+   * @brief Copies a single tuple of an array pair one element at a time.
+   * @param arrays
+   * @param sourceTuple
+   * @param destinationTuple
+   */
+  static void copyTupleElements(const ArrayPair& arrays, usize sourceTuple, usize destinationTuple);
+
+  std::vector<ArrayPair> m_Arrays;
+};
+} // namespace complex
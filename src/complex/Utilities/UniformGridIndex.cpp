@@ -0,0 +1,232 @@
+#include "UniformGridIndex.hpp"
+
+#include "complex/Utilities/CountingSort.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace complex;
+
+namespace
+{
+// Number of points each task of the bounds reduction works on
+constexpr usize k_BoundsChunkSize = 65536;
+
+// Lattice bins at or beyond this magnitude do not fit in an int64 after the float conversion
+constexpr float32 k_MaxLatticeBin = 4.0e18f;
+
+// Lattice coordinate returned for coordinates that have no lattice bin. No index stores it.
+constexpr int64 k_InvalidLatticeBin = std::numeric_limits<int64>::min();
+
+/**
+ * @brief Returns the lattice bin of a coordinate or k_InvalidLatticeBin if the coordinate is
+ * not finite or too large to bin. The multiplication by the inverse spacing matches the binning
+ * that the point cloud filters have always used.
+ * @param value
+ * @param inverseSpacing
+ * @return int64
+ */
+inline int64 LatticeBin(float32 value, float32 inverseSpacing)
+{
+  const float32 bin = std::floor(value * inverseSpacing);
+  // Also false for NaN
+  if(!(std::abs(bin) < k_MaxLatticeBin))
+  {
+    return k_InvalidLatticeBin;
+  }
+  return static_cast<int64>(bin);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+UniformGridIndex::UniformGridIndex(const Float32Array& coords, const FloatVec3& spacing)
+: m_Spacing(spacing)
+{
+  if(coords.getNumberOfComponents() != 3)
+  {
+    throw std::runtime_error(fmt::format("UniformGridIndex requires a 3 component coordinate array but '{}' has {} components", coords.getName(), coords.getNumberOfComponents()));
+  }
+  for(usize dim = 0; dim < 3; dim++)
+  {
+    if(spacing[dim] <= 0.0f)
+    {
+      throw std::runtime_error(fmt::format("UniformGridIndex spacing must be positive. Spacing: [{}, {}, {}]", spacing[0], spacing[1], spacing[2]));
+    }
+    m_InverseSpacing[dim] = 1.0f / spacing[dim];
+  }
+
+  // Find the range of occupied lattice bins. Each chunk reduces into its own slot
+  // so that no synchronization is needed. Points without a lattice bin are skipped.
+  const usize numPoints = coords.getNumberOfTuples();
+  const usize numChunks = (numPoints + k_BoundsChunkSize - 1) / k_BoundsChunkSize;
+  std::vector<BinCoords> chunkMins(numChunks, BinCoords{std::numeric_limits<int64>::max(), std::numeric_limits<int64>::max(), std::numeric_limits<int64>::max()});
+  std::vector<BinCoords> chunkMaxs(numChunks, BinCoords{std::numeric_limits<int64>::lowest(), std::numeric_limits<int64>::lowest(), std::numeric_limits<int64>::lowest()});
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numChunks);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        const usize end = std::min(numPoints, (chunk + 1) * k_BoundsChunkSize);
+        BinCoords& chunkMin = chunkMins[chunk];
+        BinCoords& chunkMax = chunkMaxs[chunk];
+        for(usize i = chunk * k_BoundsChunkSize; i < end; i++)
+        {
+          const BinCoords bin = computeBinCoords(Point3Df(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]));
+          if(bin[0] == k_InvalidLatticeBin || bin[1] == k_InvalidLatticeBin || bin[2] == k_InvalidLatticeBin)
+          {
+            continue;
+          }
+          for(usize dim = 0; dim < 3; dim++)
+          {
+            chunkMin[dim] = std::min(chunkMin[dim], bin[dim]);
+            chunkMax[dim] = std::max(chunkMax[dim], bin[dim]);
+          }
+        }
+      }
+    });
+  }
+
+  BinCoords maxBin = {std::numeric_limits<int64>::lowest(), std::numeric_limits<int64>::lowest(), std::numeric_limits<int64>::lowest()};
+  m_MinBin = {std::numeric_limits<int64>::max(), std::numeric_limits<int64>::max(), std::numeric_limits<int64>::max()};
+  for(usize chunk = 0; chunk < numChunks; chunk++)
+  {
+    for(usize dim = 0; dim < 3; dim++)
+    {
+      m_MinBin[dim] = std::min(m_MinBin[dim], chunkMins[chunk][dim]);
+      maxBin[dim] = std::max(maxBin[dim], chunkMaxs[chunk][dim]);
+    }
+  }
+
+  if(m_MinBin[0] > maxBin[0])
+  {
+    // There are no points or none of them has a lattice bin
+    m_MinBin = {0, 0, 0};
+    m_BinOffsets = {0, 0};
+    m_Dimensions = SizeVec3(1, 1, 1);
+    return;
+  }
+
+  usize numBins = 1;
+  for(usize dim = 0; dim < 3; dim++)
+  {
+    m_Dimensions[dim] = static_cast<usize>(maxBin[dim] - m_MinBin[dim] + 1);
+    if(m_Dimensions[dim] > std::numeric_limits<usize>::max() / numBins)
+    {
+      throw std::runtime_error(fmt::format("UniformGridIndex spacing [{}, {}, {}] is too small for the extent of '{}'", spacing[0], spacing[1], spacing[2], coords.getName()));
+    }
+    numBins *= m_Dimensions[dim];
+  }
+
+  // Assign every point to its bin in parallel. Points without a bin get a key past the last
+  // bin, which the counting sort skips.
+  std::vector<usize> pointBins(numPoints);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numPoints);
+    dataAlg.execute([&](const ComplexRange& range) {
+      for(usize i = range.min(); i < range.max(); i++)
+      {
+        const std::optional<usize> binIndex = findBinIndex(computeBinCoords(Point3Df(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2])));
+        pointBins[i] = binIndex.value_or(numBins);
+      }
+    });
+  }
+
+  CountingSort::GroupByKey(pointBins, numBins, m_BinOffsets, m_PointIds);
+}
+
+// -----------------------------------------------------------------------------
+const FloatVec3& UniformGridIndex::getSpacing() const
+{
+  return m_Spacing;
+}
+
+// -----------------------------------------------------------------------------
+const SizeVec3& UniformGridIndex::getDimensions() const
+{
+  return m_Dimensions;
+}
+
+// -----------------------------------------------------------------------------
+const UniformGridIndex::BinCoords& UniformGridIndex::getMinBin() const
+{
+  return m_MinBin;
+}
+
+// -----------------------------------------------------------------------------
+usize UniformGridIndex::getNumberOfBins() const
+{
+  return m_BinOffsets.empty() ? 0 : m_BinOffsets.size() - 1;
+}
+
+// -----------------------------------------------------------------------------
+usize UniformGridIndex::getNumberOfPoints() const
+{
+  return m_PointIds.size();
+}
+
+// -----------------------------------------------------------------------------
+bool UniformGridIndex::empty() const
+{
+  return m_PointIds.empty();
+}
+
+// -----------------------------------------------------------------------------
+UniformGridIndex::BinCoords UniformGridIndex::computeBinCoords(const Point3Df& point) const
+{
+  return {LatticeBin(point.getX(), m_InverseSpacing[0]), LatticeBin(point.getY(), m_InverseSpacing[1]), LatticeBin(point.getZ(), m_InverseSpacing[2])};
+}
+
+// -----------------------------------------------------------------------------
+std::optional<usize> UniformGridIndex::findBinIndex(const BinCoords& binCoords) const
+{
+  std::array<usize, 3> local = {0, 0, 0};
+  for(usize dim = 0; dim < 3; dim++)
+  {
+    // Compare before subtracting so that far away bins cannot overflow the offset
+    if(binCoords[dim] < m_MinBin[dim])
+    {
+      return {};
+    }
+    const usize offset = static_cast<usize>(binCoords[dim]) - static_cast<usize>(m_MinBin[dim]);
+    if(offset >= m_Dimensions[dim])
+    {
+      return {};
+    }
+    local[dim] = offset;
+  }
+  return (local[2] * m_Dimensions[1] + local[1]) * m_Dimensions[0] + local[0];
+}
+
+// -----------------------------------------------------------------------------
+nonstd::span<const usize> UniformGridIndex::getPointsInBin(usize binIndex) const
+{
+  if(binIndex >= getNumberOfBins())
+  {
+    return {};
+  }
+  const usize begin = m_BinOffsets[binIndex];
+  const usize end = m_BinOffsets[binIndex + 1];
+  return {m_PointIds.data() + begin, end - begin};
+}
+
+// -----------------------------------------------------------------------------
+nonstd::span<const usize> UniformGridIndex::getPointsInBin(const BinCoords& binCoords) const
+{
+  std::optional<usize> binIndex = findBinIndex(binCoords);
+  if(!binIndex.has_value())
+  {
+    return {};
+  }
+  return getPointsInBin(*binIndex);
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<usize>& UniformGridIndex::getBinOffsets() const
+{
+  return m_BinOffsets;
+}
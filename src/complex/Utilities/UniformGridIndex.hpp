@@ -0,0 +1,136 @@
+#pragma once
+
+#include "complex/Common/Array.hpp"
+#include "complex/Common/Point3D.hpp"
+#include "complex/Common/Types.hpp"
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/complex_export.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace complex
+{
+/**
+ * @class UniformGridIndex
+ * @brief The UniformGridIndex class bins a point set into a regular grid of cells using
+ * a parallel counting sort. The point indices of each bin are stored contiguously (CSR layout)
+ * in ascending order, so looking up the points of a bin is a single offset lookup.
+ *
+ * Bins are aligned to the global lattice defined by the spacing: a point p falls into the
+ * lattice bin floor(p * (1 / spacing)) along each axis. The index only stores the bins
+ * between the smallest and largest occupied lattice bin, so two indices built with the
+ * same spacing always agree on the lattice coordinates of a point. Points with a non-finite
+ * coordinate, or a coordinate whose lattice bin does not fit in an int64, are not indexed.
+ */
+class COMPLEX_EXPORT UniformGridIndex
+{
+public:
+  using BinCoords = std::array<int64, 3>;
+
+  /**
+   * @brief Constructs an empty index.
+   */
+  UniformGridIndex() = default;
+
+  /**
+   * @brief Bins the points of a 3 component coordinate array using the given bin spacing.
+   * Throws a runtime_error if any spacing value is not positive.
+   * @param coords
+   * @param spacing
+   */
+  UniformGridIndex(const Float32Array& coords, const FloatVec3& spacing);
+
+  UniformGridIndex(const UniformGridIndex&) = default;
+  UniformGridIndex(UniformGridIndex&&) noexcept = default;
+  UniformGridIndex& operator=(const UniformGridIndex&) = default;
+  UniformGridIndex& operator=(UniformGridIndex&&) noexcept = default;
+  ~UniformGridIndex() noexcept = default;
+
+  /**
+   * @brief Returns the bin spacing.
+   * @return const FloatVec3&
+   */
+  const FloatVec3& getSpacing() const;
+
+  /**
+   * @brief Returns the number of bins along each axis.
+   * @return const SizeVec3&
+   */
+  const SizeVec3& getDimensions() const;
+
+  /**
+   * @brief Returns the lattice coordinates of the first stored bin.
+   * @return const BinCoords&
+   */
+  const BinCoords& getMinBin() const;
+
+  /**
+   * @brief Returns the total number of stored bins.
+   * @return usize
+   */
+  usize getNumberOfBins() const;
+
+  /**
+   * @brief Returns the number of indexed points. Points that could not be binned are not counted.
+   * @return usize
+   */
+  usize getNumberOfPoints() const;
+
+  /**
+   * @brief Returns true if the index contains no points.
+   * @return bool
+   */
+  bool empty() const;
+
+  /**
+   * @brief Returns the lattice coordinates of the bin containing the point.
+   * The returned bin does not need to lie within the stored bins. Coordinates that cannot be
+   * binned map to std::numeric_limits<int64>::min(), which never lies within the stored bins.
+   * @param point
+   * @return BinCoords
+   */
+  BinCoords computeBinCoords(const Point3Df& point) const;
+
+  /**
+   * @brief Returns the linear bin index for the given lattice coordinates or an
+   * empty optional if the bin lies outside of the stored bins.
+   * @param binCoords
+   * @return std::optional<usize>
+   */
+  std::optional<usize> findBinIndex(const BinCoords& binCoords) const;
+
+  /**
+   * @brief Returns the point indices in the bin at the given linear index.
+   * @param binIndex
+   * @return nonstd::span<const usize>
+   */
+  nonstd::span<const usize> getPointsInBin(usize binIndex) const;
+
+  /**
+   * @brief Returns the point indices in the bin at the given lattice coordinates.
+   * Bins outside of the stored bins are empty.
+   * @param binCoords
+   * @return nonstd::span<const usize>
+   */
+  nonstd::span<const usize> getPointsInBin(const BinCoords& binCoords) const;
+
+  /**
+   * @brief Returns the bin offsets. The points of bin i are stored at positions
+   * [offsets[i], offsets[i + 1]) of the sorted point list.
+   * @return const std::vector<usize>&
+   */
+  const std::vector<usize>& getBinOffsets() const;
+
+private:
+  FloatVec3 m_Spacing = {1.0f, 1.0f, 1.0f};
+  std::array<float32, 3> m_InverseSpacing = {1.0f, 1.0f, 1.0f};
+  BinCoords m_MinBin = {0, 0, 0};
+  SizeVec3 m_Dimensions = {0, 0, 0};
+  std::vector<usize> m_BinOffsets;
+  std::vector<usize> m_PointIds;
+};
+} // namespace complex
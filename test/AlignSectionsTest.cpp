@@ -0,0 +1,140 @@
+#include <catch2/catch.hpp>
+
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/DataStructure/Geometry/ImageGeom.hpp"
+#include "complex/Utilities/AlignSections.hpp"
+
+#include <vector>
+
+using namespace complex;
+
+namespace
+{
+/**
+ * @brief Applies fixed shifts so that every slice moves by a different +/- x and y amount.
+ */
+class FixedShiftAlignSections : public AlignSections
+{
+public:
+  FixedShiftAlignSections(DataStructure& data, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler, std::vector<int64> xShifts, std::vector<int64> yShifts,
+                          std::vector<DataPath> selectedPaths)
+  : AlignSections(data, shouldCancel, mesgHandler)
+  , m_XShifts(std::move(xShifts))
+  , m_YShifts(std::move(yShifts))
+  , m_SelectedPaths(std::move(selectedPaths))
+  {
+  }
+
+protected:
+  void find_shifts(std::vector<int64_t>& xShifts, std::vector<int64_t>& yShifts) override
+  {
+    xShifts = m_XShifts;
+    yShifts = m_YShifts;
+  }
+
+  std::vector<DataPath> getSelectedDataPaths() const override
+  {
+    return m_SelectedPaths;
+  }
+
+private:
+  std::vector<int64> m_XShifts;
+  std::vector<int64> m_YShifts;
+  std::vector<DataPath> m_SelectedPaths;
+};
+
+/**
+ * @brief The per voxel shift that AlignSections used before it moved whole rows.
+ */
+template <typename T>
+void ShiftPerVoxel(std::vector<T>& values, usize numComponents, const SizeVec3& dims, const std::vector<int64>& xShifts, const std::vector<int64>& yShifts)
+{
+  const int64 dimX = static_cast<int64>(dims[0]);
+  const int64 dimY = static_cast<int64>(dims[1]);
+  for(usize i = 1; i < dims[2]; i++)
+  {
+    const usize slice = (dims[2] - 1) - i;
+    for(int64 yIndex = 0; yIndex < dimY; yIndex++)
+    {
+      for(int64 xIndex = 0; xIndex < dimX; xIndex++)
+      {
+        const int64 yspot = yShifts[i] >= 0 ? yIndex : dimY - 1 - yIndex;
+        const int64 xspot = xShifts[i] >= 0 ? xIndex : dimX - 1 - xIndex;
+        const usize newPosition = slice * dims[0] * dims[1] + yspot * dimX + xspot;
+        const int64 sourceY = yspot + yShifts[i];
+        const int64 sourceX = xspot + xShifts[i];
+        const bool inside = sourceY >= 0 && sourceY < dimY && sourceX >= 0 && sourceX < dimX;
+        const usize currentPosition = inside ? slice * dims[0] * dims[1] + sourceY * dimX + sourceX : 0;
+        for(usize comp = 0; comp < numComponents; comp++)
+        {
+          values[newPosition * numComponents + comp] = inside ? values[currentPosition * numComponents + comp] : static_cast<T>(0);
+        }
+      }
+    }
+  }
+}
+
+template <typename T>
+std::vector<T> ToVector(const DataArray<T>& array)
+{
+  return std::vector<T>(array.begin(), array.end());
+}
+} // namespace
+
+TEST_CASE("AlignSectionsTest")
+{
+  DataStructure dataStructure;
+  const SizeVec3 dims = {7, 5, 8};
+  ImageGeom* imageGeom = ImageGeom::Create(dataStructure, "Image Geometry");
+  imageGeom->setDimensions(dims);
+  const usize numCells = imageGeom->getNumberOfElements();
+
+  auto* floatArray = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Floats", {numCells}, {3}, imageGeom->getId());
+  auto* intArray = Int32Array::CreateWithStore<DataStore<int32>>(dataStructure, "Ints", {numCells}, {1}, imageGeom->getId());
+  auto* boolArray = BoolArray::CreateWithStore<DataStore<bool>>(dataStructure, "Bools", {numCells}, {1}, imageGeom->getId());
+  for(usize i = 0; i < numCells; i++)
+  {
+    for(usize comp = 0; comp < 3; comp++)
+    {
+      (*floatArray)[3 * i + comp] = static_cast<float32>(3 * i + comp + 1);
+    }
+    (*intArray)[i] = static_cast<int32>(i) + 1;
+    (*boolArray)[i] = i % 3 != 0;
+  }
+
+  // Slice 0 never moves. The others cover +/- x, +/- y, both at once and shifts past the edge.
+  const std::vector<int64> xShifts = {0, 2, -3, 0, 0, 1, -2, 9};
+  const std::vector<int64> yShifts = {0, 0, 0, 1, -2, -1, 3, 0};
+
+  std::vector<float32> expectedFloats = ToVector(*floatArray);
+  std::vector<int32> expectedInts = ToVector(*intArray);
+  std::vector<bool> expectedBools = ToVector(*boolArray);
+  ShiftPerVoxel(expectedFloats, 3, dims, xShifts, yShifts);
+  ShiftPerVoxel(expectedInts, 1, dims, xShifts, yShifts);
+  ShiftPerVoxel(expectedBools, 1, dims, xShifts, yShifts);
+
+  const std::atomic_bool shouldCancel = false;
+  const IFilter::MessageHandler messageHandler{[](const IFilter::Message&) {}};
+  const DataPath imagePath({"Image Geometry"});
+  FixedShiftAlignSections alignSections(dataStructure, shouldCancel, messageHandler, xShifts, yShifts,
+                                        {imagePath.createChildPath("Floats"), imagePath.createChildPath("Ints"), imagePath.createChildPath("Bools")});
+  REQUIRE(alignSections.execute(dims).valid());
+
+  REQUIRE(ToVector(*floatArray) == expectedFloats);
+  REQUIRE(ToVector(*intArray) == expectedInts);
+  REQUIRE(ToVector(*boolArray) == expectedBools);
+
+  // Shift 1 moves slice 6 by +2 in x: cell (x, y) takes the value of cell (x + 2, y) and the last two columns are zeroed
+  const usize sliceSix = 6 * dims[0] * dims[1];
+  REQUIRE((*intArray)[sliceSix] == static_cast<int32>(sliceSix + 2) + 1);
+  REQUIRE((*intArray)[sliceSix + 5] == 0);
+  REQUIRE((*intArray)[sliceSix + 6] == 0);
+
+  // Shift 7 moves slice 0 past the edge of the slice, which zeroes all of it
+  for(usize i = 0; i < dims[0] * dims[1]; i++)
+  {
+    REQUIRE((*intArray)[i] == 0);
+  }
+}
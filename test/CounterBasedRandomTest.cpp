@@ -0,0 +1,101 @@
+#include <catch2/catch.hpp>
+
+#include "complex/Utilities/CounterBasedRandom.hpp"
+
+#include <algorithm>
+#include <limits>
+
+using namespace complex;
+
+TEST_CASE("CounterBasedRandomTest")
+{
+  SECTION("Philox4x32 known answers")
+  {
+    // Known answer vectors published with the Random123 library
+    {
+      constexpr Philox4x32 generator(Philox4x32::KeyType{0x00000000, 0x00000000});
+      constexpr Philox4x32::ResultType result = generator.generate({0x00000000, 0x00000000, 0x00000000, 0x00000000});
+      constexpr Philox4x32::ResultType expected = {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8};
+      REQUIRE(result == expected);
+    }
+    {
+      constexpr Philox4x32 generator(Philox4x32::KeyType{0xffffffff, 0xffffffff});
+      constexpr Philox4x32::ResultType result = generator.generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff});
+      constexpr Philox4x32::ResultType expected = {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd};
+      REQUIRE(result == expected);
+    }
+    {
+      constexpr Philox4x32 generator(Philox4x32::KeyType{0xa4093822, 0x299f31d0});
+      constexpr Philox4x32::ResultType result = generator.generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344});
+      constexpr Philox4x32::ResultType expected = {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1};
+      REQUIRE(result == expected);
+    }
+  }
+  SECTION("Philox4x32 seed and counter layout")
+  {
+    const Philox4x32 seeded(0x299f31d0a4093822ULL);
+    REQUIRE(seeded.getKey() == Philox4x32::KeyType{0xa4093822, 0x299f31d0});
+
+    const Philox4x32::ResultType fromIndex = seeded(0x85a308d3243f6a88ULL, 0x0370734413198a2eULL);
+    const Philox4x32::ResultType expected = {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1};
+    REQUIRE(fromIndex == expected);
+    REQUIRE(seeded(5, 0) != seeded(5, 1));
+    REQUIRE(seeded(5, 0) != seeded(6, 0));
+  }
+  SECTION("Conversions")
+  {
+    REQUIRE(Philox4x32::ToUnitFloat64(0, 0) == 0.0);
+    REQUIRE(Philox4x32::ToUnitFloat64(0xffffffff, 0xffffffff) < 1.0);
+    REQUIRE(Philox4x32::ToUnitFloat32(0) == 0.0f);
+    REQUIRE(Philox4x32::ToUnitFloat32(0xffffffff) < 1.0f);
+
+    REQUIRE(Philox4x32::ToRange(0, 0, 10) == 0);
+    REQUIRE(Philox4x32::ToRange(0xffffffff, 0xffffffff, 10) == 9);
+    REQUIRE(Philox4x32::ToRange(0x80000000, 0x00000000, 10) == 5);
+    REQUIRE(Philox4x32::ToRange(0xffffffff, 0xffffffff, 0xffffffffffffffffULL) == 0xfffffffffffffffeULL);
+  }
+  SECTION("Uniform values")
+  {
+    const Philox4x32 generator(1234);
+    bool hitMin = false;
+    bool hitMax = false;
+    for(uint64 i = 0; i < 1000; i++)
+    {
+      const int8 value = CounterBasedRandom::UniformValue<int8>(generator(i), -3, 4);
+      REQUIRE(value >= -3);
+      REQUIRE(value <= 4);
+      hitMin = hitMin || value == -3;
+      hitMax = hitMax || value == 4;
+
+      const float32 real = CounterBasedRandom::UniformValue<float32>(generator(i, 1), 1.0f, 25.0f);
+      REQUIRE(real >= 1.0f);
+      REQUIRE(real <= 25.0f);
+    }
+    REQUIRE(hitMin);
+    REQUIRE(hitMax);
+
+    const Philox4x32::ResultType words = {0x01234567, 0x89abcdef, 0, 0};
+    REQUIRE(CounterBasedRandom::UniformValue<uint64>(words, 0, std::numeric_limits<uint64>::max()) == 0x0123456789abcdefULL);
+    REQUIRE(CounterBasedRandom::UniformValue<int64>(words, std::numeric_limits<int64>::lowest(), std::numeric_limits<int64>::max()) ==
+            static_cast<int64>(0x0123456789abcdefULL + 0x8000000000000000ULL));
+    REQUIRE(CounterBasedRandom::UniformValue<int32>(words, 7, 7) == 7);
+  }
+  SECTION("Random permutation")
+  {
+    // Large enough to be sorted in several runs that are merged afterwards
+    constexpr usize k_Size = 50000;
+    const Philox4x32 generator(42);
+    const std::vector<usize> permutation = CounterBasedRandom::RandomPermutation(generator, k_Size);
+    REQUIRE(permutation.size() == k_Size);
+    REQUIRE(permutation == CounterBasedRandom::RandomPermutation(generator, k_Size));
+    REQUIRE(permutation != CounterBasedRandom::RandomPermutation(generator, k_Size, 1));
+
+    std::vector<usize> sorted = permutation;
+    std::sort(sorted.begin(), sorted.end());
+    for(usize i = 0; i < k_Size; i++)
+    {
+      REQUIRE(sorted[i] == i);
+    }
+    REQUIRE(CounterBasedRandom::RandomPermutation(generator, 0).empty());
+  }
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch.hpp>
+
+#include "complex/Common/Types.hpp"
+#include "complex/Utilities/CountingSort.hpp"
+
+#include <vector>
+
+using namespace complex;
+
+TEST_CASE("CountingSortTest")
+{
+  SECTION("Matches a serial counting sort")
+  {
+    // Enough elements for several blocks with a partial last block
+    const usize size = 5 * 16384 + 123;
+    const usize numKeys = 997;
+    std::vector<usize> keys(size);
+    for(usize index = 0; index < size; index++)
+    {
+      // Every 13th element is skipped
+      keys[index] = index % 13 == 0 ? numKeys : (index * 2654435761u) % numKeys;
+    }
+
+    std::vector<usize> expectedOffsets(numKeys + 1, 0);
+    std::vector<std::vector<usize>> expectedGroups(numKeys);
+    for(usize index = 0; index < size; index++)
+    {
+      if(keys[index] < numKeys)
+      {
+        expectedGroups[keys[index]].push_back(index);
+      }
+    }
+    std::vector<usize> expectedIndices;
+    for(usize key = 0; key < numKeys; key++)
+    {
+      expectedIndices.insert(expectedIndices.end(), expectedGroups[key].begin(), expectedGroups[key].end());
+      expectedOffsets[key + 1] = expectedIndices.size();
+    }
+
+    std::vector<usize> offsets;
+    std::vector<usize> indices;
+    CountingSort::GroupByKey(keys, numKeys, offsets, indices);
+    REQUIRE(offsets == expectedOffsets);
+    REQUIRE(indices == expectedIndices);
+  }
+
+  SECTION("Empty input and empty keys")
+  {
+    std::vector<usize> offsets;
+    std::vector<usize> indices;
+    CountingSort::GroupByKey({}, 4, offsets, indices);
+    REQUIRE(offsets == std::vector<usize>(5, 0));
+    REQUIRE(indices.empty());
+
+    const std::vector<usize> keys = {3, 3, 0};
+    CountingSort::GroupByKey(keys, 5, offsets, indices);
+    REQUIRE(offsets == std::vector<usize>{0, 1, 1, 1, 3, 3});
+    REQUIRE(indices == std::vector<usize>{2, 0, 1});
+  }
+
+  SECTION("Histograms stay bounded for many keys")
+  {
+    REQUIRE(CountingSort::ComputeNumberOfBlocks(0, 10) == 1);
+    REQUIRE(CountingSort::ComputeNumberOfBlocks(1000, usize(1) << 40) == 1);
+  }
+}
@@ -13,6 +13,7 @@
 #include "complex/DataStructure/DataGroup.hpp"
 #include "complex/DataStructure/DataStore.hpp"
 #include "complex/DataStructure/DataStructure.hpp"
+#include "complex/Filter/Actions/ImportH5ObjectPathsAction.hpp"
 #include "complex/Filter/Arguments.hpp"
 #include "complex/Filter/FilterHandle.hpp"
 #include "complex/Parameters/Dream3dImportParameter.hpp"
@@ -39,6 +40,7 @@ const fs::path k_ExportFilename2 = "export2.dream3d";
 const fs::path k_MultiExportFilename1 = "multi_export1.dream3d";
 const fs::path k_MultiExportFilename2 = "multi_export2.dream3d";
 const fs::path k_MultiExportFilename3 = "multi_export3.dream3d";
+const fs::path k_SelectedImportFilename = "selected_import.dream3d";
 } // namespace Constants
 
 std::mutex m_DataMutex;
@@ -130,6 +132,17 @@ fs::path GetReMultiExportDataPath()
   return GetDataDir(*app) / Constants::k_MultiExportFilename3;
 }
 
+fs::path GetSelectedImportDataPath()
+{
+  auto app = Application::Instance();
+  if(app == nullptr)
+  {
+    throw std::runtime_error("complex::Application instance not found");
+  }
+
+  return GetDataDir(*app) / Constants::k_SelectedImportFilename;
+}
+
 DataStructure CreateTestDataStructure()
 {
   DataStructure dataStructure;
@@ -345,3 +358,63 @@ TEST_CASE("Import/Export Multi-DREAM3D Filter Test")
   REQUIRE(importDataStructure.getData(DataPath({DataNames::k_Group1Name})) != nullptr);
   REQUIRE(importDataStructure.getData(DataPath({DataNames::k_Group2Name})) != nullptr);
 }
+
+TEST_CASE("Import Selected DataPaths Test")
+{
+  Application app;
+
+  std::lock_guard<std::mutex> lock(m_DataMutex);
+
+  const fs::path filePath = GetSelectedImportDataPath();
+  if(!fs::exists(filePath.parent_path()))
+  {
+    REQUIRE(fs::create_directories(filePath.parent_path()));
+  }
+
+  const DataPath group1Path({DataNames::k_Group1Name});
+  const DataPath arrayPath = group1Path.createChildPath(DataNames::k_ArrayName);
+
+  // Write .dream3d file
+  {
+    DataStructure dataStructure = CreateTestDataStructure();
+    auto* array = Int32Array::CreateWithStore<DataStore<int32>>(dataStructure, DataNames::k_ArrayName, {3}, {1}, dataStructure.getId(group1Path));
+    REQUIRE(array != nullptr);
+    for(usize i = 0; i < 3; i++)
+    {
+      (*array)[i] = static_cast<int32>(i + 5);
+    }
+
+    Result<H5::FileWriter> result = H5::FileWriter::CreateFile(filePath);
+    REQUIRE(result.valid());
+    auto errorCode = DREAM3D::WriteFile(result.value(), Pipeline(), dataStructure);
+    REQUIRE(errorCode >= 0);
+  }
+
+  // Only the selected objects end up in the existing DataStructure
+  DataStructure dataStructure;
+  DataGroup::Create(dataStructure, "Existing");
+
+  ImportH5ObjectPathsAction action(filePath, std::vector<DataPath>{arrayPath, group1Path});
+  auto result = action.apply(dataStructure, IDataAction::Mode::Execute);
+  REQUIRE(result.valid());
+
+  REQUIRE(dataStructure.getData(DataPath({"Existing"})) != nullptr);
+  REQUIRE(dataStructure.getData(group1Path) != nullptr);
+  REQUIRE(dataStructure.getData(group1Path.createChildPath(DataNames::k_Group2Name)) == nullptr);
+
+  auto* array = dataStructure.getDataAs<Int32Array>(arrayPath);
+  REQUIRE(array != nullptr);
+  REQUIRE(array->getDataStructure() == &dataStructure);
+  REQUIRE(array->getNumberOfTuples() == 3);
+  for(usize i = 0; i < 3; i++)
+  {
+    REQUIRE((*array)[i] == static_cast<int32>(i + 5));
+  }
+
+  // Without a selection everything is imported
+  DataStructure fullDataStructure;
+  ImportH5ObjectPathsAction fullAction(filePath, std::nullopt);
+  REQUIRE(fullAction.apply(fullDataStructure, IDataAction::Mode::Execute).valid());
+  REQUIRE(fullDataStructure.getData(DataPath({DataNames::k_Group1Name, DataNames::k_Group2Name, DataNames::k_Group3Name})) != nullptr);
+  REQUIRE(fullDataStructure.getDataAs<Int32Array>(arrayPath) != nullptr);
+}
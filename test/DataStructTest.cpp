@@ -1,4 +1,5 @@
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include <catch2/catch.hpp>
@@ -148,6 +149,41 @@ TEST_CASE("DataPathTest")
   REQUIRE(empty2.value().empty());
 }
 
+TEST_CASE("DataPathComparisonTest")
+{
+  const DataPath path1({"Foo", "Bar"});
+  const DataPath path2 = DataPath({"Foo"}).createChildPath("Bar");
+  REQUIRE(path1 == path2);
+  REQUIRE(std::hash<DataPath>{}(path1) == std::hash<DataPath>{}(path2));
+  REQUIRE(&path1[1] == &path2[1]);
+  REQUIRE(path1.getParent() == DataPath({"Foo"}));
+  REQUIRE(path1 != DataPath({"Bar", "Foo"}));
+  REQUIRE(DataPath() == DataPath(std::vector<std::string>{}));
+
+  DataPath renamed = path1;
+  REQUIRE(renamed.attemptRename(DataPath({"Foo"}), DataPath({"Baz"})));
+  REQUIRE(renamed == DataPath({"Baz", "Bar"}));
+  REQUIRE(path1.replace("Foo", "Baz") == renamed);
+
+  // Ordering matches the ordering of the joined strings
+  const std::vector<DataPath> paths = {DataPath({"a"}), DataPath({"a", "b"}), DataPath({"a-c"}), DataPath({"a-c", "b"}), DataPath({"ab"}),
+                                       DataPath({"a", "c"}), DataPath({"b"}), DataPath({"a", "b", "c"}), DataPath({"a", "b0"}), DataPath({"a0"})};
+  for(const auto& lhs : paths)
+  {
+    for(const auto& rhs : paths)
+    {
+      REQUIRE((lhs < rhs) == (lhs.toString() < rhs.toString()));
+      REQUIRE((lhs > rhs) == (lhs.toString() > rhs.toString()));
+    }
+  }
+
+  std::unordered_map<DataPath, int32> pathMap;
+  pathMap[path1] = 1;
+  pathMap[renamed] = 2;
+  REQUIRE(pathMap.at(path2) == 1);
+  REQUIRE(pathMap.at(DataPath({"Baz", "Bar"})) == 2);
+}
+
 TEST_CASE("LinkedPathTest")
 {
   DataStructure dataStr;
@@ -200,6 +236,9 @@ TEST_CASE("DataStructureListenerTest")
   REQUIRE(dataStr.setAdditionalParent(grandchildId, child2Id));
   REQUIRE(dsListener.getDataReparentedCount() == 1);
 
+  REQUIRE(child2->rename("Bar2.1"));
+  REQUIRE(dsListener.getDataRenamedCount() == 1);
+
   dataStr.removeData(child2Id);
   REQUIRE(dsListener.getDataRemovedCount() == 1);
   dataStr.removeData(groupId);
@@ -394,3 +433,37 @@ TEST_CASE("DataStructureAddingObjectToNonBaseGroup")
   DataGroup* group = DataGroup::Create(dataStructure, "bar", dataArray->getId());
   REQUIRE(group == nullptr);
 }
+
+TEST_CASE("DataStructureNameLookup")
+{
+  DataStructure dataStr;
+  auto group = DataGroup::Create(dataStr, "Foo");
+  auto child1 = DataGroup::Create(dataStr, "Bar1", group->getId());
+  auto child2 = DataGroup::Create(dataStr, "Bar2", group->getId());
+
+  const DataPath child1Path({"Foo", "Bar1"});
+  const DataPath renamedPath({"Foo", "Bar3"});
+  REQUIRE(dataStr.getData(child1Path) == child1);
+  REQUIRE(dataStr.getData(renamedPath) == nullptr);
+
+  // Renaming updates the parent's name lookup and any previously resolved paths
+  REQUIRE(child1->rename("Bar3"));
+  REQUIRE(group->contains("Bar3"));
+  REQUIRE(!group->contains("Bar1"));
+  REQUIRE(dataStr.getData(child1Path) == nullptr);
+  REQUIRE(dataStr.getData(renamedPath) == child1);
+  REQUIRE(!child2->rename("Bar3"));
+
+  // A new object can take over a path that resolved to a removed one
+  REQUIRE(dataStr.getData(DataPath({"Foo", "Bar2"})) == child2);
+  REQUIRE(dataStr.removeData(child2->getId()));
+  REQUIRE(dataStr.getData(DataPath({"Foo", "Bar2"})) == nullptr);
+  auto newChild2 = DataGroup::Create(dataStr, "Bar2", group->getId());
+  REQUIRE(newChild2 != nullptr);
+  REQUIRE(dataStr.getData(DataPath({"Foo", "Bar2"})) == newChild2);
+
+  // Top level objects can be renamed as well
+  REQUIRE(group->rename("Foo2"));
+  REQUIRE(dataStr.getData(DataPath({"Foo", "Bar3"})) == nullptr);
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar3"})) == child1);
+}
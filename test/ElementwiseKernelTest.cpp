@@ -0,0 +1,59 @@
+#include <catch2/catch.hpp>
+
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/Utilities/ElementwiseKernel.hpp"
+
+#include <stdexcept>
+
+using namespace complex;
+
+TEST_CASE("ElementwiseKernelTest")
+{
+  constexpr usize k_NumTuples = 10007;
+  DataStructure dataStructure;
+  auto* first = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "First", std::vector<usize>{k_NumTuples}, std::vector<usize>{3});
+  auto* second = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Second", std::vector<usize>{k_NumTuples}, std::vector<usize>{3});
+  for(usize i = 0; i < first->getSize(); i++)
+  {
+    (*first)[i] = static_cast<float32>(i) * 0.5f;
+    (*second)[i] = static_cast<float32>(i % 17);
+  }
+
+  SECTION("Unary in place")
+  {
+    ElementwiseKernel::Transform(*first, [](float32 value) { return value * 4.0f; });
+    for(usize i = 0; i < first->getSize(); i++)
+    {
+      REQUIRE((*first)[i] == static_cast<float32>(i) * 2.0f);
+    }
+  }
+
+  SECTION("Binary")
+  {
+    auto* output = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Output", std::vector<usize>{k_NumTuples}, std::vector<usize>{3});
+    ElementwiseKernel::Transform(*first, *second, *output, [](float32 lhs, float32 rhs) { return lhs - rhs; });
+    for(usize i = 0; i < output->getSize(); i++)
+    {
+      REQUIRE((*output)[i] == (*first)[i] - (*second)[i]);
+    }
+  }
+
+  SECTION("Binary into an input of another type")
+  {
+    auto* counts = Int32Array::CreateWithStore<DataStore<int32>>(dataStructure, "Counts", std::vector<usize>{k_NumTuples}, std::vector<usize>{3});
+    counts->fill(2);
+    ElementwiseKernel::Transform(*second, *counts, *counts, [](float32 value, int32 count) { return static_cast<int32>(value) * count; });
+    for(usize i = 0; i < counts->getSize(); i++)
+    {
+      REQUIRE((*counts)[i] == static_cast<int32>(i % 17) * 2);
+    }
+  }
+
+  SECTION("Mismatched sizes")
+  {
+    auto* output = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Output", std::vector<usize>{k_NumTuples}, std::vector<usize>{1});
+    REQUIRE_THROWS_AS(ElementwiseKernel::Transform(*first, *second, *output, [](float32 lhs, float32 rhs) { return lhs - rhs; }), std::runtime_error);
+  }
+}
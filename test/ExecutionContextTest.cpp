@@ -0,0 +1,86 @@
+#include <catch2/catch.hpp>
+
+#include "complex/Utilities/ExecutionContext.hpp"
+#include "complex/Utilities/ParallelDataAlgorithm.hpp"
+#include "complex/Utilities/ParallelTaskAlgorithm.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace complex;
+
+namespace
+{
+/**
+ * @brief Records the threads that run a part of the range.
+ */
+class ThreadRecorder
+{
+public:
+  ThreadRecorder(std::mutex& mutex, std::set<std::thread::id>& threadIds)
+  : m_Mutex(mutex)
+  , m_ThreadIds(threadIds)
+  {
+  }
+
+  void operator()(const ComplexRange& range) const
+  {
+    // Give the other threads time to pick up work
+    std::this_thread::sleep_for(std::chrono::microseconds(10 * (range.max() - range.min())));
+    std::lock_guard lock(m_Mutex);
+    m_ThreadIds.insert(std::this_thread::get_id());
+  }
+
+private:
+  std::mutex& m_Mutex;
+  std::set<std::thread::id>& m_ThreadIds;
+};
+
+usize CountThreads()
+{
+  std::mutex mutex;
+  std::set<std::thread::id> threadIds;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, 10000);
+  dataAlg.execute(ThreadRecorder(mutex, threadIds));
+  return threadIds.size();
+}
+} // namespace
+
+TEST_CASE("ExecutionContextTest")
+{
+  ExecutionContext& context = ExecutionContext::Global();
+  REQUIRE(context.getThreadCount() == 0);
+  REQUIRE(context.getFilterThreadLimit() == 0);
+  REQUIRE(context.getNumaNode() == -1);
+  REQUIRE_FALSE(ExecutionContext::GetNumaNodes().empty());
+
+  context.setThreadCount(2);
+#ifdef COMPLEX_ENABLE_MULTICORE
+  REQUIRE(context.getMaxConcurrency() == 2);
+#else
+  // Without parallel algorithms all work runs on the calling thread
+  REQUIRE(context.getMaxConcurrency() == 1);
+#endif
+  REQUIRE(CountThreads() <= 2);
+  ParallelTaskAlgorithm taskAlg;
+  taskAlg.setMaxThreads(16);
+  REQUIRE(taskAlg.getMaxThreads() <= 2);
+
+  // Each filter gets an arena of its own limited size
+  context.setFilterThreadLimit(1);
+  usize filterConcurrency = 0;
+  usize filterThreads = 0;
+  context.executeFilter([&]() {
+    filterConcurrency = context.getMaxConcurrency();
+    filterThreads = CountThreads();
+  });
+  REQUIRE(filterConcurrency == 1);
+  REQUIRE(filterThreads == 1);
+
+  context.setFilterThreadLimit(0);
+  context.setThreadCount(0);
+  REQUIRE(context.getMaxConcurrency() >= 1);
+}
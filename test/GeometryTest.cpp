@@ -10,6 +10,8 @@
 #include "complex/DataStructure/Geometry/TetrahedralGeom.hpp"
 #include "complex/DataStructure/Geometry/TriangleGeom.hpp"
 #include "complex/DataStructure/Geometry/VertexGeom.hpp"
+#include "complex/Utilities/KdTreeIndex.hpp"
+#include "complex/Utilities/UniformGridIndex.hpp"
 
 #include "GeometryTestUtilities.hpp"
 
@@ -272,4 +274,94 @@ TEST_CASE("VertexGeomTest")
   {
     REQUIRE(geom->getGeometryTypeAsString() == "VertexGeom");
   }
+  SECTION("spatial indices")
+  {
+    geom->setVertices(createVertexList(geom));
+    const usize numVertices = 500;
+    geom->resizeVertexList(numVertices);
+    auto* vertices = geom->getVertices();
+    for(usize i = 0; i < numVertices; i++)
+    {
+      (*vertices)[3 * i + 0] = static_cast<float32>((i * 37) % 101) * 0.1f;
+      (*vertices)[3 * i + 1] = static_cast<float32>((i * 53) % 89) * 0.1f - 2.0f;
+      (*vertices)[3 * i + 2] = static_cast<float32>((i * 71) % 97) * 0.1f;
+    }
+
+    REQUIRE(geom->findKdTree() > 0);
+    const KdTreeIndex* kdTree = geom->getKdTree();
+    REQUIRE(kdTree != nullptr);
+    REQUIRE(kdTree->getNumberOfPoints() == numVertices);
+
+    const std::vector<Point3Df> targets = {Point3Df(0.0f, 0.0f, 0.0f), Point3Df(5.05f, 1.3f, 4.2f), Point3Df(-3.0f, 9.0f, 12.0f)};
+    for(const Point3Df& target : targets)
+    {
+      usize expected = 0;
+      float32 expectedDistance = std::numeric_limits<float32>::max();
+      for(usize i = 0; i < numVertices; i++)
+      {
+        const float32 dx = (*vertices)[3 * i + 0] - target.getX();
+        const float32 dy = (*vertices)[3 * i + 1] - target.getY();
+        const float32 dz = (*vertices)[3 * i + 2] - target.getZ();
+        const float32 distance = dx * dx + dy * dy + dz * dz;
+        if(distance < expectedDistance)
+        {
+          expectedDistance = distance;
+          expected = i;
+        }
+      }
+      std::optional<usize> nearest = kdTree->findNearest(target);
+      REQUIRE(nearest.has_value());
+      REQUIRE(*nearest == expected);
+
+      std::vector<usize> inRadius;
+      kdTree->findInRadius(target, 1.5f, inRadius);
+      usize expectedCount = 0;
+      for(usize i = 0; i < numVertices; i++)
+      {
+        const float32 dx = (*vertices)[3 * i + 0] - target.getX();
+        const float32 dy = (*vertices)[3 * i + 1] - target.getY();
+        const float32 dz = (*vertices)[3 * i + 2] - target.getZ();
+        if(dx * dx + dy * dy + dz * dz <= 1.5f * 1.5f)
+        {
+          expectedCount++;
+        }
+      }
+      REQUIRE(inRadius.size() == expectedCount);
+    }
+
+    const FloatVec3 spacing(1.0f, 0.5f, 2.0f);
+    REQUIRE(geom->findVertexBins(spacing) > 0);
+    const UniformGridIndex* bins = geom->getVertexBins();
+    REQUIRE(bins != nullptr);
+    REQUIRE(bins->getNumberOfPoints() == numVertices);
+    for(usize i = 0; i < numVertices; i++)
+    {
+      const Point3Df point((*vertices)[3 * i + 0], (*vertices)[3 * i + 1], (*vertices)[3 * i + 2]);
+      nonstd::span<const usize> binPoints = bins->getPointsInBin(bins->computeBinCoords(point));
+      REQUIRE(std::find(binPoints.begin(), binPoints.end(), i) != binPoints.end());
+    }
+
+    // setCoords releases the cached indices so the next find sees the new coordinates
+    const Point3Df moved(100.0f, 100.0f, 100.0f);
+    geom->setCoords(0, moved);
+    REQUIRE(geom->getKdTree() == nullptr);
+    REQUIRE(geom->getVertexBins() == nullptr);
+    REQUIRE(geom->findKdTree() > 0);
+    REQUIRE(geom->getKdTree()->findNearest(moved) == std::optional<usize>(0));
+    REQUIRE(geom->findVertexBins(spacing) > 0);
+    nonstd::span<const usize> movedBin = geom->getVertexBins()->getPointsInBin(geom->getVertexBins()->computeBinCoords(moved));
+    REQUIRE(std::find(movedBin.begin(), movedBin.end(), 0) != movedBin.end());
+
+    // Points that cannot be binned are left out of the vertex bins
+    const Point3Df notANumber(std::numeric_limits<float32>::quiet_NaN(), 1.0f, 1.0f);
+    geom->setCoords(1, notANumber);
+    geom->setCoords(2, Point3Df(1.0f, std::numeric_limits<float32>::infinity(), 1.0f));
+    REQUIRE(geom->findVertexBins(spacing) > 0);
+    REQUIRE(geom->getVertexBins()->getNumberOfPoints() == numVertices - 2);
+    REQUIRE(geom->getVertexBins()->getPointsInBin(geom->getVertexBins()->computeBinCoords(notANumber)).empty());
+
+    geom->resizeVertexList(numVertices / 2);
+    REQUIRE(geom->getKdTree() == nullptr);
+    REQUIRE(geom->getVertexBins() == nullptr);
+  }
 }
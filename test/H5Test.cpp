@@ -17,6 +17,7 @@
 #include "complex/Utilities/DataArrayUtilities.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5FileReader.hpp"
 #include "complex/Utilities/Parsing/HDF5/H5FileWriter.hpp"
+#include "complex/Utilities/Parsing/HDF5/H5IOEngine.hpp"
 #include "complex/Utilities/Parsing/Text/CsvParser.hpp"
 
 #include "GeometryTestUtilities.hpp"
@@ -26,6 +27,7 @@
 
 #include <catch2/catch.hpp>
 
+#include <atomic>
 #include <iostream>
 #include <string>
 #include <type_traits>
@@ -750,3 +752,55 @@ TEST_CASE("DataArray<bool> IO")
     FAIL(e.what());
   }
 }
+
+TEST_CASE("IOEngine")
+{
+  constexpr usize k_NumJobs = 64;
+
+  SECTION("Transfers run in submission order")
+  {
+    H5::IOEngine ioEngine(3);
+    std::vector<usize> transferOrder;
+    std::vector<int32> prepared(k_NumJobs, 0);
+    std::vector<int32> finished(k_NumJobs, 0);
+    for(usize i = 0; i < k_NumJobs; i++)
+    {
+      H5::IOEngine::Job job;
+      job.prepare = [&prepared, i]() { prepared[i]++; };
+      job.transfer = [&transferOrder, &prepared, i]() -> H5::ErrorType {
+        transferOrder.push_back(i);
+        return prepared[i] == 1 ? 0 : -1;
+      };
+      job.finish = [&finished, i]() { finished[i]++; };
+      ioEngine.submit(std::move(job));
+    }
+    REQUIRE(ioEngine.getNumberOfJobs() == k_NumJobs);
+    REQUIRE(ioEngine.run() == 0);
+    REQUIRE(ioEngine.getNumberOfJobs() == 0);
+
+    REQUIRE(transferOrder.size() == k_NumJobs);
+    for(usize i = 0; i < k_NumJobs; i++)
+    {
+      REQUIRE(transferOrder[i] == i);
+      REQUIRE(prepared[i] == 1);
+      REQUIRE(finished[i] == 1);
+    }
+  }
+
+  SECTION("Transfers stop at the first error")
+  {
+    H5::IOEngine ioEngine;
+    std::atomic<usize> numTransfers = 0;
+    for(usize i = 0; i < k_NumJobs; i++)
+    {
+      H5::IOEngine::Job job;
+      job.transfer = [&numTransfers, i]() -> H5::ErrorType {
+        numTransfers++;
+        return i == 10 ? -5 : 0;
+      };
+      ioEngine.submit(std::move(job));
+    }
+    REQUIRE(ioEngine.run() == -5);
+    REQUIRE(numTransfers == 11);
+  }
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch.hpp>
+
+#include "complex/Utilities/MemoryBudget.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace complex;
+
+TEST_CASE("MemoryBudgetTest")
+{
+  SECTION("No budget never blocks")
+  {
+    MemoryBudget budget(0);
+    budget.acquire(1000);
+    budget.acquire(1000);
+    REQUIRE(budget.getUsed() == 0);
+    budget.release(1000);
+    budget.release(1000);
+  }
+
+  SECTION("Requests that fit are granted right away")
+  {
+    MemoryBudget budget(100);
+    budget.acquire(40);
+    budget.acquire(60);
+    REQUIRE(budget.getUsed() == 100);
+    budget.release(40);
+    budget.release(60);
+    REQUIRE(budget.getUsed() == 0);
+  }
+
+  SECTION("A request over the whole budget is granted when nothing is held")
+  {
+    MemoryBudget budget(100);
+    budget.acquire(250);
+    REQUIRE(budget.getUsed() == 250);
+    budget.release(250);
+    REQUIRE(budget.getUsed() == 0);
+  }
+
+  SECTION("A request waits until enough bytes are released")
+  {
+    MemoryBudget budget(100);
+    budget.acquire(70);
+
+    std::atomic_bool granted = false;
+    std::thread waiter([&budget, &granted]() {
+      budget.acquire(50);
+      granted = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE_FALSE(granted);
+    budget.release(70);
+    waiter.join();
+    REQUIRE(granted);
+    REQUIRE(budget.getUsed() == 50);
+    budget.release(50);
+  }
+}
@@ -0,0 +1,130 @@
+#include <catch2/catch.hpp>
+
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/Utilities/NeighborFill.hpp"
+
+#include <array>
+
+using namespace complex;
+
+namespace
+{
+/**
+ * @brief Serial reference that rescans the whole volume every pass.
+ */
+void FillBadCellsSerial(std::vector<int32>& featureIds, std::vector<float32>& values, const SizeVec3& dims, usize numFeatures)
+{
+  const int64 dimX = static_cast<int64>(dims[0]);
+  const int64 dimY = static_cast<int64>(dims[1]);
+  const int64 dimZ = static_cast<int64>(dims[2]);
+  const std::array<int64, 6> offsets = {-dimX * dimY, -dimX, -1, 1, dimX, dimX * dimY};
+  std::vector<int64> neighbors(featureIds.size(), -1);
+  std::vector<int32> n(numFeatures, 0);
+  usize counter = 1;
+  while(counter != 0)
+  {
+    counter = 0;
+    for(int64 k = 0; k < dimZ; k++)
+    {
+      for(int64 j = 0; j < dimY; j++)
+      {
+        for(int64 i = 0; i < dimX; i++)
+        {
+          const int64 cell = (k * dimY + j) * dimX + i;
+          if(featureIds[cell] >= 0)
+          {
+            continue;
+          }
+          const std::array<bool, 6> isInside = {k > 0, j > 0, i > 0, i < dimX - 1, j < dimY - 1, k < dimZ - 1};
+          int32 most = 0;
+          for(usize l = 0; l < 6; l++)
+          {
+            if(isInside[l] && featureIds[cell + offsets[l]] >= 0)
+            {
+              const int32 current = ++n[featureIds[cell + offsets[l]]];
+              if(current > most)
+              {
+                most = current;
+                neighbors[cell] = cell + offsets[l];
+              }
+            }
+          }
+          for(usize l = 0; l < 6; l++)
+          {
+            if(isInside[l] && featureIds[cell + offsets[l]] >= 0)
+            {
+              n[featureIds[cell + offsets[l]]] = 0;
+            }
+          }
+          counter += most > 0 ? 1 : 0;
+        }
+      }
+    }
+    for(usize cell = 0; cell < featureIds.size(); cell++)
+    {
+      const int64 neighbor = neighbors[cell];
+      if(featureIds[cell] < 0 && neighbor >= 0 && featureIds[neighbor] >= 0)
+      {
+        featureIds[cell] = featureIds[neighbor];
+        values[2 * cell] = values[2 * neighbor];
+        values[2 * cell + 1] = values[2 * neighbor + 1];
+      }
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("NeighborFillTest")
+{
+  constexpr usize k_NumFeatures = 7;
+  const SizeVec3 dims = {23, 17, 11};
+  const usize numCells = dims[0] * dims[1] * dims[2];
+
+  DataStructure dataStructure;
+  auto* featureIds = Int32Array::CreateWithStore<DataStore<int32>>(dataStructure, "FeatureIds", std::vector<usize>{numCells}, std::vector<usize>{1});
+  auto* values = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Values", std::vector<usize>{numCells}, std::vector<usize>{2});
+  REQUIRE(featureIds != nullptr);
+  REQUIRE(values != nullptr);
+
+  // Scattered unassigned cells plus a solid block that takes several passes to fill
+  uint32 state = 4321;
+  for(usize cell = 0; cell < numCells; cell++)
+  {
+    state = state * 1664525u + 1013904223u;
+    const usize x = cell % dims[0];
+    const usize y = (cell / dims[0]) % dims[1];
+    const bool inBlock = x > 3 && x < 15 && y > 2 && y < 12;
+    (*featureIds)[cell] = (inBlock || (state >> 28) < 6) ? -1 : static_cast<int32>((state >> 8) % k_NumFeatures);
+    (*values)[2 * cell] = static_cast<float32>(cell);
+    (*values)[2 * cell + 1] = static_cast<float32>(state % 1000);
+  }
+
+  SECTION("Matches a full rescan")
+  {
+    std::vector<int32> expectedIds(featureIds->begin(), featureIds->end());
+    std::vector<float32> expectedValues(values->begin(), values->end());
+    FillBadCellsSerial(expectedIds, expectedValues, dims, k_NumFeatures);
+
+    usize numUnassigned = 0;
+    for(usize cell = 0; cell < numCells; cell++)
+    {
+      numUnassigned += (*featureIds)[cell] < 0 ? 1 : 0;
+    }
+    REQUIRE(NeighborFill::FillBadCells(*featureIds, dims, {featureIds, values}) == numUnassigned);
+    for(usize cell = 0; cell < numCells; cell++)
+    {
+      REQUIRE((*featureIds)[cell] == expectedIds[cell]);
+      REQUIRE((*values)[2 * cell] == expectedValues[2 * cell]);
+      REQUIRE((*values)[2 * cell + 1] == expectedValues[2 * cell + 1]);
+    }
+  }
+
+  SECTION("Nothing to fill from")
+  {
+    featureIds->fill(-1);
+    REQUIRE(NeighborFill::FillBadCells(*featureIds, dims, {values}) == 0);
+    REQUIRE((*values)[2] == 1.0f);
+  }
+}
@@ -5,16 +5,24 @@
 #include "complex/Filter/Actions/DeleteDataAction.hpp"
 #include "complex/Filter/Arguments.hpp"
 #include "complex/Filter/FilterHandle.hpp"
+#include "complex/Parameters/ArrayCreationParameter.hpp"
+#include "complex/Parameters/BoolParameter.hpp"
 #include "complex/Parameters/ChoicesParameter.hpp"
+#include "complex/Parameters/Dream3dImportParameter.hpp"
+#include "complex/Parameters/FileSystemPathParameter.hpp"
 #include "complex/Parameters/GeneratedFileListParameter.hpp"
 #include "complex/Pipeline/Pipeline.hpp"
+#include "complex/Pipeline/PipelineCache.hpp"
 #include "complex/Pipeline/PipelineFilter.hpp"
 #include "complex/Plugin/AbstractPlugin.hpp"
+#include "complex/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
 
 #include "complex/unit_test/complex_test_dirs.hpp"
 
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <typeinfo>
 
 #include <nlohmann/json.hpp>
@@ -105,6 +113,203 @@ protected:
     return {};
   }
 };
+
+struct FilterCounts
+{
+  usize preflightCount = 0;
+  usize executeCount = 0;
+  usize executeLimit = std::numeric_limits<usize>::max();
+};
+
+class CountingTestFilter : public IFilter
+{
+public:
+  static inline constexpr StringLiteral k_OutputPath_Key = "output_path";
+
+  CountingTestFilter(FilterCounts& counts)
+  : m_Counts(counts)
+  {
+  }
+
+  ~CountingTestFilter() noexcept override = default;
+
+  CountingTestFilter(const CountingTestFilter&) = delete;
+  CountingTestFilter(CountingTestFilter&&) noexcept = delete;
+
+  CountingTestFilter& operator=(const CountingTestFilter&) = delete;
+  CountingTestFilter& operator=(CountingTestFilter&&) noexcept = delete;
+
+  std::string name() const override
+  {
+    return "CountingTestFilter";
+  }
+
+  std::string className() const override
+  {
+    return "CountingTestFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    static constexpr Uuid uuid = *Uuid::FromString("3f8a8a4e-5c1b-4f59-9a3e-7d0f2b8e6c41");
+    return uuid;
+  }
+
+  std::string humanName() const override
+  {
+    return "Counting Test Filter";
+  }
+
+  Parameters parameters() const override
+  {
+    Parameters params;
+    params.insert(std::make_unique<ArrayCreationParameter>(k_OutputPath_Key, "Output Path", "", DataPath{}));
+    return params;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<CountingTestFilter>(m_Counts);
+  }
+
+protected:
+  PreflightResult preflightImpl(const DataStructure& data, const Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    m_Counts.preflightCount++;
+    OutputActions outputActions;
+    outputActions.actions.push_back(std::make_unique<CreateArrayAction>(DataType::int32, std::vector<usize>{10}, std::vector<usize>{1}, args.value<DataPath>(k_OutputPath_Key)));
+    return {std::move(outputActions)};
+  }
+
+  Result<> executeImpl(DataStructure& data, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    if(m_Counts.executeCount >= m_Counts.executeLimit)
+    {
+      return MakeErrorResult(-1, "Execute limit reached");
+    }
+    m_Counts.executeCount++;
+    return {};
+  }
+
+private:
+  FilterCounts& m_Counts;
+};
+
+/**
+ * @brief Counts like CountingTestFilter but has an output file parameter like a
+ * filter that writes files.
+ */
+class WritingTestFilter : public CountingTestFilter
+{
+public:
+  static inline constexpr StringLiteral k_OutputFile_Key = "output_file";
+
+  WritingTestFilter(FilterCounts& counts)
+  : CountingTestFilter(counts)
+  , m_Counts(counts)
+  {
+  }
+
+  ~WritingTestFilter() noexcept override = default;
+
+  std::string name() const override
+  {
+    return "WritingTestFilter";
+  }
+
+  std::string className() const override
+  {
+    return "WritingTestFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    static constexpr Uuid uuid = *Uuid::FromString("8c0e4d2a-61f7-4b53-a9d8-2e5b7f1c9a34");
+    return uuid;
+  }
+
+  std::string humanName() const override
+  {
+    return "Writing Test Filter";
+  }
+
+  Parameters parameters() const override
+  {
+    Parameters params = CountingTestFilter::parameters();
+    params.insert(std::make_unique<FileSystemPathParameter>(k_OutputFile_Key, "Output File", "", fs::path{}, FileSystemPathParameter::ExtensionsType{},
+                                                            FileSystemPathParameter::PathType::OutputFile, true));
+    return params;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<WritingTestFilter>(m_Counts);
+  }
+
+private:
+  FilterCounts& m_Counts;
+};
+
+/**
+ * @brief Counts like CountingTestFilter but has a "use seed" parameter like a
+ * filter that seeds itself from the clock unless a seed is given.
+ */
+class SeededTestFilter : public CountingTestFilter
+{
+public:
+  static inline constexpr StringLiteral k_UseSeed_Key = "use_seed";
+
+  SeededTestFilter(FilterCounts& counts)
+  : CountingTestFilter(counts)
+  , m_Counts(counts)
+  {
+  }
+
+  ~SeededTestFilter() noexcept override = default;
+
+  std::string name() const override
+  {
+    return "SeededTestFilter";
+  }
+
+  std::string className() const override
+  {
+    return "SeededTestFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    static constexpr Uuid uuid = *Uuid::FromString("3f9a6c1e-8d24-4e71-b5a0-7c2d9e4f1b86");
+    return uuid;
+  }
+
+  std::string humanName() const override
+  {
+    return "Seeded Test Filter";
+  }
+
+  Parameters parameters() const override
+  {
+    Parameters params = CountingTestFilter::parameters();
+    params.insert(std::make_unique<BoolParameter>(k_UseSeed_Key, "Use Seed", "", false));
+    return params;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<SeededTestFilter>(m_Counts);
+  }
+
+private:
+  FilterCounts& m_Counts;
+};
+
+Arguments CreateCountingArgs(const std::string& outputName)
+{
+  Arguments args;
+  args.insert(CountingTestFilter::k_OutputPath_Key, DataPath({outputName}));
+  return args;
+}
 } // namespace
 
 TEST_CASE("Execute Pipeline")
@@ -261,6 +466,36 @@ TEST_CASE("PipelineJson")
   REQUIRE(pipelineJson == pipeline2Json);
 }
 
+TEST_CASE("PipelineArgumentOverridesTest")
+{
+  const nlohmann::json pipelineJson = {{"name", "test"},
+                                       {"pipeline",
+                                        {{{"args", {{"input_file", "scan_0.ang"}, {"step", 1}}}, {"filter", {{"name", "A"}}}},
+                                         {{"args", {{"output_file", "out_0.dream3d"}}}, {"filter", {{"name", "B"}}}}}}};
+
+  // Listed arguments are replaced or added, the others are kept
+  nlohmann::json overrides = {{"0", {{"input_file", "scan_1.ang"}, {"threshold", 0.5}}}, {"1", {{"output_file", "out_1.dream3d"}}}};
+  Result<nlohmann::json> result = Pipeline::ApplyArgumentOverrides(pipelineJson, overrides);
+  REQUIRE(result.valid());
+  const nlohmann::json& items = result.value()["pipeline"];
+  REQUIRE(items[0]["args"]["input_file"] == "scan_1.ang");
+  REQUIRE(items[0]["args"]["step"] == 1);
+  REQUIRE(items[0]["args"]["threshold"] == 0.5);
+  REQUIRE(items[1]["args"]["output_file"] == "out_1.dream3d");
+  REQUIRE(items[1]["filter"]["name"] == "B");
+  REQUIRE(pipelineJson["pipeline"][0]["args"]["input_file"] == "scan_0.ang");
+
+  REQUIRE(Pipeline::ApplyArgumentOverrides(pipelineJson, nlohmann::json::object()).value() == pipelineJson);
+
+  // Invalid overrides are reported instead of thrown
+  REQUIRE(Pipeline::ApplyArgumentOverrides(pipelineJson, {{"2", {{"step", 2}}}}).invalid());
+  REQUIRE(Pipeline::ApplyArgumentOverrides(pipelineJson, {{"1x", {{"step", 2}}}}).invalid());
+  REQUIRE(Pipeline::ApplyArgumentOverrides(pipelineJson, {{"-1", {{"step", 2}}}}).invalid());
+  REQUIRE(Pipeline::ApplyArgumentOverrides(pipelineJson, {{"0", 2}}).invalid());
+  REQUIRE(Pipeline::ApplyArgumentOverrides(pipelineJson, nlohmann::json::array()).invalid());
+  REQUIRE(Pipeline::ApplyArgumentOverrides(nlohmann::json{{"name", "test"}}, nlohmann::json::object()).invalid());
+}
+
 TEST_CASE("Rename Output")
 {
   Application app;
@@ -368,3 +603,252 @@ TEST_CASE("PipelineDeferredActionTest")
   DataObject* executeObject = dataStructure.getData(k_DeferredActionPath);
   REQUIRE(executeObject == nullptr);
 }
+
+TEST_CASE("PipelineIncrementalPreflightTest")
+{
+  FilterCounts counts;
+  Pipeline pipeline;
+  for(const auto& name : {"A", "B", "C", "D"})
+  {
+    REQUIRE(pipeline.push_back(std::make_unique<CountingTestFilter>(counts), CreateCountingArgs(name)));
+  }
+  REQUIRE(pipeline.getFirstStaleIndex() == 0);
+
+  REQUIRE(pipeline.preflightIncremental());
+  REQUIRE(counts.preflightCount == 4);
+  REQUIRE(pipeline.getFirstStaleIndex() == pipeline.size());
+
+  // Nothing changed
+  REQUIRE(pipeline.preflightIncremental());
+  REQUIRE(counts.preflightCount == 4);
+
+  // Only the edited node and the nodes after it are preflighted again
+  auto* filterNode = dynamic_cast<PipelineFilter*>(pipeline.at(2));
+  REQUIRE(filterNode != nullptr);
+  filterNode->setArguments(filterNode->getArguments());
+  REQUIRE(pipeline.getFirstStaleIndex() == 2);
+  REQUIRE(pipeline.preflightIncremental());
+  REQUIRE(counts.preflightCount == 6);
+  const DataStructure& lastStructure = pipeline.at(3)->getPreflightStructure();
+  for(const auto& name : {"A", "B", "C", "D"})
+  {
+    REQUIRE(lastStructure.getData(DataPath({name})) != nullptr);
+  }
+
+  // Disabled nodes are skipped and the preceding enabled node's result is reused
+  pipeline.at(1)->setDisabled();
+  REQUIRE(pipeline.getFirstStaleIndex() == 1);
+  REQUIRE(pipeline.preflightIncremental());
+  REQUIRE(counts.preflightCount == 8);
+  REQUIRE(pipeline.at(3)->getPreflightStructure().getData(DataPath({"B"})) == nullptr);
+
+  REQUIRE(pipeline.move(3, 0));
+  REQUIRE(pipeline.getFirstStaleIndex() == 0);
+  REQUIRE(pipeline.preflightIncremental());
+  REQUIRE(counts.preflightCount == 11);
+
+  REQUIRE(pipeline.removeAt(3));
+  REQUIRE(pipeline.getFirstStaleIndex() == 3);
+  REQUIRE(pipeline.preflightIncremental());
+  REQUIRE(counts.preflightCount == 11);
+}
+
+TEST_CASE("PipelineCacheTest")
+{
+  Application app;
+  const fs::path cacheDir = fs::path(unit_test::k_BinaryDir.view()) / "PipelineCacheTest";
+  fs::remove_all(cacheDir);
+
+  FilterCounts counts;
+  Pipeline pipeline;
+  for(const auto& name : {"A", "B", "C"})
+  {
+    REQUIRE(pipeline.push_back(std::make_unique<CountingTestFilter>(counts), CreateCountingArgs(name)));
+  }
+  auto cache = std::make_shared<PipelineCache>(cacheDir, 1024 * 1024 * 1024);
+  pipeline.setCache(cache);
+
+  // The test filters finish immediately, which is too fast to be stored by default
+  REQUIRE(cache->getMinimumExecutionTime() == PipelineCache::k_DefaultMinimumExecutionTime);
+  REQUIRE(cache->getMinimumExecutionTime() > std::chrono::milliseconds(0));
+  REQUIRE(pipeline.execute());
+  REQUIRE(counts.executeCount == 3);
+  REQUIRE(cache->getNumberOfSnapshots() == 0);
+  cache->setMinimumExecutionTime(std::chrono::milliseconds(0));
+
+  REQUIRE(pipeline.execute());
+  REQUIRE(counts.executeCount == 6);
+  REQUIRE(cache->getNumberOfSnapshots() == 3);
+
+  // Every filter is unchanged, so the whole result is restored
+  REQUIRE(pipeline.execute());
+  REQUIRE(counts.executeCount == 6);
+  for(const auto& name : {"A", "B", "C"})
+  {
+    REQUIRE(pipeline.getDataStructure().getData(DataPath({name})) != nullptr);
+  }
+
+  // Only the filters after the change run again
+  pipeline.at(1)->setDisabled();
+  REQUIRE(pipeline.execute());
+  REQUIRE(counts.executeCount == 7);
+  REQUIRE(pipeline.getDataStructure().getData(DataPath({"B"})) == nullptr);
+  REQUIRE(pipeline.getDataStructure().getData(DataPath({"C"})) != nullptr);
+
+  // Snapshots written by an earlier run are picked up from the directory
+  PipelineCache reopenedCache(cacheDir, 1024 * 1024 * 1024);
+  REQUIRE(reopenedCache.getNumberOfSnapshots() == cache->getNumberOfSnapshots());
+
+  // The least recently used snapshots are removed to stay within the budget
+  cache->setSizeBudget(cache->getSize() / 2);
+  REQUIRE(cache->getSize() <= cache->getSizeBudget());
+  REQUIRE(cache->getNumberOfSnapshots() < 4);
+
+  cache->clear();
+  REQUIRE(cache->getNumberOfSnapshots() == 0);
+
+  // Files referred to by any file bearing argument are part of the key
+  const fs::path inputPath = cacheDir / "input.dream3d";
+  std::ofstream(inputPath) << "1";
+  Arguments importArgs = CreateCountingArgs("D");
+  importArgs.insert("import_file", Dream3dImportParameter::ImportData{inputPath});
+  PipelineFilter importFilter(std::make_unique<CountingTestFilter>(counts), importArgs);
+  const PipelineCache::KeyType importKey = PipelineCache::HashFilter(0, importFilter);
+  std::ofstream(inputPath) << "12";
+  REQUIRE(PipelineCache::HashFilter(0, importFilter) != importKey);
+
+  // The cached prefix ends before the first filter that writes files, so the files are always written
+  FilterCounts writerCounts;
+  Pipeline writerPipeline;
+  REQUIRE(writerPipeline.push_back(std::make_unique<CountingTestFilter>(writerCounts), CreateCountingArgs("A")));
+  Arguments writerArgs = CreateCountingArgs("W");
+  writerArgs.insert(WritingTestFilter::k_OutputFile_Key, cacheDir / "output.txt");
+  REQUIRE(writerPipeline.push_back(std::make_unique<WritingTestFilter>(writerCounts), writerArgs));
+  REQUIRE(writerPipeline.push_back(std::make_unique<CountingTestFilter>(writerCounts), CreateCountingArgs("X")));
+  writerPipeline.setCache(cache);
+  REQUIRE(writerPipeline.execute());
+  REQUIRE(writerCounts.executeCount == 3);
+  REQUIRE(cache->getNumberOfSnapshots() == 1);
+  REQUIRE(writerPipeline.execute());
+  REQUIRE(writerCounts.executeCount == 5);
+
+  // Filters seeded from the clock are only cacheable with a fixed seed
+  PipelineFilter unseededFilter(std::make_unique<SeededTestFilter>(counts), CreateCountingArgs("S"));
+  REQUIRE_FALSE(PipelineCache::IsCacheable(unseededFilter));
+  Arguments seededArgs = CreateCountingArgs("S");
+  seededArgs.insert(SeededTestFilter::k_UseSeed_Key, true);
+  PipelineFilter seededFilter(std::make_unique<SeededTestFilter>(counts), seededArgs);
+  REQUIRE(PipelineCache::IsCacheable(seededFilter));
+
+  // A snapshot that cannot be written is reported as a warning and does not stop the pipeline
+  cache->clear();
+  fs::remove_all(cacheDir);
+  std::ofstream(cacheDir) << "not a directory";
+  WarningCollection storeWarnings;
+  pipeline.getFilterFaultDetailSignal().connect(
+      [&storeWarnings](AbstractPipelineNode*, int32, const WarningCollection& warnings, const ErrorCollection&) { storeWarnings.insert(storeWarnings.end(), warnings.cbegin(), warnings.cend()); });
+  pipeline.at(1)->setEnabled();
+  REQUIRE(pipeline.execute());
+  REQUIRE(counts.executeCount == 10);
+  REQUIRE(storeWarnings.size() == 3);
+  REQUIRE(pipeline.hasWarnings());
+
+  fs::remove_all(cacheDir);
+}
+
+TEST_CASE("PipelineCheckpointTest")
+{
+  Application app;
+  const fs::path checkpointPath = fs::path(unit_test::k_BinaryDir.view()) / "PipelineCheckpointTest.dream3d";
+  fs::remove(checkpointPath);
+
+  FilterCounts counts;
+  Pipeline pipeline;
+  for(const auto& name : {"A", "B", "C", "D"})
+  {
+    REQUIRE(pipeline.push_back(std::make_unique<CountingTestFilter>(counts), CreateCountingArgs(name)));
+  }
+  pipeline.setCheckpointPath(checkpointPath);
+  pipeline.setCheckpointIndices({1});
+
+  // Fail in the third filter; the checkpoint written after the second one is kept
+  counts.executeLimit = 2;
+  REQUIRE_FALSE(pipeline.execute());
+  REQUIRE(fs::exists(checkpointPath));
+  Result<DREAM3D::CheckpointData> checkpointResult = DREAM3D::ReadCheckpoint(checkpointPath);
+  REQUIRE(checkpointResult.valid());
+  REQUIRE(checkpointResult.value().nextIndex == 2);
+  REQUIRE(checkpointResult.value().dataStructure.getData(DataPath({"B"})) != nullptr);
+
+  // Only the filters after the checkpoint run when resuming
+  counts.executeLimit = std::numeric_limits<usize>::max();
+  REQUIRE(pipeline.resumeFromCheckpoint());
+  REQUIRE(counts.executeCount == 4);
+  for(const auto& name : {"A", "B", "C", "D"})
+  {
+    REQUIRE(pipeline.getDataStructure().getData(DataPath({name})) != nullptr);
+  }
+  REQUIRE_FALSE(fs::exists(checkpointPath));
+
+  // Without a checkpoint the pipeline runs from the start
+  REQUIRE(pipeline.resumeFromCheckpoint());
+  REQUIRE(counts.executeCount == 8);
+}
+
+TEST_CASE("PipelineMemoryEstimateTest")
+{
+  FilterCounts counts;
+  Pipeline pipeline;
+  for(const auto& name : {"A", "B"})
+  {
+    REQUIRE(pipeline.push_back(std::make_unique<CountingTestFilter>(counts), CreateCountingArgs(name)));
+  }
+  REQUIRE(pipeline.push_back(std::make_unique<DeferredActionTestFilter>()));
+
+  // Every node must be preflighted first
+  REQUIRE(pipeline.estimateMemoryUsage().invalid());
+  REQUIRE(pipeline.preflight());
+
+  // Each filter creates a 10 x int32 array; the last one removes its array once it finishes
+  auto estimatesResult = pipeline.estimateMemoryUsage();
+  REQUIRE(estimatesResult.valid());
+  const auto& estimates = estimatesResult.value();
+  REQUIRE(estimates.size() == 3);
+  REQUIRE(estimates[0].bytesBefore == 0);
+  REQUIRE(estimates[0].peakBytes == 40);
+  REQUIRE(estimates[0].bytesAfter == 40);
+  REQUIRE(estimates[1].bytesBefore == 40);
+  REQUIRE(estimates[1].peakBytes == 80);
+  REQUIRE(estimates[1].bytesAfter == 80);
+  REQUIRE(estimates[2].bytesBefore == 80);
+  REQUIRE(estimates[2].peakBytes == 120);
+  REQUIRE(estimates[2].bytesAfter == 80);
+  REQUIRE(pipeline.at(1)->getPreflightStructure().getTotalArrayMemoryUsage() == 80);
+
+  // Disabled nodes are left out
+  pipeline.at(1)->setDisabled();
+  REQUIRE(pipeline.preflightIncremental());
+  estimatesResult = pipeline.estimateMemoryUsage();
+  REQUIRE(estimatesResult.valid());
+  REQUIRE(estimatesResult.value().size() == 2);
+  REQUIRE(estimatesResult.value()[1].peakBytes == 80);
+  pipeline.at(1)->setEnabled();
+
+  // Execution is refused without running any filter when a peak is over the budget
+  std::vector<Error> budgetErrors;
+  int32 budgetFaultIndex = -1;
+  pipeline.getFilterFaultDetailSignal().connect([&budgetErrors, &budgetFaultIndex](AbstractPipelineNode*, int32 index, const WarningCollection&, const ErrorCollection& errors) {
+    budgetErrors = errors;
+    budgetFaultIndex = index;
+  });
+  pipeline.setMemoryBudget(100);
+  REQUIRE_FALSE(pipeline.execute());
+  REQUIRE(counts.executeCount == 0);
+  REQUIRE(budgetErrors.size() == 1);
+  REQUIRE(budgetErrors[0].message.find("Node 2") != std::string::npos);
+  REQUIRE(budgetFaultIndex == 2);
+
+  pipeline.setMemoryBudget(120);
+  REQUIRE(pipeline.execute());
+  REQUIRE(counts.executeCount == 2);
+}
@@ -0,0 +1,156 @@
+#include <catch2/catch.hpp>
+
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/Utilities/SegmentedReduction.hpp"
+
+#include <algorithm>
+#include <limits>
+
+using namespace complex;
+
+TEST_CASE("SegmentedReductionTest")
+{
+  // Enough cells that the reductions are split into several slabs
+  constexpr usize k_NumCells = 100000;
+  constexpr usize k_NumFeatures = 37;
+
+  DataStructure dataStructure;
+  auto* featureIds = Int32Array::CreateWithStore<DataStore<int32>>(dataStructure, "FeatureIds", std::vector<usize>{k_NumCells}, std::vector<usize>{1});
+  auto* values = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Values", std::vector<usize>{k_NumCells}, std::vector<usize>{1});
+  auto* mask = BoolArray::CreateWithStore<DataStore<bool>>(dataStructure, "Mask", std::vector<usize>{k_NumCells}, std::vector<usize>{1});
+  REQUIRE(featureIds != nullptr);
+  REQUIRE(values != nullptr);
+  REQUIRE(mask != nullptr);
+
+  // Feature 0 is left empty and some cells have an invalid feature id
+  uint32 state = 12345;
+  for(usize i = 0; i < k_NumCells; i++)
+  {
+    state = state * 1664525u + 1013904223u;
+    const int32 featureId = static_cast<int32>((state >> 8) % (k_NumFeatures + 1)) - 1;
+    (*featureIds)[i] = featureId == 0 ? -1 : featureId;
+    (*values)[i] = static_cast<float32>(state % 1000);
+    (*mask)[i] = (state & 0x10) != 0;
+  }
+  (*featureIds)[k_NumCells - 1] = k_NumFeatures - 1;
+
+  SECTION("Number of features")
+  {
+    REQUIRE(SegmentedReduction::FindNumberOfFeatures(*featureIds) == k_NumFeatures);
+  }
+
+  SECTION("Count and bounds")
+  {
+    std::vector<usize> counts = SegmentedReduction::CountCells(*featureIds, k_NumFeatures);
+    std::vector<SegmentedReduction::CellBounds> bounds = SegmentedReduction::FindCellBounds(*featureIds, k_NumFeatures);
+    std::vector<usize> expectedCounts(k_NumFeatures, 0);
+    std::vector<SegmentedReduction::CellBounds> expectedBounds(k_NumFeatures);
+    for(usize i = 0; i < k_NumCells; i++)
+    {
+      const int32 featureId = (*featureIds)[i];
+      if(featureId < 0)
+      {
+        continue;
+      }
+      expectedCounts[featureId]++;
+      if(expectedBounds[featureId].empty())
+      {
+        expectedBounds[featureId].first = i;
+      }
+      expectedBounds[featureId].last = i;
+    }
+    REQUIRE(counts == expectedCounts);
+    REQUIRE(counts[0] == 0);
+    REQUIRE(bounds[0].empty());
+    for(usize featureId = 0; featureId < k_NumFeatures; featureId++)
+    {
+      REQUIRE(bounds[featureId].first == expectedBounds[featureId].first);
+      REQUIRE(bounds[featureId].last == expectedBounds[featureId].last);
+    }
+  }
+
+  SECTION("Custom masked reduction")
+  {
+    struct MinMaxSum
+    {
+      float32 min = std::numeric_limits<float32>::max();
+      float32 max = std::numeric_limits<float32>::lowest();
+      float64 sum = 0.0;
+    };
+    std::unique_ptr<MaskCompare> maskCompare = InstantiateMaskCompare(*mask);
+    std::vector<MinMaxSum> results = SegmentedReduction::Reduce<MinMaxSum>(
+        *featureIds, k_NumFeatures, MinMaxSum{},
+        [values](MinMaxSum& result, usize cellIndex) {
+          const float32 value = (*values)[cellIndex];
+          result.min = std::min(result.min, value);
+          result.max = std::max(result.max, value);
+          result.sum += value;
+        },
+        [](MinMaxSum& total, const MinMaxSum& result) {
+          total.min = std::min(total.min, result.min);
+          total.max = std::max(total.max, result.max);
+          total.sum += result.sum;
+        },
+        maskCompare.get());
+
+    std::vector<MinMaxSum> expected(k_NumFeatures);
+    for(usize i = 0; i < k_NumCells; i++)
+    {
+      const int32 featureId = (*featureIds)[i];
+      if(featureId < 0 || !(*mask)[i])
+      {
+        continue;
+      }
+      const float32 value = (*values)[i];
+      expected[featureId].min = std::min(expected[featureId].min, value);
+      expected[featureId].max = std::max(expected[featureId].max, value);
+      expected[featureId].sum += value;
+    }
+    for(usize featureId = 0; featureId < k_NumFeatures; featureId++)
+    {
+      REQUIRE(results[featureId].min == expected[featureId].min);
+      REQUIRE(results[featureId].max == expected[featureId].max);
+      // The values are whole numbers so the sums are exact regardless of the order
+      REQUIRE(results[featureId].sum == expected[featureId].sum);
+    }
+  }
+
+  SECTION("Feature grouping")
+  {
+    std::unique_ptr<MaskCompare> maskCompare = InstantiateMaskCompare(*mask);
+    const SegmentedReduction::FeatureGrouping grouping(*featureIds, k_NumFeatures, maskCompare.get());
+    REQUIRE(grouping.getNumberOfFeatures() == k_NumFeatures);
+    REQUIRE(grouping.getOffsets().size() == k_NumFeatures + 1);
+
+    std::vector<std::vector<usize>> expected(k_NumFeatures);
+    usize numGrouped = 0;
+    for(usize i = 0; i < k_NumCells; i++)
+    {
+      const int32 featureId = (*featureIds)[i];
+      if(featureId >= 0 && (*mask)[i])
+      {
+        expected[featureId].push_back(i);
+        numGrouped++;
+      }
+    }
+    REQUIRE(grouping.getNumberOfCells() == numGrouped);
+    for(usize featureId = 0; featureId < k_NumFeatures; featureId++)
+    {
+      nonstd::span<const usize> cells = grouping.getCells(featureId);
+      REQUIRE(std::vector<usize>(cells.begin(), cells.end()) == expected[featureId]);
+    }
+    REQUIRE(grouping.getCells(k_NumFeatures).empty());
+  }
+
+  SECTION("Empty input")
+  {
+    auto* emptyIds = Int32Array::CreateWithStore<DataStore<int32>>(dataStructure, "EmptyIds", std::vector<usize>{0}, std::vector<usize>{1});
+    REQUIRE(SegmentedReduction::FindNumberOfFeatures(*emptyIds) == 0);
+    REQUIRE(SegmentedReduction::CountCells(*emptyIds, 3) == std::vector<usize>(3, 0));
+    const SegmentedReduction::FeatureGrouping grouping(*emptyIds, 3);
+    REQUIRE(grouping.getNumberOfCells() == 0);
+    REQUIRE(grouping.getCells(1).empty());
+  }
+}
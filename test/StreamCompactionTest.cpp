@@ -0,0 +1,40 @@
+#include <catch2/catch.hpp>
+
+#include "complex/Common/Types.hpp"
+#include "complex/Utilities/StreamCompaction.hpp"
+
+#include <vector>
+
+using namespace complex;
+
+TEST_CASE("StreamCompactionTest")
+{
+  SECTION("Matches a serial loop")
+  {
+    // Spans several blocks with a partial last block
+    const usize size = 3 * StreamCompaction::k_BlockSize + 123;
+    auto predicate = [](usize index) { return (index * 2654435761u) % 7 < 3; };
+
+    std::vector<int64> expected;
+    for(usize index = 0; index < size; index++)
+    {
+      if(predicate(index))
+      {
+        expected.push_back(static_cast<int64>(index));
+      }
+    }
+    REQUIRE(StreamCompaction::SelectIndices<int64>(size, predicate) == expected);
+  }
+
+  SECTION("Nothing or everything selected")
+  {
+    const usize size = StreamCompaction::k_BlockSize + 1;
+    REQUIRE(StreamCompaction::SelectIndices(size, [](usize) { return false; }).empty());
+    REQUIRE(StreamCompaction::SelectIndices(0, [](usize) { return true; }).empty());
+
+    std::vector<usize> all = StreamCompaction::SelectIndices(size, [](usize) { return true; });
+    REQUIRE(all.size() == size);
+    REQUIRE(all.front() == 0);
+    REQUIRE(all.back() == size - 1);
+  }
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+
+#include "complex/DataStructure/DataArray.hpp"
+#include "complex/DataStructure/DataStore.hpp"
+#include "complex/DataStructure/DataStructure.hpp"
+#include "complex/Utilities/TupleCopier.hpp"
+
+#include <limits>
+#include <stdexcept>
+
+using namespace complex;
+
+TEST_CASE("TupleCopierTest")
+{
+  DataStructure dataStructure;
+  auto* sourceFloats = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "SourceFloats", std::vector<usize>{4}, std::vector<usize>{3});
+  auto* sourceBools = BoolArray::CreateWithStore<DataStore<bool>>(dataStructure, "SourceBools", std::vector<usize>{4}, std::vector<usize>{1});
+  for(usize i = 0; i < 4; i++)
+  {
+    for(usize comp = 0; comp < 3; comp++)
+    {
+      (*sourceFloats)[3 * i + comp] = static_cast<float32>(10 * i + comp);
+    }
+    (*sourceBools)[i] = (i % 2) == 1;
+  }
+
+  SECTION("Gather")
+  {
+    auto* floats = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Floats", std::vector<usize>{6}, std::vector<usize>{3});
+    auto* bools = BoolArray::CreateWithStore<DataStore<bool>>(dataStructure, "Bools", std::vector<usize>{6}, std::vector<usize>{1});
+    TupleCopier tupleCopier;
+    tupleCopier.addArrays(*sourceFloats, *floats);
+    tupleCopier.addArrays(*sourceBools, *bools);
+    REQUIRE(tupleCopier.getNumberOfArrays() == 2);
+
+    const std::vector<int32> indices = {3, 0, 1, 1, 2};
+    tupleCopier.gather(nonstd::span<const int32>(indices.data(), indices.size()), 1);
+    for(usize i = 0; i < indices.size(); i++)
+    {
+      for(usize comp = 0; comp < 3; comp++)
+      {
+        REQUIRE((*floats)[3 * (i + 1) + comp] == (*sourceFloats)[3 * indices[i] + comp]);
+      }
+      REQUIRE((*bools)[i + 1] == (*sourceBools)[indices[i]]);
+    }
+  }
+
+  SECTION("Scatter")
+  {
+    auto* floats = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Floats", std::vector<usize>{3}, std::vector<usize>{3});
+    floats->fill(-1.0f);
+    TupleCopier tupleCopier;
+    tupleCopier.addArrays(*sourceFloats, *floats);
+
+    constexpr uint64 k_Skip = std::numeric_limits<uint64>::max();
+    const std::vector<uint64> indices = {2, k_Skip, 0, k_Skip};
+    tupleCopier.scatter(nonstd::span<const uint64>(indices.data(), indices.size()), k_Skip);
+    for(usize comp = 0; comp < 3; comp++)
+    {
+      REQUIRE((*floats)[comp] == (*sourceFloats)[6 + comp]);
+      REQUIRE((*floats)[3 + comp] == -1.0f);
+      REQUIRE((*floats)[6 + comp] == (*sourceFloats)[comp]);
+    }
+  }
+
+  SECTION("Copy within an array")
+  {
+    TupleCopier tupleCopier;
+    tupleCopier.addArrays(*sourceFloats, *sourceFloats);
+
+    const std::vector<usize> sourceIndices = {0, 0, 3};
+    const std::vector<usize> destinationIndices = {1, 2, 3};
+    tupleCopier.copy(nonstd::span<const usize>(sourceIndices.data(), sourceIndices.size()), nonstd::span<const usize>(destinationIndices.data(), destinationIndices.size()));
+    for(usize comp = 0; comp < 3; comp++)
+    {
+      REQUIRE((*sourceFloats)[comp] == static_cast<float32>(comp));
+      REQUIRE((*sourceFloats)[3 + comp] == static_cast<float32>(comp));
+      REQUIRE((*sourceFloats)[6 + comp] == static_cast<float32>(comp));
+      REQUIRE((*sourceFloats)[9 + comp] == static_cast<float32>(30 + comp));
+    }
+  }
+
+  SECTION("Copy a run of tuples")
+  {
+    auto* floats = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Floats", std::vector<usize>{5}, std::vector<usize>{3});
+    auto* bools = BoolArray::CreateWithStore<DataStore<bool>>(dataStructure, "Bools", std::vector<usize>{5}, std::vector<usize>{1});
+    floats->fill(-1.0f);
+    bools->fill(false);
+    TupleCopier tupleCopier;
+    tupleCopier.addArrays(*sourceFloats, *floats);
+    tupleCopier.addArrays(*sourceBools, *bools);
+
+    tupleCopier.copyTuples(1, 2, 3);
+    for(usize comp = 0; comp < 3; comp++)
+    {
+      REQUIRE((*floats)[comp] == -1.0f);
+      REQUIRE((*floats)[3 + comp] == -1.0f);
+      for(usize i = 0; i < 3; i++)
+      {
+        REQUIRE((*floats)[3 * (i + 2) + comp] == (*sourceFloats)[3 * (i + 1) + comp]);
+      }
+    }
+    for(usize i = 0; i < 3; i++)
+    {
+      REQUIRE((*bools)[i + 2] == (*sourceBools)[i + 1]);
+    }
+  }
+
+  SECTION("Mismatched arrays")
+  {
+    auto* ints = Int32Array::CreateWithStore<DataStore<int32>>(dataStructure, "Ints", std::vector<usize>{4}, std::vector<usize>{3});
+    auto* floats = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Floats", std::vector<usize>{4}, std::vector<usize>{2});
+    TupleCopier tupleCopier;
+    REQUIRE_THROWS_AS(tupleCopier.addArrays(*sourceFloats, *ints), std::runtime_error);
+    REQUIRE_THROWS_AS(tupleCopier.addArrays(*sourceFloats, *floats), std::runtime_error);
+  }
+}